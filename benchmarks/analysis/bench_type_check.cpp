@@ -0,0 +1,208 @@
+#include <cool/analysis/analysis_context.h>
+#include <cool/analysis/classes_definition.h>
+#include <cool/analysis/classes_implementation.h>
+#include <cool/analysis/prelude.h>
+#include <cool/analysis/type_check.h>
+#include <cool/core/class_registry.h>
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace cool;
+
+namespace {
+
+/// Number of times each measurement is repeated
+constexpr size_t REPETITIONS_COUNT = 10;
+
+/// Number of table accesses per measurement
+constexpr size_t ACCESSES_COUNT = 10000000;
+
+/// Helper function to create a program with the given number of classes. Class
+/// Ci inherits from Object every eighth class, and from class Ci-1 otherwise.
+/// Each class has an attribute ai and a method fi whose body is a block of the
+/// given number of statements, which cycle through:
+///
+///   ai <- ai + x
+///   let t : Int <- x in t * ai
+///   fi(x)
+///   x < ai
+///
+/// The program also has an empty Main class
+///
+/// \param[in] classesCount number of classes
+/// \param[in] statementsCount number of statements per method
+/// \return a shared pointer to the program node
+ProgramNodePtr MakeProgram(const size_t classesCount,
+                           const size_t statementsCount) {
+  auto id = [](const Symbol &name) {
+    return IdExprNode::MakeIdExprNode(name, 0);
+  };
+  auto arithmetic = [](ExprNodePtr lhs, ExprNodePtr rhs,
+                       const ArithmeticOpID opID) {
+    return BinaryExprNode<ArithmeticOpID>::MakeBinaryExprNode(lhs, rhs, opID,
+                                                              0);
+  };
+
+  auto classes = ProgramNode::BuiltInClasses();
+  for (size_t i = 0; i < classesCount; ++i) {
+    const std::string suffix = std::to_string(i);
+    const Symbol attribute("a" + suffix);
+    const Symbol method("f" + suffix);
+
+    std::vector<ExprNodePtr> statements;
+    for (size_t j = 0; j < statementsCount; ++j) {
+      switch (j % 4) {
+      case 0:
+        statements.push_back(AssignmentExprNode::MakeAssignmentExprNode(
+            attribute,
+            arithmetic(id(attribute), id("x"), ArithmeticOpID::Plus), 0));
+        break;
+      case 1:
+        statements.push_back(LetExprNode::MakeLetExprNode(
+            {LetBindingNode::MakeLetBindingNode("t", "Int", id("x"), 0)},
+            arithmetic(id("t"), id(attribute), ArithmeticOpID::Mult), 0));
+        break;
+      case 2:
+        statements.push_back(DispatchExprNode::MakeDispatchExprNode(
+            method, nullptr, {id("x")}, 0));
+        break;
+      default:
+        statements.push_back(
+            BinaryExprNode<ComparisonOpID>::MakeBinaryExprNode(
+                id("x"), id(attribute), ComparisonOpID::LessThan, 0));
+        break;
+      }
+    }
+    statements.push_back(id(attribute));
+
+    std::vector<GenericAttributeNodePtr> attributes;
+    attributes.push_back(AttributeNode::MakeAttributeNode(
+        attribute, "Int",
+        LiteralExprNode<int32_t>::MakeLiteralExprNode(0, 0), 0));
+    attributes.push_back(MethodNode::MakeMethodNode(
+        method, "Int", {FormalNode::MakeFormalNode("x", "Int", 0)},
+        BlockExprNode::MakeBlockExprNode(statements, 0), 0));
+
+    const std::string parent =
+        i % 8 == 0 ? "Object" : "C" + std::to_string(i - 1);
+    classes.push_back(ClassNode::MakeClassNode("C" + suffix, parent,
+                                               attributes, false, 0));
+  }
+
+  std::vector<GenericAttributeNodePtr> attributesMain;
+  attributesMain.push_back(MethodNode::MakeMethodNode(
+      "main", "Object", {}, NewExprNode::MakeNewExprNode("Object", 0), 0));
+  classes.push_back(
+      ClassNode::MakeClassNode("Main", "Object", attributesMain, false, 0));
+  return ProgramNode::MakeProgramNode(classes);
+}
+
+/// Helper function to measure the minimum time of a function
+///
+/// \param[in] func function to measure
+/// \return the minimum time in nanoseconds
+template <typename FuncT> double MeasureMinimum(FuncT func) {
+  double best = 0.0;
+  for (size_t i = 0; i < REPETITIONS_COUNT; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+
+    std::chrono::duration<double, std::nano> elapsed = end - start;
+    best = i == 0 ? elapsed.count() : std::min(best, elapsed.count());
+  }
+  return best;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    std::fprintf(stderr, "Usage: %s <classes> <statements>\n", argv[0]);
+    return 1;
+  }
+  const size_t classesCount = std::strtoul(argv[1], nullptr, 10);
+  const size_t statementsCount = std::strtoul(argv[2], nullptr, 10);
+
+  /// Analyze the class hierarchy and the class signatures
+  auto program = MakeProgram(classesCount, statementsCount);
+  auto prelude = Prelude::Get();
+  auto registry = prelude->makeClassRegistry();
+  auto context = prelude->makeAnalysisContext(registry, nullptr);
+  ClassesDefinitionPass definitionPass;
+  ClassesImplementationPass implementationPass;
+  for (Pass *pass : {static_cast<Pass *>(&definitionPass),
+                     static_cast<Pass *>(&implementationPass)}) {
+    if (!pass->visit(context.get(), program.get()).isOk()) {
+      std::fprintf(stderr, "Invalid program\n");
+      return 1;
+    }
+  }
+
+  /// Symbol table accesses by class name and by class ID
+  std::vector<Symbol> classNames;
+  std::vector<IdentifierType> classIDs;
+  for (const auto &classNode : program->classes()) {
+    classNames.push_back(classNode->className());
+    classIDs.push_back(registry->typeID(classNode->className()));
+  }
+
+  uintptr_t nameChecksum = 0;
+  const double nameTime = MeasureMinimum([&]() {
+    for (size_t i = 0, j = 0; i < ACCESSES_COUNT; ++i) {
+      const auto *table = context->symbolTable(classNames[j]);
+      nameChecksum += reinterpret_cast<uintptr_t>(table);
+      j = j + 1 < classNames.size() ? j + 1 : 0;
+    }
+  });
+
+  uintptr_t idChecksum = 0;
+  const double idTime = MeasureMinimum([&]() {
+    for (size_t i = 0, j = 0; i < ACCESSES_COUNT; ++i) {
+      const auto *table = context->symbolTable(classIDs[j]);
+      idChecksum += reinterpret_cast<uintptr_t>(table);
+      j = j + 1 < classIDs.size() ? j + 1 : 0;
+    }
+  });
+
+  if (nameChecksum != idChecksum) {
+    std::fprintf(stderr, "Mismatch in symbol tables\n");
+    return 1;
+  }
+
+  std::printf("Symbol table accesses\n");
+  std::printf("%10s %18s %18s %10s\n", "classes", "by name (ns)",
+              "by ID (ns)", "speedup");
+  std::printf("%10zu %18.2f %18.2f %9.1fx\n", classNames.size(),
+              nameTime / ACCESSES_COUNT, idTime / ACCESSES_COUNT,
+              nameTime / idTime);
+
+  /// Type-check of the whole program
+  TypeCheckPass typeCheckPass;
+  bool isOk = true;
+  const double typeCheckTime = MeasureMinimum([&]() {
+    isOk &= typeCheckPass.visit(context.get(), program.get()).isOk();
+  });
+
+  if (!isOk) {
+    std::fprintf(stderr, "Type-check failed\n");
+    return 1;
+  }
+
+  const size_t totalStatements = classesCount * statementsCount;
+  std::printf("\nType-check\n");
+  std::printf("%10s %12s %18s %18s\n", "classes", "statements", "total (ms)",
+              "statement (ns)");
+  std::printf("%10zu %12zu %18.2f %18.2f\n", classesCount, totalStatements,
+              typeCheckTime / 1e6,
+              typeCheckTime / std::max<size_t>(totalStatements, 1));
+  return 0;
+}
@@ -0,0 +1,169 @@
+#include <cool/core/class_registry.h>
+#include <cool/ir/class.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace cool;
+
+namespace {
+
+/// Total number of inheritance chain steps per measurement. The number of
+/// queries is scaled with the chain depth to bound the chain walk time
+constexpr size_t CHAIN_STEPS_COUNT = 10000000;
+
+/// Helper function to create a registry whose classes form a single chain
+///
+/// \param[in] depth depth of the inheritance chain
+/// \return a registry with depth + 1 classes
+std::unique_ptr<ClassRegistry> MakeChainRegistry(const size_t depth) {
+  auto registry = std::make_unique<ClassRegistry>();
+  std::vector<GenericAttributeNodePtr> attributes;
+  std::string parentName;
+  for (size_t i = 0; i <= depth; ++i) {
+    const std::string className = "C" + std::to_string(i);
+    registry->addClass(ClassNode::MakeClassNode(className, parentName,
+                                                attributes, false, 0));
+    parentName = className;
+  }
+  return registry;
+}
+
+/// Helper function to generate random pairs of class types
+///
+/// \param[in] classesCount number of classes in the registry
+/// \param[in] queriesCount number of pairs to generate
+/// \return a vector of pairs of class types
+std::vector<std::pair<ExprType, ExprType>>
+MakeQueries(const size_t classesCount, const size_t queriesCount) {
+  std::vector<std::pair<ExprType, ExprType>> queries;
+  queries.reserve(queriesCount);
+
+  uint64_t state = 88172645463325252ull;
+  auto next = [&state, classesCount]() {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return static_cast<IdentifierType>(state % classesCount);
+  };
+
+  for (size_t i = 0; i < queriesCount; ++i) {
+    ExprType childType{.typeID = next(), .isSelf = false};
+    ExprType parentType{.typeID = next(), .isSelf = false};
+    queries.emplace_back(childType, parentType);
+  }
+  return queries;
+}
+
+/// Helper function to measure the average time of a subtype check
+///
+/// \param[in] registry class registry
+/// \param[in] queries pairs of types to check
+/// \param[out] conforming number of conforming pairs
+/// \return the average time per query in nanoseconds
+double
+MeasureConformTo(const ClassRegistry &registry,
+                 const std::vector<std::pair<ExprType, ExprType>> &queries,
+                 size_t *conforming) {
+  auto start = std::chrono::steady_clock::now();
+  size_t count = 0;
+  for (auto &query : queries) {
+    count += registry.conformTo(query.first, query.second);
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  *conforming = count;
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  return elapsed.count() / queries.size();
+}
+
+/// Helper function to measure the average time of a least common ancestor
+/// query
+///
+/// \param[in] registry class registry
+/// \param[in] queries pairs of types to query
+/// \param[out] checksum sum of the ancestors IDs
+/// \return the average time per query in nanoseconds
+double MeasureLeastCommonAncestor(
+    const ClassRegistry &registry,
+    const std::vector<std::pair<ExprType, ExprType>> &queries,
+    int64_t *checksum) {
+  auto start = std::chrono::steady_clock::now();
+  int64_t sum = 0;
+  for (auto &query : queries) {
+    sum += registry.leastCommonAncestor(query.first, query.second).typeID;
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  *checksum = sum;
+  std::chrono::duration<double, std::nano> elapsed = end - start;
+  return elapsed.count() / queries.size();
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::printf("Subtype checks\n");
+  std::printf("%10s %10s %18s %18s %10s\n", "depth", "queries",
+              "chain walk (ns)", "interval (ns)", "speedup");
+
+  for (size_t depth : {10, 100, 1000, 10000}) {
+    auto registry = MakeChainRegistry(depth);
+    const size_t queriesCount = CHAIN_STEPS_COUNT / depth;
+    auto queries = MakeQueries(registry->size(), queriesCount);
+
+    /// Registry not frozen yet, conformTo walks the inheritance chain
+    size_t walkConforming = 0;
+    const double walkTime =
+        MeasureConformTo(*registry, queries, &walkConforming);
+
+    /// Frozen registry, conformTo uses the preorder intervals
+    size_t intervalConforming = 0;
+    registry->freeze();
+    const double intervalTime =
+        MeasureConformTo(*registry, queries, &intervalConforming);
+
+    if (walkConforming != intervalConforming) {
+      std::fprintf(stderr, "Mismatch in conformTo results at depth %zu\n",
+                   depth);
+      return 1;
+    }
+
+    std::printf("%10zu %10zu %18.2f %18.2f %9.1fx\n", depth, queriesCount,
+                walkTime, intervalTime, walkTime / intervalTime);
+  }
+
+  std::printf("\nLeast common ancestor queries\n");
+  std::printf("%10s %10s %18s %18s %10s\n", "depth", "queries",
+              "chain walk (ns)", "euler tour (ns)", "speedup");
+
+  for (size_t depth : {10, 100, 1000, 10000}) {
+    auto registry = MakeChainRegistry(depth);
+    const size_t queriesCount = CHAIN_STEPS_COUNT / depth;
+    auto queries = MakeQueries(registry->size(), queriesCount);
+
+    /// Registry not frozen yet, ancestors are found walking the chains
+    int64_t walkChecksum = 0;
+    const double walkTime =
+        MeasureLeastCommonAncestor(*registry, queries, &walkChecksum);
+
+    /// Frozen registry, ancestors are found with a range minimum query
+    int64_t eulerChecksum = 0;
+    registry->freeze();
+    const double eulerTime =
+        MeasureLeastCommonAncestor(*registry, queries, &eulerChecksum);
+
+    if (walkChecksum != eulerChecksum) {
+      std::fprintf(stderr, "Mismatch in ancestors at depth %zu\n", depth);
+      return 1;
+    }
+
+    std::printf("%10zu %10zu %18.2f %18.2f %9.1fx\n", depth, queriesCount,
+                walkTime, eulerTime, walkTime / eulerTime);
+  }
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+#include <cool/frontend/parser.h>
+#include <cool/ir/class.h>
+#include <cool/ir/node_arena.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+
+using namespace cool;
+
+namespace {
+
+/// Heap usage counters, updated by the global allocation functions below
+size_t sAllocationsCount = 0;
+size_t sLiveBytes = 0;
+size_t sPeakBytes = 0;
+
+/// Size of the header that stores the size of each allocation
+constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+
+/// Number of times each measurement is repeated
+constexpr size_t REPETITIONS_COUNT = 5;
+
+/// Statistics of a parse of the corpus
+struct ParseStats {
+  double parseTime = 0.0;
+  double releaseTime = 0.0;
+  size_t allocationsCount = 0;
+  size_t peakBytes = 0;
+};
+
+/// Helper function to read the content of a file
+///
+/// \param[in] filePath path to the file
+/// \return the content of the file
+std::string ReadFile(const std::string &filePath) {
+  std::ifstream ifs(filePath);
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  return ss.str();
+}
+
+/// Helper function to parse the corpus and release the program
+///
+/// \param[in] corpus program text
+/// \param[in] useNodeArena true to allocate the nodes in an arena
+/// \return the parse statistics
+ParseStats ParseCorpus(const std::string &corpus, const bool useNodeArena) {
+  ParseStats stats;
+  const size_t baseBytes = sLiveBytes;
+  const size_t baseAllocations = sAllocationsCount;
+  sPeakBytes = sLiveBytes;
+
+  auto parser = std::make_unique<Parser>(Parser::MakeFromString(corpus));
+  parser->useNodeArena(useNodeArena);
+
+  auto start = std::chrono::steady_clock::now();
+  auto program = parser->parse();
+  auto end = std::chrono::steady_clock::now();
+  if (!program) {
+    std::fprintf(stderr, "Error: corpus could not be parsed\n");
+    std::exit(1);
+  }
+
+  stats.allocationsCount = sAllocationsCount - baseAllocations;
+  stats.peakBytes = sPeakBytes - baseBytes;
+  stats.parseTime =
+      std::chrono::duration<double, std::milli>(end - start).count();
+
+  /// Release the program. The arena, if any, is shared with the parser
+  start = std::chrono::steady_clock::now();
+  program.reset();
+  parser.reset();
+  end = std::chrono::steady_clock::now();
+  stats.releaseTime =
+      std::chrono::duration<double, std::milli>(end - start).count();
+  return stats;
+}
+
+} // namespace
+
+void *operator new(size_t size) {
+  char *memory = static_cast<char *>(std::malloc(size + HEADER_SIZE));
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  *reinterpret_cast<size_t *>(memory) = size;
+  sAllocationsCount += 1;
+  sLiveBytes += size;
+  sPeakBytes = std::max(sPeakBytes, sLiveBytes);
+  return memory + HEADER_SIZE;
+}
+
+void operator delete(void *memory) noexcept {
+  if (memory == nullptr) {
+    return;
+  }
+  char *block = static_cast<char *>(memory) - HEADER_SIZE;
+  sLiveBytes -= *reinterpret_cast<size_t *>(block);
+  std::free(block);
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::fprintf(stderr, "Usage: %s <scale> <file.cl>...\n", argv[0]);
+    return 1;
+  }
+
+  /// Assemble the corpus by replicating the input files
+  const size_t scale = std::strtoul(argv[1], nullptr, 10);
+  std::string files;
+  for (int i = 2; i < argc; ++i) {
+    files += ReadFile(argv[i]);
+    files += "\n";
+  }
+
+  std::string corpus;
+  corpus.reserve(files.size() * scale);
+  for (size_t i = 0; i < scale; ++i) {
+    corpus += files;
+  }
+
+  std::printf("Corpus: %d files x %zu, %zu bytes\n\n", argc - 2, scale,
+              corpus.size());
+  std::printf("%8s %12s %12s %14s %14s\n", "nodes", "parse (ms)",
+              "free (ms)", "allocations", "peak (KiB)");
+
+  for (bool useNodeArena : {false, true}) {
+    ParseStats best;
+    for (size_t i = 0; i < REPETITIONS_COUNT; ++i) {
+      auto stats = ParseCorpus(corpus, useNodeArena);
+      if (i == 0 || stats.parseTime < best.parseTime) {
+        best.parseTime = stats.parseTime;
+      }
+      if (i == 0 || stats.releaseTime < best.releaseTime) {
+        best.releaseTime = stats.releaseTime;
+      }
+      best.allocationsCount = stats.allocationsCount;
+      best.peakBytes = stats.peakBytes;
+    }
+
+    std::printf("%8s %12.2f %12.2f %14zu %14zu\n",
+                useNodeArena ? "arena" : "heap", best.parseTime,
+                best.releaseTime, best.allocationsCount,
+                best.peakBytes / 1024);
+  }
+
+  return 0;
+}
@@ -0,0 +1,126 @@
+#include <cool/core/thread_pool.h>
+#include <cool/frontend/chunked_parser.h>
+#include <cool/frontend/parser.h>
+#include <cool/ir/class.h>
+#include <cool/ir/node_arena.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace cool;
+
+namespace {
+
+/// Number of times each measurement is repeated
+constexpr size_t REPETITIONS_COUNT = 5;
+
+/// Helper function to generate a synthetic program
+///
+/// Each class defines a few attributes and a method whose body is a long
+/// block, so that the program exercises both long lists and deep expressions
+///
+/// \param[in] classesCount number of classes in the program
+/// \param[in] statementsCount number of statements in each method body
+/// \return the program text
+std::string MakeProgram(const size_t classesCount,
+                        const size_t statementsCount) {
+  std::string program;
+  for (size_t i = 0; i < classesCount; ++i) {
+    program += "class C" + std::to_string(i) + " inherits IO {\n";
+    program += "  count : Int <- 0;\n";
+    program += "  name : String <- \"class " + std::to_string(i) + "\";\n";
+    program += "  run(n : Int, s : String) : Int {\n    {\n";
+    for (size_t j = 0; j < statementsCount; ++j) {
+      switch (j % 4) {
+      case 0:
+        program += "      count <- count + n * (count - 1) / 2;\n";
+        break;
+      case 1:
+        program += "      if count < n then out_string(s) else "
+                   "out_int(count) fi;\n";
+        break;
+      case 2:
+        program += "      let x : Int <- n, y : Int <- ~x in "
+                   "while x <= y loop x <- x + 1 pool;\n";
+        break;
+      default:
+        program += "      case s of a : String => a.length(); "
+                   "o : Object => 0; esac;\n";
+        break;
+      }
+    }
+    program += "      count;\n    }\n  };\n};\n\n";
+  }
+  return program;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::fprintf(stderr, "Usage: %s <classes> <statements> [threads]\n",
+                 argv[0]);
+    return 1;
+  }
+
+  const size_t classesCount = std::strtoul(argv[1], nullptr, 10);
+  const size_t statementsCount = std::strtoul(argv[2], nullptr, 10);
+  const size_t threadsCount =
+      argc > 3 ? std::strtoul(argv[3], nullptr, 10)
+               : ThreadPool::DefaultThreadsCount();
+  const std::string program = MakeProgram(classesCount, statementsCount);
+
+  double best = 0.0;
+  size_t nodesCount = 0;
+  for (size_t i = 0; i < REPETITIONS_COUNT; ++i) {
+    auto parser = Parser::MakeFromString(program);
+
+    auto start = std::chrono::steady_clock::now();
+    auto programNode = parser.parse();
+    auto end = std::chrono::steady_clock::now();
+    if (!programNode) {
+      std::fprintf(stderr, "Error: program could not be parsed\n");
+      return 1;
+    }
+
+    const double time =
+        std::chrono::duration<double, std::milli>(end - start).count();
+    if (i == 0 || time < best) {
+      best = time;
+    }
+    nodesCount = programNode->nodeArena()->nodesCount();
+  }
+
+  /// The chunked parse time includes splitting the program text
+  ThreadPool pool(threadsCount);
+  double bestChunked = 0.0;
+  size_t chunksCount = 0;
+  for (size_t i = 0; i < REPETITIONS_COUNT; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    auto parser = ChunkedParser::MakeFromString(program);
+    auto programNode = parser.parse(&pool);
+    auto end = std::chrono::steady_clock::now();
+    if (!programNode) {
+      std::fprintf(stderr, "Error: program could not be parsed\n");
+      return 1;
+    }
+
+    const double time =
+        std::chrono::duration<double, std::milli>(end - start).count();
+    if (i == 0 || time < bestChunked) {
+      bestChunked = time;
+    }
+    chunksCount = parser.chunksCount();
+  }
+
+  std::printf("Program: %zu bytes, %zu nodes\n", program.size(), nodesCount);
+  std::printf("Parse: %.2f ms, %.2f MiB/s, %.2f Mnodes/s\n", best,
+              program.size() / (1024.0 * 1024.0) / (best / 1000.0),
+              nodesCount / 1e6 / (best / 1000.0));
+  std::printf("Chunked parse (%zu chunks, %zu threads): %.2f ms, %.2f MiB/s\n",
+              chunksCount, threadsCount, bestChunked,
+              program.size() / (1024.0 * 1024.0) / (bestChunked / 1000.0));
+  return 0;
+}
@@ -0,0 +1,133 @@
+#include <cool/frontend/scanner_state.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace cool;
+
+namespace {
+
+/// Number of times each measurement is repeated
+constexpr size_t REPETITIONS_COUNT = 5;
+
+/// Path of the temporary file that stores the corpus
+const char *CORPUS_PATH = "bench_scanner_input.cl";
+
+/// Helper function to read the content of a file
+///
+/// \param[in] filePath path to the file
+/// \return the content of the file
+std::string ReadFile(const std::string &filePath) {
+  std::ifstream ifs(filePath);
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  return ss.str();
+}
+
+/// Helper function to scan the input until the end of file
+///
+/// \param[in] makeState function that creates the scanner state
+/// \param[in] useFastScanner true to scan with the hand-written scanner
+/// \return the best scan time in milliseconds, including the creation of the
+/// scanner state
+double ScanInput(std::function<std::unique_ptr<ScannerState>()> makeState,
+                 const bool useFastScanner = false) {
+  double best = 0.0;
+  for (size_t i = 0; i < REPETITIONS_COUNT; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    auto state = makeState();
+    state->useFastScanner(useFastScanner);
+
+    YYSTYPE yylval;
+    YYLTYPE yylloc = 0;
+    size_t tokensCount = 0;
+    while (yylex(&yylval, &yylloc, nullptr, state->scannerState()) != 0) {
+      ++tokensCount;
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (tokensCount == 0) {
+      std::fprintf(stderr, "Error: no tokens scanned\n");
+      std::exit(1);
+    }
+
+    const double time =
+        std::chrono::duration<double, std::milli>(end - start).count();
+    if (i == 0 || time < best) {
+      best = time;
+    }
+  }
+  return best;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::fprintf(stderr, "Usage: %s <scale> <file.cl>...\n", argv[0]);
+    return 1;
+  }
+
+  /// Assemble the corpus by replicating the input files
+  const size_t scale = std::strtoul(argv[1], nullptr, 10);
+  std::string files;
+  for (int i = 2; i < argc; ++i) {
+    files += ReadFile(argv[i]);
+    files += "\n";
+  }
+
+  std::string corpus;
+  corpus.reserve(files.size() * scale);
+  for (size_t i = 0; i < scale; ++i) {
+    corpus += files;
+  }
+  std::ofstream(CORPUS_PATH) << corpus;
+
+  std::printf("Corpus: %zu bytes\n\n", corpus.size());
+  std::printf("%12s %12s %12s\n", "input", "scan (ms)", "MiB/s");
+
+  auto report = [&corpus](const char *input, const double time) {
+    std::printf("%12s %12.2f %12.2f\n", input, time,
+                corpus.size() / (1024.0 * 1024.0) / (time / 1000.0));
+  };
+
+  report("file", ScanInput([]() {
+           return ScannerState::MakeFromFile(CORPUS_PATH);
+         }));
+  report("string", ScanInput([&corpus]() {
+           return ScannerState::MakeFromString(corpus);
+         }));
+  report("mapped", ScanInput([]() {
+           return ScannerState::MakeFromMappedFile(CORPUS_PATH);
+         }));
+
+  /// The buffer is scanned in place and must be terminated by sentinel bytes
+  std::vector<char> buffer(corpus.begin(), corpus.end());
+  buffer.resize(buffer.size() + ScannerState::SENTINEL_SIZE, '\0');
+  report("buffer", ScanInput([&buffer]() {
+           return ScannerState::MakeFromBuffer(buffer.data(), buffer.size());
+         }));
+
+  /// Hand-written scanner on the memory-mapped file and on the buffer
+  report("fast mapped", ScanInput(
+                            []() {
+                              return ScannerState::MakeFromMappedFile(
+                                  CORPUS_PATH);
+                            },
+                            true));
+  report("fast buffer", ScanInput(
+                            [&buffer]() {
+                              return ScannerState::MakeFromBuffer(
+                                  buffer.data(), buffer.size());
+                            },
+                            true));
+
+  std::remove(CORPUS_PATH);
+  return 0;
+}
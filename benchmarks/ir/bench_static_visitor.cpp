@@ -0,0 +1,155 @@
+#include <cool/analysis/pass.h>
+#include <cool/ir/expr.h>
+#include <cool/ir/node_arena.h>
+#include <cool/ir/static_visitor.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace cool;
+
+namespace {
+
+/// Number of times each measurement is repeated
+constexpr size_t REPETITIONS_COUNT = 10;
+
+/// Pass that counts the literals of an expression tree through double dispatch
+class VirtualCounter : public Pass {
+
+public:
+  using Pass::visit;
+
+  Status visit(AnalysisContext *context,
+               BinaryExprNode<ArithmeticOpID> *node) override {
+    node->lhsExpr()->visitNode(context, this);
+    node->rhsExpr()->visitNode(context, this);
+    return Status::Ok();
+  }
+
+  Status visit(AnalysisContext *context, BlockExprNode *node) override {
+    for (const auto &expr : node->exprs()) {
+      expr->visitNode(context, this);
+    }
+    return Status::Ok();
+  }
+
+  Status visit(AnalysisContext *context,
+               LiteralExprNode<int32_t> *node) override {
+    count_ += node->value();
+    return Status::Ok();
+  }
+
+  int64_t count() const { return count_; }
+
+private:
+  int64_t count_ = 0;
+};
+
+/// Visitor that counts the literals of an expression tree through a switch
+class StaticCounter : public StaticVisitor<StaticCounter> {
+
+public:
+  template <typename NodeT> Status apply(NodeT *node) { return Status::Ok(); }
+
+  Status apply(BinaryExprNode<ArithmeticOpID> *node) {
+    dispatch(node->lhsExpr());
+    dispatch(node->rhsExpr());
+    return Status::Ok();
+  }
+
+  Status apply(BlockExprNode *node) {
+    for (const auto &expr : node->exprs()) {
+      dispatch(expr.get());
+    }
+    return Status::Ok();
+  }
+
+  Status apply(LiteralExprNode<int32_t> *node) {
+    count_ += node->value();
+    return Status::Ok();
+  }
+
+  int64_t count() const { return count_; }
+
+private:
+  int64_t count_ = 0;
+};
+
+/// Helper function to build a balanced tree of additions
+///
+/// \param[in] depth depth of the tree
+/// \param[in] arena arena where the nodes are allocated
+/// \return the root of the tree
+ExprNodePtr MakeTree(const size_t depth, NodeArena *arena) {
+  if (depth == 0) {
+    return LiteralExprNode<int32_t>::MakeLiteralExprNode(1, 0, arena);
+  }
+  return BinaryExprNode<ArithmeticOpID>::MakeBinaryExprNode(
+      MakeTree(depth - 1, arena), MakeTree(depth - 1, arena),
+      ArithmeticOpID::Plus, 0, arena);
+}
+
+/// Helper function to time the traversal of a tree
+///
+/// \param[in] traverse traversal function, returns the literals count
+/// \return the best traversal time in milliseconds
+template <typename TraverseT> double TimeTraversal(TraverseT traverse) {
+  double best = 0.0;
+  for (size_t i = 0; i < REPETITIONS_COUNT; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    const int64_t count = traverse();
+    auto end = std::chrono::steady_clock::now();
+    if (count <= 0) {
+      std::fprintf(stderr, "Error: unexpected literals count\n");
+      std::exit(1);
+    }
+
+    const double time =
+        std::chrono::duration<double, std::milli>(end - start).count();
+    if (i == 0 || time < best) {
+      best = time;
+    }
+  }
+  return best;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::fprintf(stderr, "Usage: %s <depth> <trees>\n", argv[0]);
+    return 1;
+  }
+
+  /// Build a block of balanced addition trees
+  const size_t depth = std::strtoul(argv[1], nullptr, 10);
+  const size_t treesCount = std::strtoul(argv[2], nullptr, 10);
+  NodeArena arena;
+  std::vector<ExprNodePtr> trees;
+  for (size_t i = 0; i < treesCount; ++i) {
+    trees.push_back(MakeTree(depth, &arena));
+  }
+  auto block =
+      BlockExprNode::MakeBlockExprNode(std::move(trees), 0, &arena);
+  std::printf("Nodes: %zu\n\n", arena.nodesCount());
+  std::printf("%10s %12s\n", "dispatch", "time (ms)");
+
+  const double virtualTime = TimeTraversal([&block]() {
+    VirtualCounter counter;
+    block->visitNode(nullptr, &counter);
+    return counter.count();
+  });
+  std::printf("%10s %12.2f\n", "virtual", virtualTime);
+
+  const double staticTime = TimeTraversal([&block]() {
+    StaticCounter counter;
+    counter.dispatch(block.get());
+    return counter.count();
+  });
+  std::printf("%10s %12.2f\n", "static", staticTime);
+
+  return 0;
+}
@@ -3,12 +3,16 @@
 
 #include <cool/analysis/method_record.h>
 #include <cool/core/context.h>
+#include <cool/core/flat_symbol_table.h>
 #include <cool/core/symbol_table.h>
 
+#include <unordered_set>
+
 namespace cool {
 
-class AnalysisContext : public Context<SymbolTable<std::string, ExprType>,
-                                       SymbolTable<std::string, MethodRecord>> {
+class AnalysisContext
+    : public Context<FlatSymbolTable<Symbol, ExprType>,
+                     SymbolTable<Symbol, MethodRecord>> {
 
 public:
   AnalysisContext() = delete;
@@ -18,6 +22,35 @@ public:
   AnalysisContext(std::shared_ptr<ClassRegistry> classRegistry,
                   std::shared_ptr<LoggerCollection> logger)
       : Context(classRegistry, logger) {}
+
+  /// Create a context layered on top of a base context, see Context
+  ///
+  /// \param[in] base base context
+  /// \param[in] logger loggers collection of the new context
+  AnalysisContext(const AnalysisContext &base,
+                  std::shared_ptr<LoggerCollection> logger)
+      : Context(base, logger) {}
+
+  /// Record that the analysis of the current class depends on the signature
+  /// of another class, if dependencies are being recorded
+  ///
+  /// \param[in] typeID type ID of the class depended upon
+  void addDependency(const IdentifierType typeID) {
+    if (dependencies_) {
+      dependencies_->insert(typeID);
+    }
+  }
+
+  /// Set the set of type IDs where the dependencies of the current class are
+  /// recorded
+  ///
+  /// \param[in] dependencies set of type IDs, nullptr to stop recording
+  void setDependencies(std::unordered_set<IdentifierType> *dependencies) {
+    dependencies_ = dependencies;
+  }
+
+private:
+  std::unordered_set<IdentifierType> *dependencies_ = nullptr;
 };
 
 } // namespace cool
@@ -0,0 +1,106 @@
+#ifndef COOL_ANALYSIS_ANALYSIS_SESSION_H
+#define COOL_ANALYSIS_ANALYSIS_SESSION_H
+
+#include <cool/core/status.h>
+#include <cool/ir/common.h>
+#include <cool/ir/fwd.h>
+#include <cool/ir/symbol.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cool {
+
+/// Forward declarations
+class AnalysisContext;
+class ClassRegistry;
+class LoggerCollection;
+class Prelude;
+
+/// \brief Class that analyzes successive versions of a program, type-checking
+/// again only the classes that changed and the classes that depend on them
+///
+/// The class definition and the class implementation passes only process the
+/// class signatures, and run on the whole program each time. The type-check
+/// pass is run per class. While a class is type-checked, the classes whose
+/// signatures it depends on are recorded: its parent class, the dispatch
+/// classes whose method tables are searched, and the types of its new, let and
+/// case expressions. The ancestors of these classes are dependencies too.
+///
+/// A class that type-checked in the previous version is not type-checked again
+/// if its text, ignoring locations, is unchanged, and if the signatures of all
+/// its dependencies are unchanged. The expression types of the previous
+/// version are then copied to the new nodes. Since conformance depends on the
+/// whole class hierarchy, every class is type-checked again if a class of the
+/// previous version is removed or changes parent. New classes do not affect
+/// the other classes. The names of every class that type-checks are resolved
+/// again, since they are cheap to resolve and attribute positions may move
+class AnalysisSession {
+
+public:
+  AnalysisSession() = delete;
+
+  /// \brief Constructor
+  ///
+  /// \param[in] logger loggers collection, can be nullptr
+  explicit AnalysisSession(std::shared_ptr<LoggerCollection> logger);
+
+  /// \brief Analyze a new version of the program
+  ///
+  /// \param[in] program program node, which is not analyzed yet
+  /// \return Status::Ok() if successful, an error otherwise
+  Status analyze(ProgramNodePtr program);
+
+  /// \brief Return the class registry of the last analyzed program
+  ///
+  /// \return a shared pointer to the class registry
+  std::shared_ptr<ClassRegistry> classRegistry() const { return registry_; }
+
+  /// \brief Return the names of the classes type-checked by the last analysis
+  ///
+  /// \return the names of the classes, in the order of the program
+  const std::vector<Symbol> &checkedClasses() const { return checkedClasses_; }
+
+private:
+  /// Analysis results of a class
+  struct ClassState {
+    ClassNodePtr node;
+    Symbol parentClassName;
+    std::string fingerprint;
+    std::string signature;
+    std::vector<Symbol> dependencies;
+    bool typeCheckOk = false;
+  };
+
+  /// \brief Check whether the type-check results of a class can be reused
+  ///
+  /// \param[in] state previous results of the class
+  /// \param[in] fingerprint new fingerprint of the class
+  /// \param[in] signatures new signatures of all the classes, by class name
+  /// \return true if the results can be reused, false otherwise
+  bool canReuse(const ClassState &state, const std::string &fingerprint,
+                const std::unordered_map<Symbol, std::string> &signatures)
+      const;
+
+  /// \brief Copy the expression types of the previous version of a class
+  ///
+  /// \param[in] state previous results of the class
+  /// \param[in] registry class registry of the new version
+  /// \param[in] node new class node
+  void copyTypes(const ClassState &state, const ClassRegistry &registry,
+                 ClassNode *node) const;
+
+  std::shared_ptr<const Prelude> prelude_;
+  std::shared_ptr<LoggerCollection> logger_;
+
+  std::shared_ptr<ClassRegistry> registry_;
+  std::unordered_map<Symbol, ClassState> states_;
+  std::unordered_map<Symbol, std::string> signatures_;
+  std::vector<Symbol> checkedClasses_;
+};
+
+} // namespace cool
+
+#endif
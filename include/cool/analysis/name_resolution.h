@@ -0,0 +1,34 @@
+#ifndef COOL_ANALYSIS_NAME_RESOLUTION_H
+#define COOL_ANALYSIS_NAME_RESOLUTION_H
+
+#include <cool/analysis/pass.h>
+
+namespace cool {
+
+/// Class that implements the name resolution pass
+///
+/// The pass records on the nodes the storage of the variables and the slots of
+/// the methods, so that the later passes do not need to look them up by name:
+/// identifiers and assignments are bound to self, to an attribute position in
+/// the object, to an argument position in the stack frame or to a let or case
+/// variable, and dispatch expressions are given the slot of their method in
+/// the dispatch table. The let and case variables are numbered in the order in
+/// which they are introduced within each method and attribute initializer.
+///
+/// The pass must run after TypeCheckPass, since the slots of the dynamic
+/// dispatch expressions depend on the types of their receivers, and the class
+/// layout must be set in the class registry. It reports no errors
+class NameResolutionPass : public Pass {
+
+public:
+  NameResolutionPass() = default;
+  ~NameResolutionPass() final override = default;
+
+  Status visit(AnalysisContext *context, ClassNode *node) final override;
+
+  Status visit(AnalysisContext *context, ProgramNode *node) final override;
+};
+
+} // namespace cool
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef COOL_ANALYSIS_PARALLEL_TYPE_CHECK_H
+#define COOL_ANALYSIS_PARALLEL_TYPE_CHECK_H
+
+#include <cool/analysis/pass.h>
+
+#include <cstdlib>
+
+namespace cool {
+
+/// Class that implements the type-check pass of TypeCheckPass, with the
+/// classes of the program type-checked concurrently on a thread pool
+///
+/// The class registry must be frozen and the class tables complete, as they
+/// are after ClassesImplementationPass. Both are then only read. Each class is
+/// type-checked in its own context, layered on top of the program context, in
+/// which the symbol table of the class is an overlay of the class table: the
+/// scopes of the methods, let and case expressions are entered in the overlay,
+/// so that the shared tables are not modified. The diagnostics of each class
+/// are buffered and replayed in the order of the classes in the program, so
+/// that the output is the same as that of TypeCheckPass
+class ParallelTypeCheckPass : public Pass {
+
+public:
+  ParallelTypeCheckPass() = delete;
+
+  /// \brief Constructor
+  ///
+  /// \param[in] threadsCount number of worker threads, at least one
+  explicit ParallelTypeCheckPass(const size_t threadsCount)
+      : threadsCount_(threadsCount) {}
+
+  ~ParallelTypeCheckPass() final override = default;
+
+  Status visit(AnalysisContext *context, ProgramNode *node) final override;
+
+private:
+  size_t threadsCount_;
+};
+
+} // namespace cool
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef COOL_ANALYSIS_PRELUDE_H
+#define COOL_ANALYSIS_PRELUDE_H
+
+#include <cool/analysis/analysis_context.h>
+
+#include <memory>
+
+namespace cool {
+
+/// Forward declarations
+class ClassRegistry;
+class LoggerCollection;
+
+/// \brief Class that holds the built-in classes, registered and analyzed once
+/// and shared by all compilations
+///
+/// The prelude registers the built-in classes returned by
+/// ProgramNode::BuiltInClasses and builds their symbol and method tables.
+/// Each compilation starts from a class registry that contains the built-in
+/// classes, and from an analysis context that shares their tables, so that
+/// the semantic analysis passes only process the classes of the program. The
+/// prelude is immutable once built and can be shared across threads
+class Prelude {
+
+public:
+  Prelude(const Prelude &) = delete;
+  Prelude &operator=(const Prelude &) = delete;
+
+  ~Prelude() = default;
+
+  /// \brief Return the prelude, built on first use
+  ///
+  /// \return a shared pointer to the prelude
+  static std::shared_ptr<const Prelude> Get();
+
+  /// \brief Create a class registry that contains the built-in classes, with
+  /// the same IDs they have in the prelude
+  ///
+  /// \return a shared pointer to the new class registry
+  std::shared_ptr<ClassRegistry> makeClassRegistry() const;
+
+  /// \brief Create an analysis context that shares the symbol and method
+  /// tables of the built-in classes
+  ///
+  /// \warning The class registry must have been created by makeClassRegistry
+  ///
+  /// \param[in] classRegistry class registry of the compilation
+  /// \param[in] logger loggers collection, can be nullptr
+  /// \return a unique pointer to the new analysis context
+  std::unique_ptr<AnalysisContext>
+  makeAnalysisContext(std::shared_ptr<ClassRegistry> classRegistry,
+                      std::shared_ptr<LoggerCollection> logger) const;
+
+private:
+  Prelude();
+
+  std::shared_ptr<ClassRegistry> classRegistry_;
+  std::unique_ptr<AnalysisContext> context_;
+};
+
+} // namespace cool
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <cool/analysis/pass.h>
 #include <cool/ir/fwd.h>
+#include <cool/ir/static_visitor.h>
 
 #include <cstdlib>
 #include <string>
@@ -14,13 +15,15 @@ class AnalysisContext;
 
 /// Class that implements a type-check pass over the abstract syntax tree. This
 /// pass will infer and type-check the type of each expression in the input
-/// program
-class TypeCheckPass : public Pass {
+/// program. Children nodes are visited through StaticVisitor::dispatch
+class TypeCheckPass : public Pass, public StaticVisitor<TypeCheckPass> {
 
 public:
   TypeCheckPass() = default;
   ~TypeCheckPass() final override = default;
 
+  using Pass::visit;
+
   Status visit(AnalysisContext *context,
                AssignmentExprNode *node) final override;
 
@@ -72,6 +75,18 @@ public:
   Status visit(AnalysisContext *context, WhileExprNode *node) final override;
 
 private:
+  friend class StaticVisitor<TypeCheckPass>;
+
+  /// Handler invoked by StaticVisitor::dispatch
+  ///
+  /// \param[in] node node to type-check
+  /// \param[in] context type-checking context
+  /// \return Status::Ok() if type-check succeds, an error message otherwise
+  template <typename NodeT>
+  Status apply(NodeT *node, AnalysisContext *context) {
+    return visit(context, node);
+  }
+
   /// Implement type-checking rule for binary expressions
   ///
   /// \param[in] context type-checking context
@@ -108,7 +123,7 @@ private:
   /// \param[in] expectedType expected type of unary expression operand
   /// \return Status::Ok() if type-check succeds, an error message otherwise
   Status visitNotOrCompExpr(AnalysisContext *context, UnaryExprNode *node,
-                            const std::string &expectedType);
+                            const ExprType &expectedType);
 };
 
 } // namespace cool
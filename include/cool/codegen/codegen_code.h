@@ -19,6 +19,22 @@ public:
 
   Status codegen(CodegenContext *context, ProgramNode *node,
                  std::ostream *ios) final override;
+
+  /// \brief Generate the heap start label, which must follow all the other
+  /// labels of the data segment
+  ///
+  /// \param[in] context Codegen context
+  /// \param[out] ios output stream
+  /// \return Status::Ok()
+  Status codegenHeapStart(CodegenContext *context, std::ostream *ios);
+
+  /// \brief Generate the header of the text segment: the text directive and
+  /// the global declarations. The code of the classes is not generated
+  ///
+  /// \param[in] context Codegen context
+  /// \param[out] ios output stream
+  /// \return Status::Ok()
+  Status codegenHeader(CodegenContext *context, std::ostream *ios);
 };
 
 } // namespace cool
@@ -5,6 +5,7 @@
 #include <cool/core/status.h>
 #include <cool/ir/common.h>
 #include <cool/ir/fwd.h>
+#include <cool/ir/static_visitor.h>
 
 #include <ostream>
 
@@ -13,12 +14,17 @@ namespace cool {
 /// Forward declaration
 class CodegenContext;
 
-class CodegenCodePass : public CodegenBasePass {
+/// Class that implements the code generation for methods and expressions.
+/// Children nodes are visited through StaticVisitor::dispatch
+class CodegenCodePass : public CodegenBasePass,
+                        public StaticVisitor<CodegenCodePass> {
 
 public:
   CodegenCodePass() = default;
   virtual ~CodegenCodePass() override = default;
 
+  using CodegenBasePass::codegen;
+
   /// Program, class and attributes nodes
   Status codegen(CodegenContext *context, MethodNode *node,
                  std::ostream *ios) final override;
@@ -79,6 +85,19 @@ public:
                  std::ostream *ios) final override;
 
 private:
+  friend class StaticVisitor<CodegenCodePass>;
+
+  /// Handler invoked by StaticVisitor::dispatch
+  ///
+  /// \param[in] node node to generate code for
+  /// \param[in] context Codegen context
+  /// \param[out] ios output stream
+  /// \return Status::Ok() on success, an error message otherwise
+  template <typename NodeT>
+  Status apply(NodeT *node, CodegenContext *context, std::ostream *ios) {
+    return codegen(context, node, ios);
+  }
+
   Status binaryEqualityCodegen(CodegenContext *context,
                                BinaryExprNode<ComparisonOpID> *node,
                                std::ostream *ios);
@@ -26,6 +26,17 @@ public:
 
   Status codegen(CodegenContext *context, ProgramNode *node,
                  std::ostream *ios) final override;
+
+  /// \brief Generate the header of the data segment: the global declarations,
+  /// the memory manager settings, the class tags and the prototype objects of
+  /// the built-in classes. The constants of the classes are not generated
+  ///
+  /// \param[in] context Codegen context
+  /// \param[in] node program node
+  /// \param[out] ios output stream
+  /// \return Status::Ok()
+  Status codegenHeader(CodegenContext *context, ProgramNode *node,
+                       std::ostream *ios);
 };
 
 } // namespace cool
@@ -1,71 +1,22 @@
 #ifndef COOL_CODEGEN_CODEGEN_CONTEXT_H
 #define COOL_CODEGEN_CODEGEN_CONTEXT_H
 
+#include <cool/core/class_layout.h>
 #include <cool/core/context.h>
-#include <cool/core/symbol_table.h>
+#include <cool/core/source_manager.h>
 
 #include <sstream>
 #include <unordered_set>
+#include <vector>
 
 namespace cool {
 
-/// \brief Helper struct to store the information needed about an identifier in
-/// a codegen context
-struct IdentifierCodegenInfo {
-  const bool isAttribute = false;
-  const int32_t position = -1;
-  IdentifierCodegenInfo(bool inpIsAttribute, const int32_t inpPosition)
-      : isAttribute(inpIsAttribute), position(inpPosition) {}
-};
-
-struct MethodCodegenInfo {
-  std::string className;
-  size_t position = 0;
-  MethodCodegenInfo(const std::string &className, const int32_t position)
-      : className(className), position(position) {}
-};
-
-class MethodTable {
-
-  using KeyT = std::string;
-  using ValueT = MethodCodegenInfo;
-  using StorageT = std::unordered_map<KeyT, ValueT>;
-
-public:
-  bool findKey(const KeyT &key) const { return storage_.count(key); }
-
-  const ValueT &get(const KeyT &key) const {
-    assert(storage_.count(key));
-    return storage_.find(key)->second;
-  }
-
-  void addElement(const KeyT &key, const ValueT &value) {
-    if (storage_.find(key) != storage_.end()) {
-      storage_.erase(key);
-    }
-    storage_.insert({key, value});
-  }
-
-  typename StorageT::iterator begin() { return storage_.begin(); }
-
-  typename StorageT::iterator end() { return storage_.end(); }
-
-  /// Set the parent symbol table. Used for handling inheritance
-  ///
-  /// \param[in] parentTable pointer to parent table
-  void setParentTable(MethodTable *parentTable) {
-    storage_ = parentTable->storage_;
-  }
-
-  size_t count() const { return storage_.size(); }
-
-private:
-  std::unordered_map<KeyT, ValueT> storage_;
-};
+/// \brief Placeholder for the symbol and method tables of a codegen context.
+/// The bindings of the identifiers and the slots of the methods are recorded
+/// on the nodes by NameResolutionPass
+struct NoTable {};
 
-class CodegenContext
-    : public Context<SymbolTable<std::string, IdentifierCodegenInfo>,
-                     MethodTable> {
+class CodegenContext : public Context<NoTable, NoTable> {
 
 public:
   CodegenContext() = delete;
@@ -76,6 +27,16 @@ public:
                  std::shared_ptr<LoggerCollection> logger)
       : Context(classRegistry, logger) {}
 
+  /// \brief Return the layout of the objects and of the dispatch tables
+  ///
+  /// \warning The class implementations must have been checked
+  ///
+  /// \return a pointer to the class layout
+  const ClassLayout *classLayout() const {
+    assert(classRegistry()->classLayout());
+    return classRegistry()->classLayout();
+  }
+
   /// \brief Generate a label
   ///
   /// \note The generated label will be appended with an integer representing
@@ -147,8 +108,49 @@ public:
   /// \return the stack position
   int32_t stackPosition() const { return stackPosition_; }
 
+  /// \brief Record the stack position of a let or case variable of the
+  /// current method or attribute initializer
+  ///
+  /// \param[in] index index of the variable, from its binding
+  /// \param[in] position stack position of the variable
+  void setLocalPosition(const int32_t index, const int32_t position) {
+    assert(index >= 0);
+    if (static_cast<size_t>(index) >= localPositions_.size()) {
+      localPositions_.resize(index + 1);
+    }
+    localPositions_[index] = position;
+  }
+
+  /// \brief Return the stack position of a let or case variable
+  ///
+  /// \param[in] index index of the variable, from its binding
+  /// \return the stack position of the variable
+  int32_t localPosition(const int32_t index) const {
+    assert(index >= 0 && static_cast<size_t>(index) < localPositions_.size());
+    return localPositions_[index];
+  }
+
+  /// \brief Set the source manager that converts the locations of the nodes
+  /// to the line numbers reported by the runtime errors
+  ///
+  /// \param[in] sourceManager source manager, can be nullptr
+  void setSourceManager(std::shared_ptr<const SourceManager> sourceManager) {
+    sourceManager_ = std::move(sourceManager);
+  }
+
+  /// \brief Convert a location in the program text to a line and a column
+  ///
+  /// \param[in] offset location in the program text, as a byte offset
+  /// \return the line and the column, both zero if no source manager is set
+  SourceLocation sourceLocation(const uint32_t offset) const {
+    return sourceManager_ ? sourceManager_->location(offset)
+                          : SourceLocation();
+  }
+
 private:
   int32_t stackPosition_;
+  std::vector<int32_t> localPositions_;
+  std::shared_ptr<const SourceManager> sourceManager_;
   std::unordered_set<int32_t> ints_;
   std::unordered_map<std::string, size_t> labels_;
   std::unordered_map<std::string, size_t> strings_;
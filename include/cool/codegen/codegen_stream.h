@@ -0,0 +1,66 @@
+#ifndef COOL_CODEGEN_CODEGEN_STREAM_H
+#define COOL_CODEGEN_CODEGEN_STREAM_H
+
+#include <cool/codegen/codegen_code.h>
+#include <cool/codegen/codegen_constants.h>
+#include <cool/codegen/codegen_tables.h>
+#include <cool/core/status.h>
+#include <cool/ir/fwd.h>
+
+#include <ostream>
+
+namespace cool {
+
+/// Forward declaration
+class CodegenContext;
+
+/// \brief Class that generates the code of a program one class at a time
+///
+/// The header of the data segment and the class tables only depend on the
+/// class signatures, and are generated first. The constants and the code of
+/// each class are then generated on demand, switching between the data and
+/// the text segments, so that the class expressions can be released as soon
+/// as their code is written. The heap start label is generated last
+class CodegenStream {
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param[in] context Codegen context
+  /// \param[out] ios output stream
+  CodegenStream(CodegenContext *context, std::ostream *ios)
+      : context_(context), ios_(ios) {}
+
+  /// \brief Generate the header of the data segment and the class tables
+  ///
+  /// \param[in] node program node, with its classes sorted in topological
+  /// order
+  /// \return Status::Ok() if successful, an error otherwise
+  Status begin(ProgramNode *node);
+
+  /// \brief Generate the constants and the code of a class
+  ///
+  /// \warning The classes must be generated in the order of the program, and
+  /// after the type-check of their expressions
+  ///
+  /// \param[in] node class node
+  /// \return Status::Ok() if successful, an error otherwise
+  Status generateClass(ClassNode *node);
+
+  /// \brief Generate the end of the data segment
+  ///
+  /// \return Status::Ok() if successful, an error otherwise
+  Status end();
+
+private:
+  CodegenContext *context_;
+  std::ostream *ios_;
+
+  CodegenConstantsPass constantsPass_;
+  CodegenTablesPass tablesPass_;
+  CodegenObjectsInitPass objectsInitPass_;
+};
+
+} // namespace cool
+
+#endif
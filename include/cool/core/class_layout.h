@@ -0,0 +1,185 @@
+#ifndef COOL_CORE_CLASS_LAYOUT_H
+#define COOL_CORE_CLASS_LAYOUT_H
+
+#include <cool/ir/common.h>
+#include <cool/ir/symbol.h>
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace cool {
+
+/// Forward declaration
+class ClassRegistry;
+
+/// Dense index of a method name in a class layout
+using SelectorID = uint32_t;
+
+/// \brief Helper struct to store an entry of a dispatch table
+struct DispatchTableEntry {
+  SelectorID selectorID;
+  IdentifierType classID;
+};
+
+/// \brief Class that stores the layout of the objects and of the dispatch
+/// tables of the classes of a program
+///
+/// The method names are interned into dense selector IDs. The attributes of a
+/// class follow the attributes of its parent class, and the dispatch table of
+/// a class extends the dispatch table of its parent class: an overriding
+/// method takes the slot of the method it overrides, a new method takes the
+/// next free slot. Only the methods defined by each class are stored, together
+/// with the classes that introduce each selector, so that the layout grows
+/// with the number of methods in the program, not with the number of classes
+/// times the size of their dispatch tables. The layout is immutable once built
+/// and can be shared across threads
+class ClassLayout {
+
+public:
+  /// Marker for a method name that is not a selector
+  static constexpr SelectorID INVALID_SELECTOR = UINT32_MAX;
+
+  ClassLayout() = delete;
+
+  /// \brief Build the layout of the classes of a registry
+  ///
+  /// \warning The registry must be frozen, and the attributes and methods of
+  /// its classes must have been checked by ClassesImplementationPass
+  ///
+  /// \param[in] registry class registry
+  /// \return a shared pointer to the new class layout
+  static std::shared_ptr<const ClassLayout>
+  MakeClassLayout(const ClassRegistry &registry);
+
+  /// \brief Return the selector ID of a method name
+  ///
+  /// \param[in] methodName method name
+  /// \return the selector ID, INVALID_SELECTOR if no class defines the method
+  SelectorID selectorID(const Symbol &methodName) const {
+    auto it = selectorIDs_.find(methodName);
+    return it != selectorIDs_.end() ? it->second : INVALID_SELECTOR;
+  }
+
+  /// \brief Return the method name of a selector
+  ///
+  /// \param[in] selectorID selector ID
+  /// \return the method name
+  const Symbol &selectorName(const SelectorID selectorID) const {
+    assert(selectorID < selectorNames_.size());
+    return selectorNames_[selectorID];
+  }
+
+  /// \brief Return the number of selectors
+  ///
+  /// \return the number of distinct method names
+  size_t selectorsCount() const { return selectorNames_.size(); }
+
+  /// \brief Return the position of the first attribute defined by a class, or
+  /// equivalently the number of attributes it inherits
+  ///
+  /// \param[in] classID class ID
+  /// \return the position of the first attribute defined by the class
+  uint32_t attributesBegin(const IdentifierType classID) const {
+    return record(classID).attributesBegin;
+  }
+
+  /// \brief Return the number of attributes of a class, inherited included
+  ///
+  /// \param[in] classID class ID
+  /// \return the number of attributes of the class
+  uint32_t attributesCount(const IdentifierType classID) const {
+    return record(classID).attributesCount;
+  }
+
+  /// \brief Return the number of slots in the dispatch table of a class
+  ///
+  /// \param[in] classID class ID
+  /// \return the size of the dispatch table of the class
+  uint32_t slotsCount(const IdentifierType classID) const {
+    return record(classID).slotsCount;
+  }
+
+  /// \brief Return the slot of a method in the dispatch table of a class
+  ///
+  /// \param[in] classID class ID
+  /// \param[in] selectorID selector ID of the method
+  /// \return the slot of the method, -1 if the class has no such method
+  int32_t slot(const IdentifierType classID,
+               const SelectorID selectorID) const;
+
+  /// \brief Overload that uses the method name
+  ///
+  /// \param[in] classID class ID
+  /// \param[in] methodName method name
+  /// \return the slot of the method, -1 if the class has no such method
+  int32_t slot(const IdentifierType classID, const Symbol &methodName) const {
+    const auto id = selectorID(methodName);
+    return id != INVALID_SELECTOR ? slot(classID, id) : -1;
+  }
+
+  /// \brief Compute the dispatch table of a class
+  ///
+  /// \param[in] classID class ID
+  /// \param[out] entries selector and defining class of each slot
+  void dispatchTable(const IdentifierType classID,
+                     std::vector<DispatchTableEntry> *entries) const;
+
+private:
+  /// Layout of a class. Classes are numbered in depth-first preorder, so that
+  /// a class descends from another class if and only if its preorder number
+  /// falls within the interval of the other class
+  struct ClassRecord {
+    IdentifierType parentID = -1;
+    uint32_t preorderBegin = 0;
+    uint32_t preorderEnd = 0;
+    uint32_t attributesBegin = 0;
+    uint32_t attributesCount = 0;
+    uint32_t slotsCount = 0;
+    uint32_t methodsBegin = 0;
+    uint32_t methodsEnd = 0;
+  };
+
+  /// Method defined by a class, and its slot in the dispatch table
+  struct MethodSlot {
+    SelectorID selectorID;
+    uint32_t slot;
+  };
+
+  /// Class that introduces a selector, and the slot of the selector in the
+  /// dispatch tables of the class and of its descendants
+  struct Introduction {
+    IdentifierType classID;
+    uint32_t slot;
+  };
+
+  explicit ClassLayout(const ClassRegistry &registry);
+
+  /// \brief Return the layout of a class
+  ///
+  /// \param[in] classID class ID
+  /// \return the layout of the class
+  const ClassRecord &record(const IdentifierType classID) const {
+    assert(classID >= 0 && static_cast<size_t>(classID) < classes_.size());
+    return classes_[classID];
+  }
+
+  /// \brief Intern a method name
+  ///
+  /// \param[in] methodName method name
+  /// \return the selector ID of the method name
+  SelectorID internSelector(const Symbol &methodName);
+
+  std::vector<ClassRecord> classes_;
+  std::vector<MethodSlot> methods_;
+
+  std::vector<Symbol> selectorNames_;
+  std::unordered_map<Symbol, SelectorID> selectorIDs_;
+  std::vector<std::vector<Introduction>> introductions_;
+};
+
+} // namespace cool
+
+#endif
@@ -4,15 +4,28 @@
 #include <cool/core/status.h>
 #include <cool/ir/common.h>
 #include <cool/ir/fwd.h>
+#include <cool/ir/symbol.h>
 
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace cool {
 
+/// Forward declaration
+class ClassLayout;
+
 /// Class that implements a registry for class names
+///
+/// Classes are stored in a contiguous table indexed by class ID. Class names
+/// are resolved to IDs only at the boundary with the frontend; all the
+/// hierarchy queries operate on IDs
 class ClassRegistry {
 
 public:
@@ -24,15 +37,41 @@ public:
   /// \return cool::Status::Ok() if successfull, error message otherwise
   Status addClass(ClassNodePtr node);
 
+  /// \brief Assign IDs to class names before the classes are added
+  ///
+  /// Class IDs are otherwise assigned in the order in which the class names
+  /// are first seen. Reserving the IDs allows a program whose expression types
+  /// were computed with another registry to be registered again with the same
+  /// IDs. Names that have an ID already must keep it
+  ///
+  /// \param[in] classNames class names, in the order of their IDs
+  /// \return cool::Status::Ok() if successfull, error message otherwise
+  Status reserveClassIDs(const std::vector<Symbol> &classNames);
+
+  /// \brief Return the layout of the objects and of the dispatch tables of
+  /// the classes
+  ///
+  /// \return a pointer to the class layout, nullptr if it was not set yet
+  const ClassLayout *classLayout() const { return classLayout_.get(); }
+
+  /// \brief Set the layout of the objects and of the dispatch tables of the
+  /// classes. The layout is computed once the class implementations are
+  /// checked, and is shared by the semantic analysis and the code generation
+  ///
+  /// \param[in] classLayout class layout
+  void setClassLayout(std::shared_ptr<const ClassLayout> classLayout) {
+    classLayout_ = std::move(classLayout);
+  }
+
   /// \brief Get a class node from the registry given its ID.
   ///
   /// \note This method will trigger an assertion if the class ID is invalid
   ///
   /// \param[in] classID class ID
-  /// \return a shared pointer to the class node
-  ClassNodePtr classNode(const IdentifierType &classID) const {
-    assert(classRegistry_.count(classID) > 0);
-    return classRegistry_.find(classID)->second;
+  /// \return a pointer to the class node
+  ClassNode *classNode(const IdentifierType &classID) const {
+    assert(hasClass(classID));
+    return classes_[classID].node.get();
   }
 
   /// \brief Get a class node from the registry given its name.
@@ -40,21 +79,25 @@ public:
   /// \note This method will trigger an assertion if the class name is invalid
   ///
   /// \param[in] className class name
-  /// \return a shared pointer to the class node
-  ClassNodePtr classNode(const std::string &className) const {
-    return classRegistry_.find(this->typeID(className))->second;
+  /// \return a pointer to the class node
+  ClassNode *classNode(const Symbol &className) const {
+    return classNode(this->typeID(className));
   }
 
   /// \brief Return the class name corresponding to a type identifier
   ///
   /// \param[in] classID class ID
   /// \return the class name corresponding to the input class ID
-  const std::string &className(const IdentifierType classID) const;
+  const Symbol &className(const IdentifierType classID) const {
+    assert(classID >= 0 && static_cast<size_t>(classID) < classes_.size());
+    return classes_[classID].name;
+  }
 
   /// \brief Check whether a type conforms to another type
   ///
-  /// \note This algorithm could be optimize to run in constant time. The
-  /// current implementation runs in linear time.
+  /// \note This method runs in constant time once the registry has been
+  /// frozen, see ClassRegistry::freeze. Before that, it walks the inheritance
+  /// chain and runs in time linear in the depth of the class hierarchy.
   ///
   /// \param[in] childType child  type
   /// \param[in] parentType parent type
@@ -65,8 +108,9 @@ public:
   ///
   /// \param[in] className class name
   /// \return true if the class is in the registry, false otherwise
-  bool hasClass(const std::string &className) const {
-    return namesToIDs_.count(className) > 0;
+  bool hasClass(const Symbol &className) const {
+    auto it = namesToIDs_.find(className);
+    return it != namesToIDs_.end() && hasClass(it->second);
   }
 
   /// \brief Overload that uses the class identifier type
@@ -74,11 +118,56 @@ public:
   /// \param[in] classID class ID
   /// \return true if the class is in the registry, false otherwise
   bool hasClass(const IdentifierType &classID) const {
-    return classRegistry_.count(classID) > 0;
+    return classID >= 0 && static_cast<size_t>(classID) < classes_.size() &&
+           classes_[classID].node != nullptr;
+  }
+
+  /// \brief Check whether a class inherits from a parent class
+  ///
+  /// \param[in] classID class ID
+  /// \return true if the class has a parent class, false otherwise
+  bool hasParentClass(const IdentifierType classID) const {
+    assert(hasClass(classID));
+    return classes_[classID].parentID >= 0;
+  }
+
+  /// \brief Return the ID of the parent class of a class
+  ///
+  /// \warning The class must have a parent class
+  ///
+  /// \param[in] classID class ID
+  /// \return the ID of the parent class
+  IdentifierType parentID(const IdentifierType classID) const {
+    assert(hasParentClass(classID));
+    return classes_[classID].parentID;
   }
 
+  /// \brief Freeze the registry and build the class hierarchy index
+  ///
+  /// Classes are numbered in depth-first preorder. Each class is assigned the
+  /// half-open interval of preorder numbers spanned by its subtree, so that a
+  /// class conforms to another class if and only if its preorder number falls
+  /// within the interval of the other class. No class can be added to the
+  /// registry once it is frozen.
+  ///
+  /// \note The inheritance tree must be well formed, i.e. all parent classes
+  /// must be registered and no cycle must exist
+  ///
+  /// \return cool::Status::Ok() if successfull, error message otherwise
+  Status freeze();
+
+  /// \brief Check whether the registry has been frozen
+  ///
+  /// \return true if the class hierarchy index has been built
+  bool isFrozen() const { return frozen_; }
+
   /// \brief Find the least common ancestors of two types
   ///
+  /// Once the registry is frozen, the query is answered in constant time by a
+  /// range minimum query over the Euler tour of the inheritance tree. Results
+  /// for recently queried pairs of types are cached. Queries on a frozen
+  /// registry can be issued concurrently from multiple threads.
+  ///
   /// \note This method requires both descendants to be registered. It also
   /// assumes that the class inheritance tree is well formed. It is the
   /// client code responsibility to check that these preconditions are
@@ -94,7 +183,7 @@ public:
   ///
   /// \param[in] className class name
   /// \return the identifier corresponding to the input class name
-  IdentifierType typeID(const std::string &className) const {
+  IdentifierType typeID(const Symbol &className) const {
     auto it = namesToIDs_.find(className);
     assert(it != namesToIDs_.end());
     return it->second;
@@ -106,7 +195,7 @@ public:
   ///
   /// \param[in] className class name
   /// \return an ExprType object
-  ExprType toType(const std::string &className) const {
+  ExprType toType(const Symbol &className) const {
     return toTypeImpl(className, false);
   }
 
@@ -116,35 +205,66 @@ public:
   ///
   /// \param[in] className containing class name
   /// \return an ExprType object
-  ExprType toSelfType(const std::string &className) const {
+  ExprType toSelfType(const Symbol &className) const {
     return toTypeImpl(className, true);
   }
 
+  /// \brief Return the type of the Object class
+  ///
+  /// \note The IDs of the Object, Int, Bool and String classes are recorded
+  /// when they are assigned, so that their types are returned without hashing
+  /// their names
+  ///
+  /// \warning The class must have an ID
+  ///
+  /// \return the type of the Object class
+  ExprType objectType() const { return BuiltInType(builtInIDs_.object); }
+
+  /// \brief Return the type of the Int class, see objectType()
+  ///
+  /// \return the type of the Int class
+  ExprType intType() const { return BuiltInType(builtInIDs_.intType); }
+
+  /// \brief Return the type of the Bool class, see objectType()
+  ///
+  /// \return the type of the Bool class
+  ExprType boolType() const { return BuiltInType(builtInIDs_.boolType); }
+
+  /// \brief Return the type of the String class, see objectType()
+  ///
+  /// \return the type of the String class
+  ExprType stringType() const { return BuiltInType(builtInIDs_.stringType); }
+
   /// Return the type name associated with an ExprType object
   ///
   /// \param[in] exprType expression type
   /// \return the type name associated with the expression type
-  std::string typeName(const ExprType &exprType) const {
+  Symbol typeName(const ExprType &exprType) const {
     if (exprType.isSelf) {
-      return "SELF_TYPE";
+      return WellKnownSymbols::Get().selfType;
     }
     return this->className(exprType.typeID);
   }
 
   /// Return the number of classes
   ///
+  /// \note In a well formed program, class IDs range from zero to the number
+  /// of classes minus one
+  ///
   /// \return the number of classes
-  size_t size() const { return classRegistry_.size(); }
+  size_t size() const { return classesCount_; }
 
 private:
   /// \brief Find the ID of a class, if it exists, or create a new one
   ///
-  /// This class will a new item to the class names / IDs dictionary if the
-  /// class has not been assigned an ID yet
+  /// This class will a new item to the class names / IDs dictionary and a new
+  /// entry to the class table if the class has not been assigned an ID yet.
+  /// Parent classes are assigned an ID as soon as one of their children is
+  /// added to the registry, so that the parent ID of a class is always known
   ///
   /// \param[in] className class name
   /// \return the class ID
-  IdentifierType findOrCreateClassID(const std::string &className);
+  IdentifierType findOrCreateClassID(const Symbol &className);
 
   /// \brief Find the distance to the base superclass
   ///
@@ -152,15 +272,94 @@ private:
   /// \return the distance to the base class
   uint32_t distanceToRoot(const IdentifierType &classID) const;
 
-  ExprType toTypeImpl(const std::string &className, const bool isSelf) const {
+  /// \brief Find the least common ancestor by walking the inheritance chains
+  ///
+  /// \param[in] firstClassID first class ID
+  /// \param[in] secondClassID second class ID
+  /// \return the ID of the least common ancestor
+  IdentifierType chainWalkAncestor(const IdentifierType firstClassID,
+                                   const IdentifierType secondClassID) const;
+
+  /// \brief Find the least common ancestor using the Euler tour sparse table
+  ///
+  /// \warning This method requires the registry to be frozen
+  ///
+  /// \param[in] firstClassID first class ID
+  /// \param[in] secondClassID second class ID
+  /// \return the ID of the least common ancestor
+  IdentifierType eulerTourAncestor(const IdentifierType firstClassID,
+                                   const IdentifierType secondClassID) const;
+
+  /// \brief Return the type of a built-in class given its ID
+  ///
+  /// \param[in] classID class ID, -1 if the class has no ID yet
+  /// \return the type of the class
+  static ExprType BuiltInType(const IdentifierType classID) {
+    assert(classID >= 0);
+    return ExprType{.typeID = classID, .isSelf = false};
+  }
+
+  ExprType toTypeImpl(const Symbol &className, const bool isSelf) const {
     assert(namesToIDs_.count(className) > 0);
     const auto typeID = namesToIDs_.find(className)->second;
     return ExprType{.typeID = typeID, .isSelf = isSelf};
   }
 
-  /// Dictionaries
-  std::unordered_map<std::string, IdentifierType> namesToIDs_;
-  std::unordered_map<IdentifierType, ClassNodePtr> classRegistry_;
+  /// Entry of the class table. Depth, preorder interval and position in the
+  /// Euler tour are valid only once the registry is frozen
+  struct ClassRecord {
+    ClassNodePtr node;
+    Symbol name;
+    IdentifierType parentID = -1;
+    uint32_t depth = 0;
+    uint32_t preorderBegin = 0;
+    uint32_t preorderEnd = 0;
+    uint32_t eulerFirst = 0;
+  };
+
+  /// Class names dictionary and class table
+  std::unordered_map<Symbol, IdentifierType> namesToIDs_;
+  std::vector<ClassRecord> classes_;
+  size_t classesCount_ = 0;
+
+  /// IDs of the built-in classes whose types the analysis refers to directly
+  struct BuiltInIDs {
+    IdentifierType object = -1;
+    IdentifierType intType = -1;
+    IdentifierType boolType = -1;
+    IdentifierType stringType = -1;
+  };
+  BuiltInIDs builtInIDs_;
+
+  /// Euler tour of the inheritance tree and sparse table over the tour. Entry
+  /// (k, i) of the sparse table stores the shallowest class in the tour range
+  /// [i, i + 2^k). Valid once the registry is frozen
+  bool frozen_ = false;
+  std::vector<std::vector<IdentifierType>> eulerSparseTable_;
+
+  /// Layout of the classes, set once the class implementations are checked
+  std::shared_ptr<const ClassLayout> classLayout_;
+
+  /// Direct-mapped cache of recent least common ancestor queries. Each entry
+  /// packs the IDs of the two classes and of their ancestor in a single word,
+  /// so that concurrent queries never observe a partially written entry.
+  /// Pairs with an ID that does not fit in the packed fields are not cached
+  static constexpr uint64_t EMPTY_ANCESTOR_ENTRY = UINT64_MAX;
+  static constexpr uint32_t ANCESTOR_ID_BITS = 21;
+  struct AncestorCacheEntry {
+    AncestorCacheEntry() = default;
+    AncestorCacheEntry(const AncestorCacheEntry &other)
+        : value(other.value.load(std::memory_order_relaxed)) {}
+    AncestorCacheEntry &operator=(const AncestorCacheEntry &other) {
+      value.store(other.value.load(std::memory_order_relaxed),
+                  std::memory_order_relaxed);
+      return *this;
+    }
+
+    std::atomic<uint64_t> value{EMPTY_ANCESTOR_ENTRY};
+  };
+  static constexpr size_t ANCESTOR_CACHE_SIZE = 64;
+  mutable std::array<AncestorCacheEntry, ANCESTOR_CACHE_SIZE> ancestorCache_;
 };
 
 } // namespace cool
@@ -0,0 +1,104 @@
+#ifndef COOL_CORE_COMPILE_CACHE_H
+#define COOL_CORE_COMPILE_CACHE_H
+
+#include <cool/core/status.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace cool {
+
+/// Statistics of a compile cache
+struct CompileCacheStatistics {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t entries = 0;
+  uint64_t bytes = 0;
+};
+
+/// \brief Class that stores the generated code of whole programs in a local
+/// directory, keyed by the SHA-256 digest of everything the code depends on
+///
+/// The key of a program covers the compiler stamp, the options that affect
+/// the generated code, and the names and the contents of the source files.
+/// Each entry is a file named after its key. Entries are written to a
+/// temporary file first and then renamed, so that concurrent compilers never
+/// read a partially written entry. Since entries with the same key hold the
+/// same code, concurrent compilers that miss the same entry can store it at
+/// the same time. Each lookup appends one byte to a statistics file opened in
+/// append mode, which keeps the counts consistent across processes too
+class CompileCache {
+
+public:
+  CompileCache() = delete;
+
+  /// \brief Constructor
+  ///
+  /// \param[in] directory path to the cache directory
+  explicit CompileCache(std::string directory)
+      : directory_(std::move(directory)) {}
+
+  /// \brief Create the cache directory, if it does not exist yet. The parent
+  /// directory must exist
+  ///
+  /// \return Status::Ok() if successful, an error otherwise
+  Status initialize() const;
+
+  /// \brief Compute the key of a program
+  ///
+  /// \param[in] filePaths paths to the source files, in order
+  /// \param[in] options options that affect the generated code
+  /// \param[out] key key of the program, as 64 hexadecimal digits
+  /// \return Status::Ok() if successful, an error if a file cannot be read
+  static Status MakeKey(const std::vector<std::string> &filePaths,
+                        const std::vector<std::string> &options,
+                        std::string *key);
+
+  /// \brief Return a stamp that identifies the running compiler. The stamp is
+  /// the SHA-256 digest of the compiler sources, computed at build time
+  ///
+  /// \return the compiler stamp, or an empty string if the compiler was built
+  /// without a stamp, in which case the cache must not be used
+  static std::string CompilerStamp();
+
+  /// \brief Look up an entry and record the lookup in the statistics
+  ///
+  /// \param[in] key key of the program
+  /// \param[out] code generated code of the program, if found
+  /// \return true if the entry was found, false otherwise
+  bool lookup(const std::string &key, std::string *code) const;
+
+  /// \brief Store an entry atomically
+  ///
+  /// \param[in] key key of the program
+  /// \param[in] code generated code of the program
+  /// \return Status::Ok() if successful, an error otherwise
+  Status store(const std::string &key, const std::string &code) const;
+
+  /// \brief Collect the statistics of the cache
+  ///
+  /// \param[out] statistics hits and misses recorded so far, number of
+  /// entries and their total size in bytes
+  /// \return Status::Ok() if successful, an error otherwise
+  Status statistics(CompileCacheStatistics *statistics) const;
+
+private:
+  /// \brief Return the path to an entry
+  ///
+  /// \param[in] key key of the program
+  /// \return the path to the entry
+  std::string entryPath(const std::string &key) const;
+
+  /// \brief Append a lookup outcome to the statistics file
+  ///
+  /// \param[in] hit true for a hit, false for a miss
+  void recordLookup(const bool hit) const;
+
+  std::string directory_;
+};
+
+} // namespace cool
+
+#endif
@@ -3,8 +3,11 @@
 
 #include <cool/core/class_registry.h>
 #include <cool/ir/common.h>
+#include <cool/ir/symbol.h>
 
+#include <cassert>
 #include <memory>
+#include <vector>
 
 namespace cool {
 
@@ -12,10 +15,13 @@ namespace cool {
 class LoggerCollection;
 
 /// Class that represents the context of a compiler pass / analysis
+///
+/// The context tracks the ID of the current class together with its name, and
+/// stores the tables of the classes in vectors indexed by class ID, so that
+/// accessing the tables of a class does not hash its name
 template <typename SymbolTableT, typename MethodTableT> class Context {
 
-  template <typename T>
-  using TableCollectionT = std::unordered_map<IdentifierType, T>;
+  template <typename T> using TableCollectionT = std::vector<T>;
 
 public:
   Context() = delete;
@@ -24,6 +30,17 @@ public:
   Context(std::shared_ptr<ClassRegistry> classRegistry,
           std::shared_ptr<LoggerCollection> logger);
 
+  /// Create a context layered on top of a base context. The new context shares
+  /// the class registry of the base context, and looks up in the base context
+  /// the tables of the classes it does not own
+  ///
+  /// \warning The base context must outlive the new context, and its tables
+  /// must not be modified while the new context is in use
+  ///
+  /// \param[in] base base context
+  /// \param[in] logger loggers collection of the new context
+  Context(const Context &base, std::shared_ptr<LoggerCollection> logger);
+
   ~Context() = default;
 
   /// Get the class registry
@@ -34,14 +51,12 @@ public:
   /// Get the name of the current class being processed
   ///
   /// \return the name of the current class being processed
-  const std::string &currentClassName() const { return currentClassName_; }
+  const Symbol &currentClassName() const { return currentClassName_; }
 
   /// Get the id of the current class being processed
   ///
   /// \return the ID of the current class being processed
-  const IdentifierType currentClassID() const {
-    return classRegistry_->typeID(currentClassName_);
-  }
+  IdentifierType currentClassID() const { return currentClassID_; }
 
   /// Initialize symbol and method tables
   void initializeTables() {
@@ -49,6 +64,30 @@ public:
     initializeGenericTable(methodTables_);
   }
 
+  /// Check whether the symbol and method tables of a class exist
+  ///
+  /// \param[in] typeID type ID
+  /// \return true if the tables of the class exist, false otherwise
+  bool hasTables(const IdentifierType &typeID) const {
+    return FindTable(symbolTables_, typeID) ||
+           (base_ && base_->hasTables(typeID));
+  }
+
+  /// Share the symbol and method tables of a class with another context
+  ///
+  /// \warning The class must have the same ID in both contexts, and the
+  /// tables must not be modified once they are shared
+  ///
+  /// \param[in] other context that owns the tables
+  /// \param[in] typeID type ID
+  void importTables(const Context &other, const IdentifierType &typeID);
+
+  /// Create a symbol table for the currently active class that is layered on
+  /// top of the symbol table of the class in the base context. Symbols added
+  /// to the new table, and the scopes entered in it, are not visible in the
+  /// base context
+  void overlaySymbolTable();
+
   /// Get the logger
   ///
   /// \return a pointer to the logger
@@ -57,7 +96,7 @@ public:
   /// Get or create the method table for the currently active class
   ///
   /// \return the method table for the currently active class
-  MethodTableT *methodTable() { return methodTable(currentClassName_); }
+  MethodTableT *methodTable() { return methodTable(currentClassID_); }
 
   /// Get the method table for the specified class given its name
   ///
@@ -65,11 +104,8 @@ public:
   ///
   /// \param[in] className class name
   /// \return the method table for the specified class
-  MethodTableT *methodTable(const std::string &className) const {
-    const auto classID = classRegistry_->typeID(className);
-    auto it = methodTables_.find(classID);
-    assert(it != methodTables_.end());
-    return it->second.get();
+  MethodTableT *methodTable(const Symbol &className) const {
+    return methodTable(classRegistry_->typeID(className));
   }
 
   /// Get the method table for the specified class given its type ID
@@ -79,22 +115,38 @@ public:
   /// \param[in] typeID type ID
   /// \return the method table for the specified class
   MethodTableT *methodTable(const IdentifierType &typeID) const {
-    auto it = methodTables_.find(typeID);
-    assert(it != methodTables_.end());
-    return it->second.get();
+    auto *table = FindTable(methodTables_, typeID);
+    if (!table && base_) {
+      return base_->methodTable(typeID);
+    }
+    assert(table);
+    return table;
+  }
+
+  /// Set the current class being processed given its ID
+  ///
+  /// \warning This method assumes that the specified class exists
+  ///
+  /// \param[in] currentClassID ID of the current class being processed
+  void setCurrentClassID(const IdentifierType currentClassID) {
+    currentClassID_ = currentClassID;
+    currentClassName_ = classRegistry_->className(currentClassID);
   }
 
   /// Set the name of the current class being processed
   ///
+  /// \warning This method assumes that the specified class exists
+  ///
   /// \param[in] currentClassName name of the current class being processed
-  void setCurrentClassName(const std::string &currentClassName) {
+  void setCurrentClassName(const Symbol &currentClassName) {
     currentClassName_ = currentClassName;
+    currentClassID_ = classRegistry_->typeID(currentClassName);
   }
 
   /// Get or create the symbol table for the currently active class
   ///
   /// \return the symbol table for the currently active class
-  SymbolTableT *symbolTable() { return symbolTable(currentClassName_); }
+  SymbolTableT *symbolTable() { return symbolTable(currentClassID_); }
 
   /// Get the symbol table for the specified class
   ///
@@ -102,11 +154,8 @@ public:
   ///
   /// \param[in] className class name
   /// \return the symbol table for the specified class
-  SymbolTableT *symbolTable(const std::string &className) const {
-    const auto classID = classRegistry_->typeID(className);
-    auto it = symbolTables_.find(classID);
-    assert(it != symbolTables_.end());
-    return it->second.get();
+  SymbolTableT *symbolTable(const Symbol &className) const {
+    return symbolTable(classRegistry_->typeID(className));
   }
 
   /// Get the symbol table for the specified class given its ID
@@ -116,24 +165,58 @@ public:
   /// \param[in] typeID type ID
   /// \return the symbol table for the specified class
   SymbolTableT *symbolTable(const IdentifierType &typeID) const {
-    auto it = symbolTables_.find(typeID);
-    assert(it != symbolTables_.end());
-    return it->second.get();
+    auto *table = FindTable(symbolTables_, typeID);
+    if (!table && base_) {
+      return base_->symbolTable(typeID);
+    }
+    assert(table);
+    return table;
   }
 
 private:
+  /// Return the table of a class owned by this context
+  ///
+  /// \param[in] tables tables collection
+  /// \param[in] typeID type ID
+  /// \return a pointer to the table, nullptr if the context does not own it
+  template <typename T>
+  static T *FindTable(const TableCollectionT<std::shared_ptr<T>> &tables,
+                      const IdentifierType typeID) {
+    return typeID >= 0 && static_cast<size_t>(typeID) < tables.size()
+               ? tables[typeID].get()
+               : nullptr;
+  }
+
+  /// Store the table of a class, growing the tables collection if needed
+  ///
+  /// \param[in] tables tables collection
+  /// \param[in] typeID type ID
+  /// \param[in] table table of the class
+  template <typename T>
+  static void StoreTable(TableCollectionT<std::shared_ptr<T>> &tables,
+                         const IdentifierType typeID,
+                         std::shared_ptr<T> table) {
+    assert(typeID >= 0);
+    if (static_cast<size_t>(typeID) >= tables.size()) {
+      tables.resize(typeID + 1);
+    }
+    tables[typeID] = std::move(table);
+  }
+
   /// Initialize a table for the currently active class
   ///
   /// \param[in] tables tables collection
   template <typename T>
-  void initializeGenericTable(TableCollectionT<std::unique_ptr<T>> &tables);
+  void initializeGenericTable(TableCollectionT<std::shared_ptr<T>> &tables);
 
-  std::string currentClassName_;
+  Symbol currentClassName_;
+  IdentifierType currentClassID_ = -1;
   std::shared_ptr<ClassRegistry> classRegistry_;
   std::shared_ptr<LoggerCollection> logger_;
+  const Context *base_ = nullptr;
 
-  TableCollectionT<std::unique_ptr<SymbolTableT>> symbolTables_;
-  TableCollectionT<std::unique_ptr<MethodTableT>> methodTables_;
+  TableCollectionT<std::shared_ptr<SymbolTableT>> symbolTables_;
+  TableCollectionT<std::shared_ptr<MethodTableT>> methodTables_;
 };
 
 } // namespace cool
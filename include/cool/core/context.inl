@@ -9,23 +9,45 @@ Context<SymbolTableT, MethodTableT>::Context(
     std::shared_ptr<ClassRegistry> classRegistry, std::shared_ptr<LoggerCollection> logger)
     : classRegistry_(classRegistry), logger_(logger) {}
 
+template <typename SymbolTableT, typename MethodTableT>
+Context<SymbolTableT, MethodTableT>::Context(
+    const Context &base, std::shared_ptr<LoggerCollection> logger)
+    : classRegistry_(base.classRegistry_), logger_(logger), base_(&base) {}
+
+template <typename SymbolTableT, typename MethodTableT>
+void Context<SymbolTableT, MethodTableT>::importTables(
+    const Context &other, const IdentifierType &typeID) {
+  assert(!hasTables(typeID) && other.hasTables(typeID));
+  StoreTable(symbolTables_, typeID, other.symbolTables_[typeID]);
+  StoreTable(methodTables_, typeID, other.methodTables_[typeID]);
+}
+
+template <typename SymbolTableT, typename MethodTableT>
+void Context<SymbolTableT, MethodTableT>::overlaySymbolTable() {
+  assert(base_ && !FindTable(symbolTables_, currentClassID_));
+
+  auto table = std::make_shared<SymbolTableT>();
+  table->setParentTable(base_->symbolTable(currentClassID_));
+  StoreTable(symbolTables_, currentClassID_, std::move(table));
+}
+
 template <typename SymbolTableT, typename MethodTableT>
 template <typename T>
 void Context<SymbolTableT, MethodTableT>::initializeGenericTable(
-    TableCollectionT<std::unique_ptr<T>> &tables) {
-  const auto classID = classRegistry_->typeID(currentClassName_);
-  assert(tables.count(classID) == 0);
+    TableCollectionT<std::shared_ptr<T>> &tables) {
+  const auto classID = currentClassID_;
+  assert(!FindTable(tables, classID));
 
-  tables.insert({classID, std::make_unique<T>()});
-  auto table = tables.find(classID)->second.get();
+  auto table = std::make_shared<T>();
 
   /// Set parent table
-  auto classNode = classRegistry_->classNode(classID);
-  if (classNode->hasParentClass()) {
-    auto parentID = classRegistry_->typeID(classNode->parentClassName());
-    auto parentTable = tables.find(parentID)->second.get();
+  if (classRegistry_->hasParentClass(classID)) {
+    auto parentID = classRegistry_->parentID(classID);
+    auto parentTable = FindTable(tables, parentID);
+    assert(parentTable);
     table->setParentTable(parentTable);
   }
+  StoreTable(tables, classID, std::move(table));
 }
 
 } // namespace cool
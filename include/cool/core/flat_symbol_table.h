@@ -0,0 +1,126 @@
+#ifndef COOL_CORE_FLAT_SYMBOL_TABLE_H
+#define COOL_CORE_FLAT_SYMBOL_TABLE_H
+
+#include <cool/core/status.h>
+#include <cool/ir/common.h>
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace cool {
+
+/// Class that implements a nested symbol table on top of a single
+/// open-addressing hash table. It provides the same interface as SymbolTable.
+///
+/// Each slot of the hash table refers to the innermost definition of a key.
+/// Definitions are appended to an undo log in insertion order, together with
+/// the index of the definition they shadow. Exiting a scope unwinds the undo
+/// log down to the scope mark, restoring the shadowed definitions. Once the
+/// table has grown to its working size, entering and exiting scopes does not
+/// allocate, and each lookup in the table costs a single probe sequence
+template <typename KeyT, typename ValueT, typename HashT = std::hash<KeyT>>
+class FlatSymbolTable {
+
+public:
+  FlatSymbolTable();
+
+  /// Add symbol to current scope. Insertion will fail if the symbol is already
+  /// in the current scope
+  ///
+  /// \param[in] key: key of the element to add
+  /// \param[in] value: value of the element to add
+  /// \return Status::Ok() on success
+  Status addElement(const KeyT &key, const ValueT &value);
+
+  /// Enter a new nested scope
+  void enterScope();
+
+  /// Exit the current nested scope
+  ///
+  /// This function call will throw if an attempt of exiting the class scope is
+  /// detected
+  void exitScope();
+
+  /// Check whether the input key is defined in the current scope
+  ///
+  /// \param[in] key: key of the element to check
+  /// \return true if the element is in the current scope, false therwise
+  bool findKeyInScope(const KeyT &key) const;
+
+  /// Check whether the input key is defined in the nested table
+  ///
+  /// \param[in] key: key of the element to check
+  /// \return true if the element is in the table, false otherwise
+  bool findKeyInTable(const KeyT &key) const;
+
+  /// Set the parent symbol table. Used for handling inheritance
+  ///
+  /// \param[in] parentTable pointer to parent table
+  void setParentTable(FlatSymbolTable *parentTable) {
+    parentTable_ = parentTable;
+  }
+
+  /// Return the value associated with the input key. The key must be present in
+  /// the table, otherwise a runtime assertion will be triggered
+  ///
+  /// \param[in] key: key of the element to return
+  /// \return the value associated with the given key.
+  const ValueT &get(const KeyT &key) const;
+
+  /// Return the number of keys stored in the nested symbol tables
+  ///
+  /// \return the number of keys stored in the nested symbol table
+  size_t count() const;
+
+private:
+  /// Definition of a key, stored in the undo log
+  struct Entry {
+    KeyT key;
+    ValueT value;
+    size_t hash;
+    uint32_t shadowed;
+    uint32_t scope;
+  };
+
+  /// Marker for an empty slot or for a definition that shadows nothing
+  static constexpr uint32_t NONE = UINT32_MAX;
+
+  /// Initial number of slots, must be a power of two
+  static constexpr size_t INITIAL_SLOTS = 16;
+
+  /// Find the slot holding the input key, or the empty slot that terminates
+  /// its probe sequence
+  ///
+  /// \param[in] key key to look for
+  /// \param[in] hash hash of the key
+  /// \return the slot index
+  size_t findSlot(const KeyT &key, const size_t hash) const;
+
+  /// Find the innermost definition of a key in this table
+  ///
+  /// \param[in] key key to look for
+  /// \return the index of the definition in the undo log, or NONE
+  uint32_t findEntry(const KeyT &key) const;
+
+  /// Remove a key from the hash table using backward shift deletion
+  ///
+  /// \param[in] slot slot holding the key to remove
+  void eraseSlot(size_t slot);
+
+  /// Double the number of slots and rehash the keys
+  void grow();
+
+  std::vector<uint32_t> slots_;
+  std::vector<Entry> entries_;
+  std::vector<uint32_t> scopeMarks_;
+  size_t occupiedSlots_;
+  FlatSymbolTable *parentTable_;
+};
+
+} // namespace cool
+
+#include <cool/core/flat_symbol_table.inl>
+
+#endif
@@ -0,0 +1,172 @@
+namespace cool {
+
+template <typename KeyT, typename ValueT, typename HashT>
+constexpr uint32_t FlatSymbolTable<KeyT, ValueT, HashT>::NONE;
+
+template <typename KeyT, typename ValueT, typename HashT>
+FlatSymbolTable<KeyT, ValueT, HashT>::FlatSymbolTable()
+    : slots_(INITIAL_SLOTS, NONE), occupiedSlots_(0),
+      parentTable_(nullptr) {
+  this->enterScope();
+}
+
+template <typename KeyT, typename ValueT, typename HashT>
+Status FlatSymbolTable<KeyT, ValueT, HashT>::addElement(const KeyT &key,
+                                                        const ValueT &value) {
+  /// Keep the load factor below one half
+  if (2 * (occupiedSlots_ + 1) > slots_.size()) {
+    grow();
+  }
+
+  const size_t hash = HashT{}(key);
+  const size_t slot = findSlot(key, hash);
+  const uint32_t shadowed = slots_[slot];
+  const uint32_t scope = scopeMarks_.size() - 1;
+  if (shadowed != NONE && entries_[shadowed].scope == scope) {
+    return GenericError("Error: identifier already defined in current scope");
+  }
+
+  if (shadowed == NONE) {
+    ++occupiedSlots_;
+  }
+  slots_[slot] = entries_.size();
+  entries_.push_back(Entry{key, value, hash, shadowed, scope});
+  return Status::Ok();
+}
+
+template <typename KeyT, typename ValueT, typename HashT>
+void FlatSymbolTable<KeyT, ValueT, HashT>::enterScope() {
+  scopeMarks_.push_back(entries_.size());
+}
+
+template <typename KeyT, typename ValueT, typename HashT>
+void FlatSymbolTable<KeyT, ValueT, HashT>::exitScope() {
+  assert(scopeMarks_.size() > 1);
+
+  /// Unwind the undo log, restoring the shadowed definitions
+  const size_t scopeMark = scopeMarks_.back();
+  while (entries_.size() > scopeMark) {
+    const auto &entry = entries_.back();
+    const size_t slot = findSlot(entry.key, entry.hash);
+    if (entry.shadowed != NONE) {
+      slots_[slot] = entry.shadowed;
+    } else {
+      eraseSlot(slot);
+      --occupiedSlots_;
+    }
+    entries_.pop_back();
+  }
+  scopeMarks_.pop_back();
+}
+
+template <typename KeyT, typename ValueT, typename HashT>
+bool FlatSymbolTable<KeyT, ValueT, HashT>::findKeyInScope(
+    const KeyT &key) const {
+  const auto index = findEntry(key);
+  return index != NONE && entries_[index].scope == scopeMarks_.size() - 1;
+}
+
+template <typename KeyT, typename ValueT, typename HashT>
+bool FlatSymbolTable<KeyT, ValueT, HashT>::findKeyInTable(
+    const KeyT &key) const {
+  /// Search in current symbol table
+  if (findEntry(key) != NONE) {
+    return true;
+  }
+
+  /// Search in parent symbol table if defined
+  if (parentTable_) {
+    return parentTable_->findKeyInTable(key);
+  }
+
+  /// Key not found, return false
+  return false;
+}
+
+template <typename KeyT, typename ValueT, typename HashT>
+const ValueT &
+FlatSymbolTable<KeyT, ValueT, HashT>::get(const KeyT &key) const {
+  /// Search in current symbol table
+  const auto index = findEntry(key);
+  if (index != NONE) {
+    return entries_[index].value;
+  }
+
+  /// Key not found, search in parent symbol table
+  assert(parentTable_);
+  return parentTable_->get(key);
+}
+
+template <typename KeyT, typename ValueT, typename HashT>
+size_t FlatSymbolTable<KeyT, ValueT, HashT>::count() const {
+  if (parentTable_) {
+    return entries_.size() + parentTable_->count();
+  }
+  return entries_.size();
+}
+
+template <typename KeyT, typename ValueT, typename HashT>
+size_t FlatSymbolTable<KeyT, ValueT, HashT>::findSlot(const KeyT &key,
+                                                      const size_t hash) const {
+  const size_t mask = slots_.size() - 1;
+  size_t slot = hash & mask;
+  while (slots_[slot] != NONE) {
+    const auto &entry = entries_[slots_[slot]];
+    if (entry.hash == hash && entry.key == key) {
+      break;
+    }
+    slot = (slot + 1) & mask;
+  }
+  return slot;
+}
+
+template <typename KeyT, typename ValueT, typename HashT>
+uint32_t FlatSymbolTable<KeyT, ValueT, HashT>::findEntry(const KeyT &key) const {
+  return slots_[findSlot(key, HashT{}(key))];
+}
+
+template <typename KeyT, typename ValueT, typename HashT>
+void FlatSymbolTable<KeyT, ValueT, HashT>::eraseSlot(size_t slot) {
+  /// Shift back the entries of the probe sequence that would become
+  /// unreachable once the slot is emptied
+  const size_t mask = slots_.size() - 1;
+  size_t next = slot;
+  while (true) {
+    next = (next + 1) & mask;
+    if (slots_[next] == NONE) {
+      break;
+    }
+
+    /// Keep the entry in place if its home slot lies cyclically in the
+    /// range (slot, next]
+    const size_t home = entries_[slots_[next]].hash & mask;
+    const bool inRange = slot <= next ? (slot < home && home <= next)
+                                      : (slot < home || home <= next);
+    if (!inRange) {
+      slots_[slot] = slots_[next];
+      slot = next;
+    }
+  }
+  slots_[slot] = NONE;
+}
+
+template <typename KeyT, typename ValueT, typename HashT>
+void FlatSymbolTable<KeyT, ValueT, HashT>::grow() {
+  std::vector<uint32_t> oldSlots(2 * slots_.size(), NONE);
+  oldSlots.swap(slots_);
+
+  const size_t mask = slots_.size() - 1;
+  for (auto index : oldSlots) {
+    if (index == NONE) {
+      continue;
+    }
+
+    size_t slot = entries_[index].hash & mask;
+    while (slots_[slot] != NONE) {
+      slot = (slot + 1) & mask;
+    }
+    slots_[slot] = index;
+  }
+}
+
+} // namespace cool
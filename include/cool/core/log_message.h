@@ -1,6 +1,8 @@
 #ifndef COOL_CORE_LOG_MESSAGE_H
 #define COOL_CORE_LOG_MESSAGE_H
 
+#include <cool/ir/symbol.h>
+
 #include <cstdio>
 #include <string>
 #include <utility>
@@ -90,6 +92,11 @@ template <> struct ArgExtractor<std::string> {
   static const char *GetArg(const std::string &arg) { return arg.c_str(); }
 };
 
+/// \brief Specialization of above metafunction for interned symbols
+template <> struct ArgExtractor<Symbol> {
+  static const char *GetArg(const Symbol &arg) { return arg.c_str(); }
+};
+
 } // namespace
 
 template <typename... Args>
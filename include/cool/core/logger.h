@@ -3,8 +3,14 @@
 
 #include <cool/core/log_message.h>
 
+#include <memory>
+#include <vector>
+
 namespace cool {
 
+/// Forward declaration
+class LoggerCollection;
+
 /// \brief Class defining the interface of a log message writer
 class Sink {
 
@@ -30,6 +36,13 @@ public:
   ///
   /// \param[in] message message to log
   virtual void logMessage(const LogMessage &message) = 0;
+
+  /// \brief Return the minimum severity of the messages recorded by the logger
+  ///
+  /// \return the minimum severity of the recorded messages
+  virtual LogMessageSeverity severity() const {
+    return LogMessageSeverity::DEBUG;
+  }
 };
 
 /// \brief Class that implements the logger interface
@@ -43,11 +56,39 @@ public:
 
   void logMessage(const LogMessage &logMessage) final override;
 
+  LogMessageSeverity severity() const final override { return severity_; }
+
 private:
   std::unique_ptr<Sink> sink_;
   LogMessageSeverity severity_;
 };
 
+/// \brief Class that implements a logger that stores the messages for later
+/// replay. Messages logged concurrently by different components can be
+/// buffered separately and replayed in a deterministic order
+class BufferedLogger : public ILogger {
+
+public:
+  BufferedLogger() = delete;
+  BufferedLogger(LogMessageSeverity severity) : severity_(severity) {}
+
+  ~BufferedLogger() = default;
+
+  void logMessage(const LogMessage &logMessage) final override;
+
+  LogMessageSeverity severity() const final override { return severity_; }
+
+  /// \brief Forward the stored messages to a collection of loggers, in the
+  /// order in which they were logged, and clear them
+  ///
+  /// \param[in] loggers loggers collection
+  void flush(const LoggerCollection *loggers);
+
+private:
+  std::vector<LogMessage> messages_;
+  LogMessageSeverity severity_;
+};
+
 /// \brief Specialization for a log writer that writes to stdout
 class StdoutSink : public Sink {
 public:
@@ -2,6 +2,7 @@
 #define COOL_CORE_LOGGER_COLLECTION_H
 
 #include <cool/core/log_message.h>
+#include <cool/core/source_manager.h>
 #include <cool/core/status.h>
 
 #include <cstdlib>
@@ -35,6 +36,24 @@ public:
   /// \param[in] message message to log
   void logMessage(const LogMessage &message) const;
 
+  /// \brief Return the minimum severity of the messages recorded by at least
+  /// one logger in the collection
+  ///
+  /// \note The severity of a logger is queried when the logger is registered
+  ///
+  /// \return the minimum severity of the recorded messages,
+  /// LogMessageSeverity::FATAL if the collection is empty
+  LogMessageSeverity severity() const { return severity_; }
+
+  /// \brief Check whether a message of the given severity would be recorded by
+  /// at least one logger in the collection
+  ///
+  /// \param[in] severity message severity
+  /// \return true if the message would be recorded, false otherwise
+  bool isEnabled(const LogMessageSeverity severity) const {
+    return !loggers_.empty() && severity >= severity_;
+  }
+
   /// \brief Add a logger to the collection
   ///
   /// \param[in] loggerName name of logger to add
@@ -49,15 +68,59 @@ public:
   /// \return Status::Ok() if successfull, an error message otherwise
   Status removeLogger(const std::string &loggerName);
 
+  /// \brief Set the source manager that converts the locations of the logged
+  /// nodes to lines and columns
+  ///
+  /// \param[in] sourceManager source manager, can be nullptr
+  void setSourceManager(std::shared_ptr<const SourceManager> sourceManager) {
+    sourceManager_ = std::move(sourceManager);
+  }
+
+  /// \brief Return the source manager
+  ///
+  /// \return a shared pointer to the source manager, can be nullptr
+  std::shared_ptr<const SourceManager> sourceManager() const {
+    return sourceManager_;
+  }
+
+  /// \brief Convert a location in the program text to a line and a column
+  ///
+  /// \param[in] offset location in the program text, as a byte offset
+  /// \return the line and the column, both zero if no source manager is set
+  SourceLocation sourceLocation(const uint32_t offset) const {
+    return sourceManager_ ? sourceManager_->location(offset)
+                          : SourceLocation();
+  }
+
 private:
+  /// \brief Recompute the minimum severity of the recorded messages
+  void updateSeverity();
+
   std::unordered_map<std::string, std::shared_ptr<ILogger>> loggers_;
+  std::shared_ptr<const SourceManager> sourceManager_;
+  LogMessageSeverity severity_ = LogMessageSeverity::FATAL;
 };
 
+/// DEBUG messages are compiled out when COOL_DISABLE_DEBUG_LOGGING is defined
+#ifdef COOL_DISABLE_DEBUG_LOGGING
+#define COOL_DEBUG_LOGGING_ENABLED 0
+#else
+#define COOL_DEBUG_LOGGING_ENABLED 1
+#endif
+
+/// Check whether a message would be recorded before formatting it
+#define LOG_ENABLED(logger, severity)                                          \
+  ((logger) && (logger)->isEnabled(cool::LogMessageSeverity::severity))
+
+#define LOG_DEBUG_ENABLED(logger)                                              \
+  (COOL_DEBUG_LOGGING_ENABLED && LOG_ENABLED(logger, DEBUG))
+
 #define LOG_MESSAGE_WITH_LOCATION(logger, token, severity, ...)                \
   {                                                                            \
+    const auto location = logger->sourceLocation(token->loc());                \
     std::ostringstream sHeader;                                                \
-    sHeader << "Error: line " << token->lineLoc() << ", column "               \
-            << token->charLoc() << ". ";                                       \
+    sHeader << "Error: line " << location.line << ", column "                  \
+            << location.column << ". ";                                        \
                                                                                \
     char buffer[2048];                                                         \
     snprintf(buffer, 2048, __VA_ARGS__);                                       \
@@ -83,22 +146,22 @@ private:
   }
 
 #define LOG_ERROR_MESSAGE_WITH_LOCATION(logger, token, ...)                    \
-  if (logger) {                                                                \
+  if (LOG_ENABLED(logger, ERROR)) {                                            \
     LOG_MESSAGE_WITH_LOCATION(logger, token, ERROR, __VA_ARGS__)               \
   }
 
 #define LOG_DEBUG_MESSAGE_WITH_LOCATION(logger, token, ...)                    \
-  if (logger) {                                                                \
+  if (LOG_DEBUG_ENABLED(logger)) {                                             \
     LOG_MESSAGE_WITH_LOCATION(logger, token, DEBUG, __VA_ARGS__)               \
   }
 
 #define LOG_ERROR_MESSAGE(logger, ...)                                         \
-  if (logger) {                                                                \
+  if (LOG_ENABLED(logger, ERROR)) {                                            \
     LOG_MESSAGE(logger, ERROR, __VA_ARGS__);                                   \
   }
 
 #define LOG_DEBUG_MESSAGE(logger, ...)                                         \
-  if (logger) {                                                                \
+  if (LOG_DEBUG_ENABLED(logger)) {                                             \
     LOG_MESSAGE(logger, DEBUG, __VA_ARGS__);                                   \
   }
 
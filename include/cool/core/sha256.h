@@ -0,0 +1,51 @@
+#ifndef COOL_CORE_SHA256_H
+#define COOL_CORE_SHA256_H
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+namespace cool {
+
+/// Class that computes the SHA-256 digest of a sequence of bytes, fed
+/// incrementally
+class Sha256 {
+
+public:
+  Sha256();
+
+  /// \brief Append bytes to the message
+  ///
+  /// \warning The digest must not have been computed yet
+  ///
+  /// \param[in] data pointer to the bytes
+  /// \param[in] length number of bytes
+  void update(const void *data, const size_t length);
+
+  /// \brief Overload that appends a string
+  ///
+  /// \param[in] data string to append
+  void update(const std::string &data) { update(data.data(), data.length()); }
+
+  /// \brief Complete the message and return its digest
+  ///
+  /// \return the digest, as a string of 64 lowercase hexadecimal digits
+  std::string hexDigest();
+
+private:
+  /// \brief Process a 64-byte block of the message
+  ///
+  /// \param[in] block pointer to the block
+  void processBlock(const uint8_t *block);
+
+  std::array<uint32_t, 8> state_;
+  std::array<uint8_t, 64> buffer_;
+  size_t bufferLength_ = 0;
+  uint64_t messageLength_ = 0;
+  bool finalized_ = false;
+};
+
+} // namespace cool
+
+#endif
@@ -0,0 +1,120 @@
+#ifndef COOL_CORE_SOURCE_MANAGER_H
+#define COOL_CORE_SOURCE_MANAGER_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cool {
+
+/// Line and column of a character in a program text. Both are zero for
+/// locations that do not belong to any program text
+struct SourceLocation {
+  uint32_t line = 0;
+  uint32_t column = 0;
+};
+
+/// Line starts of a program text, relative to the beginning of the text
+struct SourceLines {
+  uint32_t length = 0;
+  std::vector<uint32_t> lineStarts;
+};
+
+/// \brief Class that maps locations in the program texts to lines and columns
+///
+/// Each program text registered with the source manager is assigned a range of
+/// offsets, so that a single 32-bit offset identifies both the text and the
+/// character in the text. Offset zero is never assigned, and denotes the nodes
+/// that are not defined in any program text, such as the built-in classes.
+///
+/// The line starts of a text are computed lazily, the first time a location in
+/// the text is converted, and only up to that location. Files are read again
+/// from disk at that time, so that the scanners do not need to keep them in
+/// memory. Texts are never removed; the source manager is thread-safe
+class SourceManager {
+
+public:
+  SourceManager() = default;
+  SourceManager(const SourceManager &) = delete;
+  SourceManager &operator=(const SourceManager &) = delete;
+
+  /// \brief Register a file. The file is read only if a location in the file
+  /// is converted
+  ///
+  /// \warning This method will throw an assertion should the file not exist or
+  /// should the offsets be exhausted
+  ///
+  /// \param[in] filePath path to the file
+  /// \return the offset of the first character of the file
+  uint32_t addFile(const std::string &filePath);
+
+  /// \brief Register a program text held in memory
+  ///
+  /// \warning This method will throw an assertion should the offsets be
+  /// exhausted
+  ///
+  /// \param[in] text program text
+  /// \return the offset of the first character of the text
+  uint32_t addText(std::string text);
+
+  /// \brief Register a program text by its line starts only. Locations in the
+  /// text can be converted, while the text itself is not available
+  ///
+  /// \warning This method will throw an assertion should the offsets be
+  /// exhausted
+  ///
+  /// \param[in] lines length and line starts of the program text
+  /// \return the offset of the first character of the text
+  uint32_t addLines(SourceLines lines);
+
+  /// \brief Return the line starts of the registered texts, in the order in
+  /// which they were registered. Files not read yet are read
+  ///
+  /// \return the length and the line starts of each registered text
+  std::vector<SourceLines> lines() const;
+
+  /// \brief Convert an offset to a line and a column
+  ///
+  /// \param[in] offset offset of a character, or of the end of a text
+  /// \return the line and the column of the character, both zero if the
+  /// offset does not belong to any registered text
+  SourceLocation location(const uint32_t offset) const;
+
+private:
+  /// Registered program text
+  struct Source {
+    uint32_t base;
+    uint32_t length;
+    std::string filePath;
+    std::string text;
+    bool loaded;
+
+    /// Offsets of the line starts, relative to the beginning of the text and
+    /// computed up to the scanned length
+    std::vector<uint32_t> lineStarts;
+    uint32_t scannedLength;
+  };
+
+  /// \brief Register a program text of the given length
+  ///
+  /// \param[in] source program text, with its file path or its content
+  /// \param[in] length length of the program text
+  /// \return the offset of the first character of the text
+  uint32_t add(Source source, const size_t length);
+
+  /// \brief Compute the line starts of a text up to an offset
+  ///
+  /// \param[in] source registered program text
+  /// \param[in] relativeOffset offset relative to the beginning of the text
+  static void scanLines(Source &source, const uint32_t relativeOffset);
+
+  mutable std::mutex mutex_;
+  mutable std::vector<Source> sources_;
+  uint32_t nextOffset_ = 1;
+};
+
+} // namespace cool
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef COOL_CORE_THREAD_POOL_H
+#define COOL_CORE_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cool {
+
+/// Class that implements a fixed-size pool of worker threads
+///
+/// Tasks are executed in submission order by the first available worker. The
+/// destructor waits for all the submitted tasks to complete
+class ThreadPool {
+
+public:
+  ThreadPool() = delete;
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /// \brief Construct a pool and start its workers
+  ///
+  /// \param[in] threadsCount number of worker threads, at least one
+  explicit ThreadPool(const size_t threadsCount);
+
+  ~ThreadPool();
+
+  /// \brief Submit a task for execution
+  ///
+  /// \param[in] task callable object that takes no argument
+  /// \return a future holding the result of the task
+  template <typename TaskT>
+  std::future<std::result_of_t<TaskT()>> submit(TaskT task);
+
+  /// \brief Return the number of worker threads
+  ///
+  /// \return the number of worker threads
+  size_t threadsCount() const { return threads_.size(); }
+
+  /// \brief Return the default number of worker threads
+  ///
+  /// \return the number of hardware threads, or one if it cannot be determined
+  static size_t DefaultThreadsCount();
+
+private:
+  /// \brief Worker loop. Execute tasks until the pool is destroyed
+  void run();
+
+  std::vector<std::thread> threads_;
+  std::queue<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stopping_ = false;
+};
+
+} // namespace cool
+
+#include <cool/core/thread_pool.inl>
+
+#endif
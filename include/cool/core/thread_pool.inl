@@ -0,0 +1,22 @@
+#include <memory>
+#include <utility>
+
+namespace cool {
+
+template <typename TaskT>
+std::future<std::result_of_t<TaskT()>> ThreadPool::submit(TaskT task) {
+  typedef std::result_of_t<TaskT()> ResultT;
+
+  /// std::function requires a copyable target, packaged_task is move-only
+  auto packagedTask =
+      std::make_shared<std::packaged_task<ResultT()>>(std::move(task));
+  auto result = packagedTask->get_future();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push([packagedTask]() { (*packagedTask)(); });
+  }
+  condition_.notify_one();
+  return result;
+}
+
+} // namespace cool
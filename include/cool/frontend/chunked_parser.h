@@ -0,0 +1,190 @@
+#ifndef COOL_FRONTEND_CHUNKED_PARSER_H
+#define COOL_FRONTEND_CHUNKED_PARSER_H
+
+#include <cool/frontend/error_codes.h>
+#include <cool/frontend/source_splitter.h>
+#include <cool/ir/fwd.h>
+#include <cool/ir/symbol.h>
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cool {
+
+/// Forward declarations
+class LoggerCollection;
+class SourceManager;
+class ThreadPool;
+
+/// \brief Class that parses a program text split at the top-level class
+/// boundaries
+///
+/// Each chunk is scanned and parsed concurrently by its own Parser, starting
+/// at the location of the chunk in the text, which is registered once with the
+/// source manager. The classes of the chunks are
+/// merged in the order in which they appear, and the built-in classes are
+/// installed once. Should any chunk fail to parse, the whole text is parsed
+/// again serially, so that the error messages and their locations are the
+/// same of a serial parse
+///
+/// Alternatively, the program can be parsed one chunk at a time, keeping only
+/// the class signatures of each chunk. The expressions of a class are then
+/// parsed again from its chunk when needed, so that only the expressions of
+/// one chunk are alive at any time
+class ChunkedParser {
+
+public:
+  ChunkedParser() = delete;
+  ChunkedParser(ChunkedParser &&other) = default;
+
+  ~ChunkedParser() = default;
+
+  /// \brief Factory method to create a ChunkedParser object from file
+  ///
+  /// \warning This method will throw an assertion should an error occur
+  ///
+  /// \param[in] filePath path to input file
+  /// \param[in] minChunkLength minimum length of a chunk
+  /// \return a ChunkedParser object
+  static ChunkedParser
+  MakeFromFile(const std::string &filePath,
+               const size_t minChunkLength = DEFAULT_MIN_CHUNK_LENGTH);
+
+  /// \brief Factory method to create a ChunkedParser object from a string
+  ///
+  /// \param[in] inputString string to parse
+  /// \param[in] minChunkLength minimum length of a chunk
+  /// \return a ChunkedParser object
+  static ChunkedParser
+  MakeFromString(const std::string &inputString,
+                 const size_t minChunkLength = DEFAULT_MIN_CHUNK_LENGTH);
+
+  /// Default minimum length of a chunk, in bytes
+  static constexpr size_t DEFAULT_MIN_CHUNK_LENGTH = 64 * 1024;
+
+  /// \brief Return the number of chunks the program text was split into
+  ///
+  /// \return the number of chunks
+  size_t chunksCount() const { return chunks_.size(); }
+
+  /// \brief Return the last error code seen by the scanners / parsers
+  ///
+  /// \return the last error code seen by the scanners / parsers
+  FrontEndErrorCode lastErrorCode() const { return lastErrorCode_; }
+
+  /// \brief Parse the program
+  ///
+  /// \note parse should be invoked only once. On successive invocations, parse
+  /// will return nullptr. The calling thread must not be a worker of the pool
+  ///
+  /// \param[in] pool thread pool on which the chunks are parsed. If nullptr,
+  /// the program is parsed serially
+  /// \return a pointer to the ProgramNode if successful, nullptr otherwise
+  ProgramNodePtr parse(ThreadPool *pool);
+
+  /// \brief Parse the signatures of the classes of the program
+  ///
+  /// The chunks are parsed in order, and the expressions of each chunk are
+  /// freed before the next chunk is parsed. The log messages are replayed only
+  /// if all the chunks parse, otherwise the whole text is parsed again
+  /// serially, as in parse
+  ///
+  /// \note parseSignatures should be invoked only once, and not together with
+  /// parse. On successive invocations, parseSignatures will return nullptr
+  ///
+  /// \return a pointer to the ProgramNode whose classes have no expressions if
+  /// successful, nullptr otherwise
+  ProgramNodePtr parseSignatures();
+
+  /// \brief Check whether a class was found by parseSignatures
+  ///
+  /// \param[in] className class name
+  /// \return true if the program text defines the class, false otherwise
+  bool hasClass(const Symbol &className) const {
+    return classChunks_.count(className) > 0;
+  }
+
+  /// \brief Parse again the chunk that defines a class, expressions included
+  ///
+  /// \warning parseSignatures must have succeeded. The chunk is parsed without
+  /// loggers, since its messages were already logged
+  ///
+  /// \param[in] className class name
+  /// \param[out] classNode class node, owned by the returned program node
+  /// \return a pointer to the ProgramNode of the chunk, nullptr if the program
+  /// text does not define the class
+  ProgramNodePtr parseClass(const Symbol &className,
+                            ClassNode **classNode) const;
+
+  /// \brief Register a collection of loggers with the scanners / parsers
+  ///
+  /// \param[in] loggers loggers collection
+  void registerLoggers(std::shared_ptr<LoggerCollection> loggers);
+
+  /// \brief Set the source manager that converts the locations of the parsed
+  /// nodes to lines and columns. By default, the parser uses its own
+  ///
+  /// \note setSourceManager should be invoked before parse
+  ///
+  /// \param[in] sourceManager source manager
+  void setSourceManager(std::shared_ptr<SourceManager> sourceManager);
+
+  /// \brief Choose whether the chunks are scanned by the hand-written scanner
+  /// rather than by the Flex scanner
+  ///
+  /// \param[in] enabled true to scan the chunks with the hand-written scanner
+  void useFastScanner(const bool enabled) { useFastScanner_ = enabled; }
+
+  /// \brief Choose whether the AST nodes of each chunk are allocated in an
+  /// arena, which is the default, or on the heap
+  ///
+  /// \param[in] enabled true to allocate the nodes in an arena
+  void useNodeArena(const bool enabled) { useNodeArena_ = enabled; }
+
+private:
+  ChunkedParser(std::string text, const size_t minChunkLength);
+
+  /// \brief Register the program text with the source manager
+  ///
+  /// \return the location of the first character of the text
+  uint32_t registerText();
+
+  /// \brief Add the signatures of the classes of a chunk to a list of classes
+  ///
+  /// \param[in] program program node of the chunk
+  /// \param[in] chunkIndex index of the chunk
+  /// \param[out] classes list of classes
+  void addSignatures(const ProgramNode &program, const size_t chunkIndex,
+                     std::vector<ClassNodePtr> *classes);
+
+  /// \brief Parse a chunk of the program text
+  ///
+  /// \param[in] chunk chunk to parse
+  /// \param[in] startOffset location of the first character of the text
+  /// \param[in] loggers loggers collection
+  /// \param[out] errorCode last error code seen by the scanner / parser
+  /// \return a pointer to the ProgramNode if successful, nullptr otherwise
+  ProgramNodePtr parseChunk(const SourceChunk &chunk,
+                            const uint32_t startOffset,
+                            std::shared_ptr<LoggerCollection> loggers,
+                            FrontEndErrorCode *errorCode) const;
+
+  std::string text_;
+  std::string filePath_;
+  std::vector<SourceChunk> chunks_;
+  std::unordered_map<Symbol, size_t> classChunks_;
+  uint32_t startOffset_ = 0;
+  std::shared_ptr<LoggerCollection> loggers_ = nullptr;
+  std::shared_ptr<SourceManager> sourceManager_ = nullptr;
+  FrontEndErrorCode lastErrorCode_ = FrontEndErrorCode::NO_ERROR;
+  bool parseComplete_ = false;
+  bool useFastScanner_ = false;
+  bool useNodeArena_ = true;
+};
+
+} // namespace cool
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef COOL_FRONTEND_FAST_SCANNER_H
+#define COOL_FRONTEND_FAST_SCANNER_H
+
+#include <cool/frontend/scanner_extra.h>
+#include <cool/frontend/scanner_spec.h>
+
+#include <cstdlib>
+
+namespace cool {
+
+/// Forward declaration
+class LoggerCollection;
+
+/// \brief Hand-written scanner that produces the same tokens, semantic values,
+/// locations, error codes and log messages of the Flex scanner
+///
+/// The scanner works on an input held in memory. White spaces, comment bodies
+/// and string literals are skipped or copied in blocks of 16 or 32 characters
+/// when SSE2 or AVX2 instructions are available, and one character at a time
+/// otherwise. Locations are byte offsets from the start location of the extra
+/// state shared with the Flex scanner, where the scanner also keeps its error
+/// code
+class FastScanner {
+
+public:
+  FastScanner() = delete;
+  FastScanner(const FastScanner &) = delete;
+  FastScanner &operator=(const FastScanner &) = delete;
+
+  /// \brief Construct a scanner for an input held in memory
+  ///
+  /// \warning The input and the extra state must outlive the scanner
+  ///
+  /// \param[in] text input text
+  /// \param[in] length length of the input text
+  /// \param[in] extraState extra state of the scanner
+  FastScanner(const char *text, const size_t length, ExtraState *extraState);
+
+  ~FastScanner() = default;
+
+  /// \brief Scan the next token
+  ///
+  /// \param[out] yylval semantic value of the token
+  /// \param[out] yylloc location of the token
+  /// \param[in] logger loggers collection, can be nullptr
+  /// \return the token code, 0 at the end of the input
+  int lex(YYSTYPE *yylval, YYLTYPE *yylloc, LoggerCollection *logger);
+
+private:
+  /// \brief Skip white spaces and newlines
+  void skipWhiteSpaces();
+
+  /// \brief Skip an in-line comment, up to and including the newline
+  void skipInlineComment();
+
+  /// \brief Skip an out-of-line comment, whose opening characters have
+  /// already been consumed
+  ///
+  /// \param[in] logger loggers collection
+  /// \return false if the input ends before the comment is closed
+  bool skipComment(LoggerCollection *logger);
+
+  /// \brief Scan a string literal, whose opening quote has already been
+  /// consumed
+  ///
+  /// \param[out] yylval semantic value of the token
+  /// \param[out] yylloc location of the token
+  /// \param[in] logger loggers collection
+  /// \return the token code, 0 at the end of the input, or -1 if the string
+  /// is invalid and scanning must continue
+  int lexString(YYSTYPE *yylval, YYLTYPE *yylloc, LoggerCollection *logger);
+
+  /// \brief Scan an identifier or a keyword
+  ///
+  /// \param[out] yylval semantic value of the token
+  /// \param[out] yylloc location of the token
+  /// \param[in] logger loggers collection
+  /// \return the token code
+  int lexIdentifier(YYSTYPE *yylval, YYLTYPE *yylloc,
+                    LoggerCollection *logger);
+
+  /// \brief Scan an integer literal
+  ///
+  /// \param[out] yylval semantic value of the token
+  /// \param[out] yylloc location of the token
+  /// \param[in] logger loggers collection
+  /// \return the token code
+  int lexInteger(YYSTYPE *yylval, YYLTYPE *yylloc, LoggerCollection *logger);
+
+  /// \brief Consume a token and update its location
+  ///
+  /// \param[out] yylloc location of the token
+  /// \param[in] length length of the token
+  void consume(YYLTYPE *yylloc, const size_t length);
+
+  /// \brief Return the location of a character of the input
+  ///
+  /// \param[in] position pointer to the character, or to the end of the input
+  /// \return the location of the character
+  uint32_t offset(const char *position) const {
+    return extraState_->startOffset + (position - begin_);
+  }
+
+  const char *begin_;
+  const char *cursor_;
+  const char *end_;
+  ExtraState *extraState_;
+};
+
+} // namespace cool
+
+#endif
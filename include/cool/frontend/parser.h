@@ -4,6 +4,7 @@
 #include <cool/frontend/scanner_state.h>
 #include <cool/ir/fwd.h>
 
+#include <memory>
 #include <string>
 
 namespace cool {
@@ -33,6 +34,28 @@ public:
   /// \return a Parser object
   static Parser MakeFromFile(const std::string &filePath);
 
+  /// \brief Factory method to create a Parser object from a memory-mapped
+  /// file, scanned in place
+  ///
+  /// \warning This method will throw an assertion should an error occur
+  ///
+  /// \param[in] filePath path to input file
+  /// \return a Parser object
+  static Parser MakeFromMappedFile(const std::string &filePath);
+
+  /// \brief Factory method to create a Parser object that parses a buffer in
+  /// place, without copying it
+  ///
+  /// \warning The buffer must outlive the Parser object and must end with
+  /// ScannerState::SENTINEL_SIZE null bytes. This method will throw an
+  /// assertion should an error occur
+  ///
+  /// \param[in] buffer writable buffer to parse, terminated by the sentinel
+  /// bytes
+  /// \param[in] size buffer size, including the sentinel bytes
+  /// \return a Parser object
+  static Parser MakeFromBuffer(char *buffer, const size_t size);
+
   /// \brief Factory method to create a Parser object from a string
   ///
   /// \warning This method will throw an assertion should an error occur
@@ -57,12 +80,57 @@ public:
   /// \param[in] loggers loggers collection
   void registerLoggers(std::shared_ptr<LoggerCollection> loggers);
 
+  /// \brief Set the source manager that converts the locations of the parsed
+  /// nodes to lines and columns
+  ///
+  /// The input is registered with the source manager when parsed. By default,
+  /// each parser uses its own source manager. Parsers whose programs are
+  /// merged must share the same source manager
+  ///
+  /// \note setSourceManager should be invoked before parse
+  ///
+  /// \param[in] sourceManager source manager
+  void setSourceManager(std::shared_ptr<SourceManager> sourceManager);
+
+  /// \brief Set the location of the first character of the input
+  ///
+  /// Used when the input is a fragment of a text already registered with the
+  /// source manager, in which case the input is not registered again
+  ///
+  /// \note setStartOffset should be invoked before parse
+  ///
+  /// \param[in] startOffset location of the first character of the input
+  void setStartOffset(const uint32_t startOffset);
+
+  /// \brief Choose whether the AST nodes are allocated in an arena
+  ///
+  /// When enabled, which is the default, the nodes are allocated in an arena
+  /// owned by the program node and are freed in bulk together with it.
+  /// Otherwise each node is allocated on the heap and reference counted
+  ///
+  /// \param[in] enabled true to allocate the nodes in an arena
+  void useNodeArena(const bool enabled) { useNodeArena_ = enabled; }
+
+  /// \brief Choose whether the input is scanned by the hand-written scanner
+  /// rather than by the Flex scanner
+  ///
+  /// Both scanners produce the same tokens, locations and log messages. The
+  /// Flex scanner is the default
+  ///
+  /// \param[in] enabled true to scan the input with the hand-written scanner
+  void useFastScanner(const bool enabled) { useFastScanner_ = enabled; }
+
 private:
   Parser(std::unique_ptr<ScannerState> state);
 
   std::unique_ptr<ScannerState> state_;
   std::shared_ptr<LoggerCollection> loggers_ = nullptr;
+  std::shared_ptr<SourceManager> sourceManager_ = nullptr;
+  uint32_t startOffset_ = 0;
+  bool hasStartOffset_ = false;
   bool parseComplete_ = false;
+  bool useNodeArena_ = true;
+  bool useFastScanner_ = false;
 };
 
 } // namespace cool
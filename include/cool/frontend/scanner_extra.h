@@ -2,21 +2,45 @@
 #define COOL_FRONTEND_SCANNER_EXTRA_H
 
 #include <cool/core/logger_collection.h>
+#include <cool/core/source_manager.h>
 #include <cool/frontend/error_codes.h>
+#include <cool/frontend/semantic_value_pool.h>
 
 #include <cstdlib>
 #include <string>
 
 namespace cool {
 
+/// Forward declaration
+class FastScanner;
+
 struct ExtraState {
-  uint32_t currentLine = 1;
-  uint32_t currentColumn = 1;
+  /// Location of the first character of the input. The Flex scanner also
+  /// tracks the offsets of the last matched text and of the next character,
+  /// relative to the first character of the input
+  uint32_t startOffset = 0;
+  uint32_t matchOffset = 0;
+  uint32_t nextOffset = 0;
+
+  /// Source manager that converts the locations to lines and columns, if any
+  const SourceManager *sourceManager = nullptr;
 
   uint32_t openComments = 0;
   FrontEndErrorCode lastErrorCode = FrontEndErrorCode::NO_ERROR;
 
   std::string stringText;
+  SemanticValuePool semanticValues;
+
+  /// Hand-written scanner that replaces the Flex scanner, if selected
+  FastScanner *fastScanner = nullptr;
+
+  /// \brief Convert a location in the program text to a line and a column
+  ///
+  /// \param[in] offset location in the program text, as a byte offset
+  /// \return the line and the column, both zero if no source manager is set
+  SourceLocation location(const uint32_t offset) const {
+    return sourceManager ? sourceManager->location(offset) : SourceLocation();
+  }
 };
 
 } // namespace cool
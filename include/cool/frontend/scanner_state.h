@@ -12,8 +12,9 @@
 
 namespace cool {
 
-/// Forward declaration. Defined in implementation file
+/// Forward declarations
 class Buffer;
+class FastScanner;
 
 /// RAII class to store the state of a FLEX scanner
 class ScannerState {
@@ -41,6 +42,19 @@ public:
   static std::unique_ptr<ScannerState>
   MakeFromFile(const std::string &filePath);
 
+  /// \brief Factory method to create a ScannerState object from a
+  /// memory-mapped file
+  ///
+  /// The file is mapped privately and scanned in place, without being copied
+  /// into the scanner buffers
+  ///
+  /// \warning This method will throw an assertion should an error occur
+  ///
+  /// \param[in] filePath path to input file
+  /// \return a unique pointer to a ScannerState object
+  static std::unique_ptr<ScannerState>
+  MakeFromMappedFile(const std::string &filePath);
+
   /// \brief Factory method to create a ScannerState object from a string
   ///
   /// \warning This method will throw an assertion should an error occur
@@ -50,9 +64,55 @@ public:
   static std::unique_ptr<ScannerState>
   MakeFromString(const std::string &inputString);
 
+  /// \brief Factory method to create a ScannerState object that scans a
+  /// buffer in place, without copying it
+  ///
+  /// \warning The buffer must outlive the ScannerState object and must end
+  /// with SENTINEL_SIZE null bytes. The scanner temporarily writes into the
+  /// buffer while scanning, so the buffer must be writable. This method will
+  /// throw an assertion should an error occur
+  ///
+  /// \param[in] buffer buffer to parse, terminated by the sentinel bytes
+  /// \param[in] size buffer size, including the sentinel bytes
+  /// \return a unique pointer to a ScannerState object
+  static std::unique_ptr<ScannerState> MakeFromBuffer(char *buffer,
+                                                      const size_t size);
+
+  /// Number of null bytes that must terminate a buffer scanned in place
+  static constexpr size_t SENTINEL_SIZE = 2;
+
   /// \brief Reset the error code
   void resetErrorCode();
 
+  /// \brief Register the input with a source manager
+  ///
+  /// \param[in] sourceManager source manager
+  /// \return the location of the first character of the input
+  uint32_t registerInput(SourceManager *sourceManager) const;
+
+  /// \brief Set the source manager and the location of the first character of
+  /// the input
+  ///
+  /// The location is the one returned by registerInput, or a location inside
+  /// a registered text when the input is a fragment of that text, so that the
+  /// token locations refer to the whole text
+  ///
+  /// \param[in] sourceManager source manager that converts the locations
+  /// \param[in] startOffset location of the first character of the input
+  void setSource(std::shared_ptr<const SourceManager> sourceManager,
+                 const uint32_t startOffset);
+
+  /// \brief Choose whether the input is scanned by the hand-written scanner
+  /// rather than by the Flex scanner
+  ///
+  /// \note useFastScanner should be invoked before the first token is scanned
+  ///
+  /// \param[in] enabled true to scan the input with the hand-written scanner
+  void useFastScanner(const bool enabled);
+
+  /// \brief Release the semantic values left over by the parser
+  void clearSemanticValues();
+
 protected:
   /// Use factory method to create ScannerState objects
   ScannerState();
@@ -60,7 +120,9 @@ protected:
 private:
   yyscan_t state_;
   ExtraState extraState_;
+  std::shared_ptr<const SourceManager> sourceManager_;
   std::unique_ptr<Buffer> buffer_;
+  std::unique_ptr<FastScanner> fastScanner_;
 };
 
 } // namespace cool
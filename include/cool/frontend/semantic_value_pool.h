@@ -0,0 +1,67 @@
+#ifndef COOL_FRONTEND_SEMANTIC_VALUE_POOL_H
+#define COOL_FRONTEND_SEMANTIC_VALUE_POOL_H
+
+#include <cool/ir/fwd.h>
+
+#include <deque>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace cool {
+
+/// Class that stores the semantic values of the parser that are not trivially
+/// copyable, such as strings, AST nodes and lists of AST nodes
+///
+/// The parser stack only holds pointers to the values stored in the pool, so
+/// that shifting and reducing copy a single word rather than the whole value.
+/// Values are moved out of the pool when consumed by a grammar action, and
+/// their slots are recycled. Values that are never consumed, for instance
+/// because discarded during error recovery, are released by clear
+class SemanticValuePool {
+
+public:
+  SemanticValuePool() = default;
+  SemanticValuePool(const SemanticValuePool &) = delete;
+  SemanticValuePool &operator=(const SemanticValuePool &) = delete;
+
+  /// \brief Store a value in the pool
+  ///
+  /// \param[in] value value to store
+  /// \return a pointer to the stored value, valid until taken or cleared
+  template <typename T> T *make(T value);
+
+  /// \brief Move a value out of the pool and recycle its slot
+  ///
+  /// \param[in] slot pointer to the stored value, as returned by make
+  /// \return the stored value
+  template <typename T> T take(T *slot);
+
+  /// \brief Release all the values in the pool
+  void clear() { slots_ = SlotsTuple(); }
+
+private:
+  /// Values of a given type and slots available for reuse
+  template <typename T> struct Slots {
+    std::deque<T> values;
+    std::vector<T *> free;
+  };
+
+  typedef std::tuple<
+      Slots<std::string>, Slots<CaseBindingNodePtr>, Slots<ClassNodePtr>,
+      Slots<ExprNodePtr>, Slots<FormalNodePtr>, Slots<GenericAttributeNodePtr>,
+      Slots<LetBindingNodePtr>, Slots<std::vector<CaseBindingNodePtr>>,
+      Slots<std::vector<ClassNodePtr>>, Slots<std::vector<ExprNodePtr>>,
+      Slots<std::vector<FormalNodePtr>>,
+      Slots<std::vector<GenericAttributeNodePtr>>,
+      Slots<std::vector<LetBindingNodePtr>>>
+      SlotsTuple;
+
+  SlotsTuple slots_;
+};
+
+} // namespace cool
+
+#include <cool/frontend/semantic_value_pool.inl>
+
+#endif
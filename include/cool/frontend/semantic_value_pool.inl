@@ -0,0 +1,28 @@
+#include <utility>
+
+namespace cool {
+
+template <typename T> T *SemanticValuePool::make(T value) {
+  auto &slots = std::get<Slots<T>>(slots_);
+
+  /// Reuse a slot released by take if possible
+  if (!slots.free.empty()) {
+    T *slot = slots.free.back();
+    slots.free.pop_back();
+    *slot = std::move(value);
+    return slot;
+  }
+
+  /// Deque does not relocate its elements when growing
+  slots.values.push_back(std::move(value));
+  return &slots.values.back();
+}
+
+template <typename T> T SemanticValuePool::take(T *slot) {
+  T value = std::move(*slot);
+  *slot = T();
+  std::get<Slots<T>>(slots_).free.push_back(slot);
+  return value;
+}
+
+} // namespace cool
@@ -0,0 +1,35 @@
+#ifndef COOL_FRONTEND_SOURCE_SPLITTER_H
+#define COOL_FRONTEND_SOURCE_SPLITTER_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace cool {
+
+/// Contiguous range of a program text that can be parsed on its own
+struct SourceChunk {
+  size_t offset = 0;
+  size_t length = 0;
+  uint32_t line = 1;
+};
+
+/// \brief Split a program text at the top-level class boundaries
+///
+/// A chunk ends at the end of a line that follows the ';' terminating a class
+/// definition, so that each chunk starts at the first column of its first
+/// line. Comments, including nested ones, and strings are skipped. Should the
+/// text be unbalanced or contain an unterminated comment or string, the whole
+/// text is returned as a single chunk
+///
+/// \param[in] text program text
+/// \param[in] length length of the program text
+/// \param[in] minChunkLength minimum length of a chunk, except the last one
+/// \return the chunks, in the order in which they appear in the text
+std::vector<SourceChunk> SplitAtClassBoundaries(const char *text,
+                                                const size_t length,
+                                                const size_t minChunkLength);
+
+} // namespace cool
+
+#endif
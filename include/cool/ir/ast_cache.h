@@ -0,0 +1,80 @@
+#ifndef COOL_IR_AST_CACHE_H
+#define COOL_IR_AST_CACHE_H
+
+#include <cool/core/status.h>
+#include <cool/ir/fwd.h>
+#include <cool/ir/symbol.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cool {
+
+/// Forward declaration
+class ClassRegistry;
+
+/// \brief Class that serializes a type-checked program to a compact binary
+/// format, and loads it back without scanning, parsing and type-checking it
+///
+/// The cache stores the program classes, except for the built-in ones, with
+/// all their expressions and the expression types computed by the type-check
+/// pass. Since expression types refer to classes by ID, the cache also stores
+/// the class names in the order of their IDs, which must be reserved in the
+/// class registry before the loaded program is registered, see
+/// ClassRegistry::reserveClassIDs. The line starts of the program texts are
+/// stored too, so that the locations of the nodes can still be converted to
+/// lines.
+///
+/// All the values are stored as 32-bit words in the byte order of the host,
+/// so that a cache can be read in place from a memory-mapped file. Nodes are
+/// stored in preorder, each with a fixed-size header followed by its fields;
+/// identifiers and string literals are stored once and referred to by index.
+/// A cache written by a different version of the format is rejected
+class AstCache {
+
+public:
+  AstCache() = delete;
+
+  /// Version of the cache format
+  static constexpr uint32_t VERSION = 1;
+
+  /// \brief Serialize a program
+  ///
+  /// \warning The program must have been type-checked with the given registry
+  ///
+  /// \param[in] program program node
+  /// \param[in] registry class registry of the program
+  /// \param[out] ios output stream
+  /// \return Status::Ok() if successful, an error otherwise
+  static Status Write(const ProgramNode &program, const ClassRegistry &registry,
+                      std::ostream *ios);
+
+  /// \brief Load a program from a buffer
+  ///
+  /// The nodes of the program are allocated in an arena owned by the program,
+  /// which starts with the built-in classes. The program is given a source
+  /// manager that holds the line starts of the program texts
+  ///
+  /// \param[in] data pointer to the cache, aligned to a 32-bit word
+  /// \param[in] length length of the cache in bytes
+  /// \param[out] classNames class names, in the order of their IDs
+  /// \return the loaded program, nullptr if the cache is invalid
+  static ProgramNodePtr Read(const char *data, const size_t length,
+                             std::vector<Symbol> *classNames);
+
+  /// \brief Load a program from a file, which is memory-mapped
+  ///
+  /// \param[in] filePath path to the cache file
+  /// \param[out] classNames class names, in the order of their IDs
+  /// \return the loaded program, nullptr if the file cannot be read or the
+  /// cache is invalid
+  static ProgramNodePtr ReadFile(const std::string &filePath,
+                                 std::vector<Symbol> *classNames);
+};
+
+} // namespace cool
+
+#endif
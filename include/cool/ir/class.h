@@ -1,10 +1,12 @@
 #ifndef COOL_IR_CLASS_H
 #define COOL_IR_CLASS_H
 
+#include <cool/core/source_manager.h>
 #include <cool/core/status.h>
 #include <cool/ir/common.h>
 #include <cool/ir/fwd.h>
 #include <cool/ir/node.h>
+#include <cool/ir/symbol.h>
 #include <cool/ir/visitable.h>
 
 #include <memory>
@@ -25,8 +27,34 @@ public:
   /// Factory method to create a class node
   ///
   /// classes vector of shared pointers to the nodes for the program classes
+  /// \param[in] arena arena that owns the nodes of the program, if any
   /// \return a shared pointer to the new program node
-  static ProgramNodePtr MakeProgramNode(std::vector<ClassNodePtr> classes);
+  static ProgramNodePtr
+  MakeProgramNode(std::vector<ClassNodePtr> classes,
+                  std::shared_ptr<NodeArena> arena = nullptr);
+
+  /// Factory method to merge programs parsed separately into a single program
+  ///
+  /// The built-in classes of the programs are dropped, since programs parsed
+  /// from empty inputs have none, and the shared built-in classes are
+  /// installed once, followed by the classes of each program in order. The
+  /// merged program shares the node arenas of the programs it merges. The
+  /// programs must have been parsed with the same source manager, which the
+  /// merged program shares too
+  ///
+  /// \param[in] programs programs to merge, at least one
+  /// \return a shared pointer to the merged program node
+  static ProgramNodePtr
+  MakeMergedProgramNode(const std::vector<ProgramNodePtr> &programs);
+
+  /// Return the nodes of the built-in classes: Object, Int, Bool, IO and
+  /// String, in this order
+  ///
+  /// The nodes are allocated on the heap on first use and shared by all the
+  /// programs, which must not modify them
+  ///
+  /// \return a vector of shared pointers to the built-in class nodes
+  static const std::vector<ClassNodePtr> &BuiltInClasses();
 
   /// Get the nodes of the program classes
   ///
@@ -50,11 +78,47 @@ public:
   /// \return the program file name
   std::string fileName() const { return programFileName_; }
 
+  /// Return the arena that owns the nodes of the program. For merged
+  /// programs, this is the arena of the first program
+  ///
+  /// \return a shared pointer to the node arena, nullptr if the nodes of the
+  /// program are allocated on the heap
+  std::shared_ptr<NodeArena> nodeArena() const {
+    return arenas_.empty() ? nullptr : arenas_.front();
+  }
+
+  /// Return the arenas that own the nodes of the program
+  ///
+  /// \return a vector of shared pointers to the node arenas
+  const std::vector<std::shared_ptr<NodeArena>> &nodeArenas() const {
+    return arenas_;
+  }
+
+  /// Set the source manager that maps the locations of the program nodes to
+  /// lines and columns
+  ///
+  /// \param[in] sourceManager source manager
+  void setSourceManager(std::shared_ptr<const SourceManager> sourceManager) {
+    sourceManager_ = std::move(sourceManager);
+  }
+
+  /// Return the source manager that maps the locations of the program nodes to
+  /// lines and columns
+  ///
+  /// \return a shared pointer to the source manager, nullptr if none was set
+  std::shared_ptr<const SourceManager> sourceManager() const {
+    return sourceManager_;
+  }
+
 private:
-  ProgramNode(std::vector<ClassNodePtr> classes);
+  ProgramNode(std::vector<ClassNodePtr> classes,
+              std::vector<std::shared_ptr<NodeArena>> arenas);
 
+  /// Declared first so that the nodes are destroyed after any reference to them
+  std::vector<std::shared_ptr<NodeArena>> arenas_;
   std::vector<ClassNodePtr> classes_;
   std::string programFileName_;
+  std::shared_ptr<const SourceManager> sourceManager_;
 };
 
 /// Class for a node representing a COOL class
@@ -72,14 +136,24 @@ public:
   /// \param[in] parentClassName parent class name
   /// \param[in] genericAttributes list of shared pointers to attribute nodes
   /// \param[in] builtIn built-in class parameter
-  /// \param[in] lloc line location
-  /// \param[in] cloc character
-  /// location \return a shared pointer to the new class node
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
+  /// \return a shared pointer to the new class node
   static ClassNodePtr
-  MakeClassNode(const std::string &className,
-                const std::string &parentClassName,
+  MakeClassNode(const Symbol &className, const Symbol &parentClassName,
                 std::vector<GenericAttributeNodePtr> genericAttributes,
-                const bool builtIn, const uint32_t lloc, const uint32_t cloc);
+                const bool builtIn, const uint32_t loc,
+                NodeArena *arena = nullptr);
+
+  /// Factory method to copy the signature of a class: its name, its parent
+  /// class, and its attributes and methods without their expressions
+  ///
+  /// The copy is allocated on the heap, so that it outlives the node arena of
+  /// the class
+  ///
+  /// \param[in] node class node
+  /// \return a shared pointer to the new class node
+  static ClassNodePtr MakeSignatureNode(const ClassNode &node);
 
   /// Query whether the class is a built-in class or not
   ///
@@ -89,12 +163,12 @@ public:
   /// Get the class name
   ///
   /// \return the class name
-  const std::string &className() const { return className_; }
+  const Symbol &className() const { return className_; }
 
   /// Get the parent class name
   ///
   /// \return the parent class name
-  const std::string &parentClassName() const { return parentClassName_; };
+  const Symbol &parentClassName() const { return parentClassName_; };
 
   /// Check whether the class inherits from a parent class
   ///
@@ -113,16 +187,25 @@ public:
   /// \return a vector of shared pointers to the class method nodes
   const std::vector<MethodNodePtr> &methods() const { return methods_; }
 
+  /// Release the method bodies and the attribute initialization expressions,
+  /// keeping the class signature
+  ///
+  /// \warning The class expressions must not be in use anymore. Built-in
+  /// classes, which are shared by all programs, must not be released
+  void releaseExprs();
+
 private:
-  ClassNode(const std::string &className, const std::string &parentClassName,
+  friend class NodeArena;
+
+  ClassNode(const Symbol &className, const Symbol &parentClassName,
             std::vector<AttributeNodePtr> attributes,
             std::vector<MethodNodePtr> methods, const bool builtIn,
-            const uint32_t lloc, const uint32_t cloc);
+            const uint32_t loc);
 
   const bool builtIn_;
 
-  const std::string className_;
-  const std::string parentClassName_;
+  const Symbol className_;
+  const Symbol parentClassName_;
 
   const std::vector<AttributeNodePtr> attributes_;
   const std::vector<MethodNodePtr> methods_;
@@ -133,8 +216,7 @@ class GenericAttributeNode : public Node {
 
 public:
   GenericAttributeNode() = delete;
-  GenericAttributeNode(const uint32_t lloc, const uint32_t cloc)
-      : Node(lloc, cloc) {}
+  GenericAttributeNode(const uint32_t loc) : Node(loc) {}
   ~GenericAttributeNode() override = default;
 };
 
@@ -147,25 +229,41 @@ public:
   AttributeNode() = delete;
   ~AttributeNode() final override = default;
 
-  static AttributeNodePtr MakeAttributeNode(const std::string &id,
-                                            const std::string &typeName,
+  static AttributeNodePtr MakeAttributeNode(const Symbol &id,
+                                            const Symbol &typeName,
                                             ExprNodePtr initExpr,
-                                            const uint32_t lloc,
-                                            const uint32_t cloc);
+                                            const uint32_t loc,
+                                            NodeArena *arena = nullptr);
+
+  const Symbol &id() const { return id_; }
 
-  const std::string &id() const { return id_; }
+  ExprNode *initExpr() const { return initExpr_.get(); }
 
-  ExprNodePtr initExpr() const { return initExpr_; }
+  const Symbol &typeName() const { return typeName_; }
 
-  const std::string &typeName() const { return typeName_; }
+  /// Release the initialization expression of the attribute
+  void releaseInitExpr() { initExpr_.reset(); }
+
+  /// Return the position of the attribute in the object
+  ///
+  /// \return the position of the attribute, -1 if not resolved
+  int32_t position() const { return position_; }
+
+  /// Set the position of the attribute in the object
+  ///
+  /// \param[in] position position of the attribute
+  void setPosition(const int32_t position) { position_ = position; }
 
 private:
-  AttributeNode(const std::string &id, const std::string &typeName,
-                ExprNodePtr initExpr, const uint32_t lloc, const uint32_t cloc);
+  friend class NodeArena;
 
-  const std::string id_;
-  const std::string typeName_;
-  const ExprNodePtr initExpr_;
+  AttributeNode(const Symbol &id, const Symbol &typeName, ExprNodePtr initExpr,
+                const uint32_t loc);
+
+  const Symbol id_;
+  const Symbol typeName_;
+  ExprNodePtr initExpr_;
+  int32_t position_ = -1;
 };
 
 class MethodNode : public Visitable<GenericAttributeNode, MethodNode> {
@@ -176,29 +274,34 @@ public:
   MethodNode() = delete;
   ~MethodNode() final override = default;
 
-  static MethodNodePtr MakeMethodNode(const std::string &id,
-                                      const std::string &returnTypeName,
+  static MethodNodePtr MakeMethodNode(const Symbol &id,
+                                      const Symbol &returnTypeName,
                                       std::vector<FormalNodePtr> arguments,
-                                      ExprNodePtr body, const uint32_t lloc,
-                                      const uint32_t cloc);
+                                      ExprNodePtr body, const uint32_t loc,
+                                      NodeArena *arena = nullptr);
 
   const std::vector<FormalNodePtr> &arguments() const { return arguments_; }
 
-  ExprNodePtr body() const { return body_; }
+  ExprNode *body() const { return body_.get(); }
+
+  const Symbol &id() const { return id_; }
 
-  const std::string &id() const { return id_; }
+  const Symbol &returnTypeName() const { return returnTypeName_; }
 
-  const std::string &returnTypeName() const { return returnTypeName_; }
+  /// Release the body of the method
+  void releaseBody() { body_.reset(); }
 
 private:
-  MethodNode(const std::string &id, const std::string &returnTypeName,
+  friend class NodeArena;
+
+  MethodNode(const Symbol &id, const Symbol &returnTypeName,
              std::vector<FormalNodePtr> arguments, ExprNodePtr body,
-             const uint32_t lloc, const uint32_t cloc);
+             const uint32_t loc);
 
-  const std::string id_;
-  const std::string returnTypeName_;
+  const Symbol id_;
+  const Symbol returnTypeName_;
   const std::vector<FormalNodePtr> arguments_;
-  const ExprNodePtr body_;
+  ExprNodePtr body_;
 };
 
 class FormalNode : public Visitable<Node, FormalNode> {
@@ -209,20 +312,21 @@ public:
   FormalNode() = delete;
   ~FormalNode() final override = default;
 
-  static FormalNodePtr MakeFormalNode(const std::string &id,
-                                      const std::string &typeName,
-                                      const uint32_t lloc, const uint32_t cloc);
+  static FormalNodePtr MakeFormalNode(const Symbol &id, const Symbol &typeName,
+                                      const uint32_t loc,
+                                      NodeArena *arena = nullptr);
 
-  const std::string &id() const { return id_; }
+  const Symbol &id() const { return id_; }
 
-  const std::string &typeName() const { return typeName_; }
+  const Symbol &typeName() const { return typeName_; }
 
 private:
-  FormalNode(const std::string &id, const std::string &typeName,
-             const uint32_t lloc, const uint32_t cloc);
+  friend class NodeArena;
+
+  FormalNode(const Symbol &id, const Symbol &typeName, const uint32_t loc);
 
-  const std::string id_;
-  const std::string typeName_;
+  const Symbol id_;
+  const Symbol typeName_;
 };
 
 } // namespace cool
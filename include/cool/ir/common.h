@@ -14,6 +14,24 @@ struct ExprType {
   bool isSelf = false;
 };
 
+/// Storage kinds of the variables an identifier can refer to
+enum class BindingKind : uint8_t {
+  Unresolved,
+  Self,
+  Attribute,
+  Argument,
+  Local
+};
+
+/// \brief Class representing the storage of the variable an identifier refers
+/// to. The index of an attribute is its position in the object, the index of
+/// an argument is its position in the stack frame, and the index of a let or
+/// case variable numbers the variable within its method or attribute
+struct Binding {
+  BindingKind kind = BindingKind::Unresolved;
+  int32_t index = -1;
+};
+
 /// Equality operator between ExprType objects
 ///
 /// \param[in] lhs first object to compare
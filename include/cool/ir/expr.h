@@ -4,6 +4,7 @@
 #include <cool/ir/common.h>
 #include <cool/ir/fwd.h>
 #include <cool/ir/node.h>
+#include <cool/ir/symbol.h>
 #include <cool/ir/visitable.h>
 
 #include <cstdlib>
@@ -29,7 +30,7 @@ public:
   void setType(const ExprType &type) { type_ = type; }
 
 protected:
-  ExprNode(const uint32_t lloc, const uint32_t cloc);
+  ExprNode(const uint32_t loc);
 
 private:
   ExprType type_;
@@ -48,30 +49,41 @@ public:
   ///
   /// \param[in] id identifier name
   /// \param[in] rhsExpr shared pointer to right hand side expression node
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new assignment expression node
-  static AssignmentExprNodePtr MakeAssignmentExprNode(const std::string &id,
-                                                      ExprNodePtr rhsExpr,
-                                                      const uint32_t lloc,
-                                                      const uint32_t cloc);
+  static AssignmentExprNodePtr
+  MakeAssignmentExprNode(const Symbol &id, ExprNodePtr rhsExpr,
+                         const uint32_t loc, NodeArena *arena = nullptr);
 
   /// Get the identifier name in the assignment expression
   ///
   /// \return the identifier name in the assignment expression
-  const std::string id() const { return id_; }
+  const Symbol &id() const { return id_; }
 
   /// Get the right hand side subexpression in the assignment expression
   ///
-  /// \return a shared pointer to right hand side subexpression
-  ExprNodePtr rhsExpr() const { return rhsExpr_; }
+  /// \return a pointer to right hand side subexpression
+  ExprNode *rhsExpr() const { return rhsExpr_.get(); }
+
+  /// Return the storage of the variable the identifier refers to
+  ///
+  /// \return the binding of the identifier
+  const Binding &binding() const { return binding_; }
+
+  /// Set the storage of the variable the identifier refers to
+  ///
+  /// \param[in] binding binding of the identifier
+  void setBinding(const Binding &binding) { binding_ = binding; }
 
 private:
-  AssignmentExprNode(const std::string &id, ExprNodePtr rhsExpr,
-                     const uint32_t lloc, const uint32_t cloc);
+  friend class NodeArena;
+
+  AssignmentExprNode(const Symbol &id, ExprNodePtr rhsExpr, const uint32_t loc);
 
-  const std::string id_;
+  const Symbol id_;
   const ExprNodePtr rhsExpr_;
+  Binding binding_;
 };
 
 /// Base class for a node representing a binary expression in the AST
@@ -89,18 +101,18 @@ public:
   /// \param[in] lhsExpr shared pointer to left operand of binary operator
   /// \param[in] rhsExpr shared pointer to right operand of binary operator
   /// \param[in] opID operator ID
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new binary expression node
   static std::shared_ptr<BinaryExprNode>
   MakeBinaryExprNode(ExprNodePtr lhsExpr, ExprNodePtr rhsExpr,
-                     const OperatorT opID, const uint32_t lloc,
-                     const uint32_t cloc);
+                     const OperatorT opID, const uint32_t loc,
+                     NodeArena *arena = nullptr);
 
   /// Get the node of the subexpression representing the left operand
   ///
-  /// \return a shared pointer to the left subexpression node
-  ExprNodePtr lhsExpr() const { return lhsExpr_; }
+  /// \return a pointer to the left subexpression node
+  ExprNode *lhsExpr() const { return lhsExpr_.get(); }
 
   /// Get the operator ID
   ///
@@ -109,12 +121,14 @@ public:
 
   /// Get the node of the subexpression representing the right operand
   ///
-  /// \return a shared pointer to the right subexpression node
-  ExprNodePtr rhsExpr() const { return rhsExpr_; }
+  /// \return a pointer to the right subexpression node
+  ExprNode *rhsExpr() const { return rhsExpr_.get(); }
 
 private:
+  friend class NodeArena;
+
   BinaryExprNode(ExprNodePtr lhs, ExprNodePtr rhs, const OperatorT opID,
-                 const uint32_t lloc, const uint32_t cloc);
+                 const uint32_t loc);
 
   const OperatorT opID_;
   const ExprNodePtr lhsExpr_;
@@ -133,12 +147,12 @@ public:
   /// Factory method to create a node for a boolean expression node
   ///
   /// \param[in] value value of boolean expression
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new literal expression node
   static BooleanExprNodePtr MakeBooleanExprNode(const bool value,
-                                                const uint32_t lloc,
-                                                const uint32_t cloc);
+                                                const uint32_t loc,
+                                                NodeArena *arena = nullptr);
 
   /// Get the value of the boolean expression
   ///
@@ -146,7 +160,9 @@ public:
   bool value() const { return value_; }
 
 private:
-  BooleanExprNode(const bool value, const uint32_t lloc, const uint32_t cloc);
+  friend class NodeArena;
+
+  BooleanExprNode(const bool value, const uint32_t loc);
 
   const bool value_;
 };
@@ -163,19 +179,20 @@ public:
   /// Factory method to create a node for a block expression
   ///
   /// \param[in] exprs expressions in the block node
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new block expression node
   static BlockExprNodePtr MakeBlockExprNode(std::vector<ExprNodePtr> exprs,
-                                            const uint32_t lloc,
-                                            const uint32_t cloc);
+                                            const uint32_t loc,
+                                            NodeArena *arena = nullptr);
 
   /// Get the nodes of the subexpressions in the block
   const std::vector<ExprNodePtr> &exprs() const { return exprs_; }
 
 private:
-  BlockExprNode(std::vector<ExprNodePtr> exprs, const uint32_t lloc,
-                const uint32_t cloc);
+  friend class NodeArena;
+
+  BlockExprNode(std::vector<ExprNodePtr> exprs, const uint32_t loc);
 
   const std::vector<ExprNodePtr> exprs_;
 };
@@ -194,14 +211,14 @@ public:
   /// \param[in] id identifier name
   /// \param[in] typeName identifier type name
   /// \param[in] expr pointer to expression
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new case node
-  static CaseBindingNodePtr MakeCaseBindingNode(const std::string &id,
-                                                const std::string &typeName,
+  static CaseBindingNodePtr MakeCaseBindingNode(const Symbol &id,
+                                                const Symbol &typeName,
                                                 ExprNodePtr expr,
-                                                const uint32_t lloc,
-                                                const uint32_t cloc);
+                                                const uint32_t loc,
+                                                NodeArena *arena = nullptr);
 
   /// Return the binding label
   ///
@@ -211,17 +228,17 @@ public:
   /// Return the identifier name
   ///
   /// \return the identifier name
-  const std::string &id() const { return id_; }
+  const Symbol &id() const { return id_; }
 
   /// Return the identifier type name
   ///
   /// \return the identifier type anem
-  const std::string &typeName() const { return typeName_; }
+  const Symbol &typeName() const { return typeName_; }
 
   /// Return a pointer to the expression node
   ///
-  /// \return a shared pointer to the expression node
-  ExprNodePtr expr() const { return expr_; }
+  /// \return a pointer to the expression node
+  ExprNode *expr() const { return expr_.get(); }
 
   /// Set the binding label
   ///
@@ -230,15 +247,28 @@ public:
     bindingLabel_ = bindingLabel;
   }
 
+  /// Return the storage of the variable introduced by the binding
+  ///
+  /// \return the binding of the variable
+  const Binding &binding() const { return binding_; }
+
+  /// Set the storage of the variable introduced by the binding
+  ///
+  /// \param[in] binding binding of the variable
+  void setBinding(const Binding &binding) { binding_ = binding; }
+
 private:
-  CaseBindingNode(const std::string &id, const std::string &typeName,
-                  ExprNodePtr expr, const uint32_t lloc, const uint32_t cloc);
+  friend class NodeArena;
+
+  CaseBindingNode(const Symbol &id, const Symbol &typeName, ExprNodePtr expr,
+                  const uint32_t loc);
 
-  const std::string id_;
-  const std::string typeName_;
+  const Symbol id_;
+  const Symbol typeName_;
 
   std::string bindingLabel_;
   const ExprNodePtr expr_;
+  Binding binding_;
 };
 
 /// Class for a node representing a case expression
@@ -254,12 +284,12 @@ public:
   ///
   /// \param[in] cases cases in case expression
   /// \param[in] expr shared pointer to case expression
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new case expression node
   static CaseExprNodePtr MakeCaseExprNode(std::vector<CaseBindingNodePtr> cases,
-                                          ExprNodePtr expr, const uint32_t lloc,
-                                          const uint32_t cloc);
+                                          ExprNodePtr expr, const uint32_t loc,
+                                          NodeArena *arena = nullptr);
 
   /// Return a list of pointers to the case nodes
   ///
@@ -267,11 +297,13 @@ public:
   const std::vector<CaseBindingNodePtr> &cases() const { return cases_; }
 
   /// Return a pointer to the expression in the case statement
-  std::shared_ptr<ExprNode> expr() const { return expr_; }
+  ExprNode *expr() const { return expr_.get(); }
 
 private:
+  friend class NodeArena;
+
   CaseExprNode(std::vector<CaseBindingNodePtr> cases, ExprNodePtr expr,
-               const uint32_t lloc, const uint32_t cloc);
+               const uint32_t loc);
 
   const std::vector<CaseBindingNodePtr> cases_;
   const ExprNodePtr expr_;
@@ -289,21 +321,34 @@ public:
   /// Factory method to create a node for an id expression
   ///
   /// \param[in] id identifier name
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new id expression node
-  static IdExprNodePtr MakeIdExprNode(const std::string &id,
-                                      const uint32_t lloc, const uint32_t cloc);
+  static IdExprNodePtr MakeIdExprNode(const Symbol &id, const uint32_t loc,
+                                      NodeArena *arena = nullptr);
 
   /// Get the identifier name
   ///
   /// \return the identifier name
-  const std::string &id() const { return id_; }
+  const Symbol &id() const { return id_; }
+
+  /// Return the storage of the variable the identifier refers to
+  ///
+  /// \return the binding of the identifier
+  const Binding &binding() const { return binding_; }
+
+  /// Set the storage of the variable the identifier refers to
+  ///
+  /// \param[in] binding binding of the identifier
+  void setBinding(const Binding &binding) { binding_ = binding; }
 
 private:
-  IdExprNode(const std::string &id, const uint32_t lloc, const uint32_t cloc);
+  friend class NodeArena;
 
-  const std::string id_;
+  IdExprNode(const Symbol &id, const uint32_t loc);
+
+  const Symbol id_;
+  Binding binding_;
 };
 
 /// Class for a node representing an if expression
@@ -320,31 +365,33 @@ public:
   /// \param[in] ifExpr shared pointer to if expression node
   /// \param[in] thenExpr shared pointer to then expression node
   /// \param[in] elseExpr shared pointer to else expression node
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new if expression node
   static IfExprNodePtr MakeIfExprNode(ExprNodePtr ifExpr, ExprNodePtr thenExpr,
-                                      ExprNodePtr elseExpr, const uint32_t lloc,
-                                      const uint32_t cloc);
+                                      ExprNodePtr elseExpr, const uint32_t loc,
+                                      NodeArena *arena = nullptr);
 
   /// Get the node of the subexpression representing the if condition
   ///
-  /// \return a shared pointer to the if subexpression node
-  ExprNodePtr ifExpr() const { return ifExpr_; }
+  /// \return a pointer to the if subexpression node
+  ExprNode *ifExpr() const { return ifExpr_.get(); }
 
   /// Get the node of the subexpression representing the then expression
   ///
-  /// \return a shared pointer to the then subexpression node
-  ExprNodePtr thenExpr() const { return thenExpr_; }
+  /// \return a pointer to the then subexpression node
+  ExprNode *thenExpr() const { return thenExpr_.get(); }
 
   /// Get the node of the subexpression representing the else expression
   ///
-  /// \return a shared pointer to the else subexpression node
-  ExprNodePtr elseExpr() const { return elseExpr_; }
+  /// \return a pointer to the else subexpression node
+  ExprNode *elseExpr() const { return elseExpr_.get(); }
 
 private:
+  friend class NodeArena;
+
   IfExprNode(ExprNodePtr ifExpr, ExprNodePtr thenExpr, ExprNodePtr elseExpr,
-             const uint32_t lloc, const uint32_t cloc);
+             const uint32_t loc);
 
   const ExprNodePtr ifExpr_;
   const ExprNodePtr thenExpr_;
@@ -365,14 +412,14 @@ public:
   /// \param[in] id identifier name
   /// \param[in] typeName identifier type name
   /// \param[in] expr shared pointer to identifier initialization expression
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new block expression node
-  static LetBindingNodePtr MakeLetBindingNode(const std::string &id,
-                                              const std::string &typeName,
+  static LetBindingNodePtr MakeLetBindingNode(const Symbol &id,
+                                              const Symbol &typeName,
                                               ExprNodePtr expr,
-                                              const uint32_t lloc,
-                                              const uint32_t cloc);
+                                              const uint32_t loc,
+                                              NodeArena *arena = nullptr);
 
   /// Return whether the identifier has an initialization expression
   ///
@@ -382,25 +429,38 @@ public:
   /// Get the identifier name
   ///
   /// \return the identifier name
-  const std::string &id() const { return id_; }
+  const Symbol &id() const { return id_; }
 
   /// Get a pointer to the identifier initialization expression node
   ///
   /// \return a pointer to the node for the identifier initialization expression
-  ExprNodePtr expr() const { return expr_; }
+  ExprNode *expr() const { return expr_.get(); }
 
   /// Get the identifier type name
   ///
   /// \return the identifier type name
-  const std::string &typeName() const { return typeName_; }
+  const Symbol &typeName() const { return typeName_; }
+
+  /// Return the storage of the variable introduced by the binding
+  ///
+  /// \return the binding of the variable
+  const Binding &binding() const { return binding_; }
+
+  /// Set the storage of the variable introduced by the binding
+  ///
+  /// \param[in] binding binding of the variable
+  void setBinding(const Binding &binding) { binding_ = binding; }
 
 private:
-  LetBindingNode(const std::string &id, const std::string &typeName,
-                 ExprNodePtr expr, const uint32_t lloc, const uint32_t cloc);
+  friend class NodeArena;
+
+  LetBindingNode(const Symbol &id, const Symbol &typeName, ExprNodePtr expr,
+                 const uint32_t loc);
 
-  const std::string id_;
-  const std::string typeName_;
+  const Symbol id_;
+  const Symbol typeName_;
   const ExprNodePtr expr_;
+  Binding binding_;
 };
 
 /// Class for a node representing a let expression
@@ -416,12 +476,12 @@ public:
   ///
   /// \param[in] bindings list of pointers to the let bindings
   /// \param[in] expr shared pointer to let expression
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new let expression node
   static LetExprNodePtr MakeLetExprNode(std::vector<LetBindingNodePtr> bindings,
-                                        ExprNodePtr expr, const uint32_t lloc,
-                                        const uint32_t cloc);
+                                        ExprNodePtr expr, const uint32_t loc,
+                                        NodeArena *arena = nullptr);
 
   /// Return a list of pointers to the let bindings
   ///
@@ -430,13 +490,15 @@ public:
 
   /// Return a pointer to the expression in the let construct
   ///
-  /// \return a shared pointer to the node for the expression in the let
+  /// \return a pointer to the node for the expression in the let
   /// construct
-  ExprNodePtr expr() const { return expr_; }
+  ExprNode *expr() const { return expr_.get(); }
 
 private:
+  friend class NodeArena;
+
   LetExprNode(std::vector<LetBindingNodePtr> bindings, ExprNodePtr expr,
-              const uint32_t lloc, const uint32_t cloc);
+              const uint32_t loc);
 
   const std::vector<LetBindingNodePtr> bindings_;
   const ExprNodePtr expr_;
@@ -455,17 +517,20 @@ public:
   /// Factory method to create a node for a literal expression node
   ///
   /// \param[in] value literal expression value
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new literal expression node
   static std::shared_ptr<LiteralExprNode>
-  MakeLiteralExprNode(const T &value, const uint32_t lloc, const uint32_t cloc);
+  MakeLiteralExprNode(const T &value, const uint32_t loc,
+                      NodeArena *arena = nullptr);
 
   /// Get the value stored by the literal node
   const T &value() const { return value_; };
 
 private:
-  LiteralExprNode(const T &value, const uint32_t lloc, const uint32_t cloc);
+  friend class NodeArena;
+
+  LiteralExprNode(const T &value, const uint32_t loc);
   const T value_;
 };
 
@@ -481,23 +546,24 @@ public:
   /// Factory method to create a node for a new expression
   ///
   /// \param[in] typeName type of new object
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new block expression node
-  static NewExprNodePtr MakeNewExprNode(const std::string &typeName,
-                                        const uint32_t lloc,
-                                        const uint32_t cloc);
+  static NewExprNodePtr MakeNewExprNode(const Symbol &typeName,
+                                        const uint32_t loc,
+                                        NodeArena *arena = nullptr);
 
   /// Get the type name of the new object
   ///
   /// \return the type name of the new object
-  const std::string &typeName() const { return typeName_; }
+  const Symbol &typeName() const { return typeName_; }
 
 private:
-  NewExprNode(const std::string &typeName, const uint32_t lloc,
-              const uint32_t cloc);
+  friend class NodeArena;
+
+  NewExprNode(const Symbol &typeName, const uint32_t loc);
 
-  std::string typeName_;
+  Symbol typeName_;
 };
 
 /// Base class for a node representing a unary expression in the AST
@@ -513,17 +579,17 @@ public:
   ///
   /// \param[in] expr shared pointer to operand of unary operator
   /// \param[in] opID unary operation identifier
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new unary expression node
   static UnaryExprNodePtr MakeUnaryExprNode(ExprNodePtr expr, UnaryOpID opID,
-                                            const uint32_t lloc,
-                                            const uint32_t cloc);
+                                            const uint32_t loc,
+                                            NodeArena *arena = nullptr);
 
   /// Get the node of the subexpression representing the operand
   ///
-  /// \return a shared pointer to the subexpression node
-  ExprNodePtr expr() const { return expr_; }
+  /// \return a pointer to the subexpression node
+  ExprNode *expr() const { return expr_.get(); }
 
   /// Get the operation ID
   ///
@@ -531,8 +597,9 @@ public:
   UnaryOpID opID() const { return opID_; }
 
 private:
-  UnaryExprNode(ExprNodePtr expr, UnaryOpID opID, const uint32_t lloc,
-                const uint32_t cloc);
+  friend class NodeArena;
+
+  UnaryExprNode(ExprNodePtr expr, UnaryOpID opID, const uint32_t loc);
 
   UnaryOpID opID_;
   const ExprNodePtr expr_;
@@ -551,27 +618,28 @@ public:
   ///
   /// \param[in] loopCond shared pointer to expression for the loop condition
   /// \param[in] loopBody shared pointer to expression for the loop body
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the new while expression node
   static WhileExprNodePtr MakeWhileExprNode(ExprNodePtr loopCond,
                                             ExprNodePtr loopBody,
-                                            const uint32_t lloc,
-                                            const uint32_t cloc);
+                                            const uint32_t loc,
+                                            NodeArena *arena = nullptr);
 
   /// Get the node of the subexpression representing the loop condition
   ///
-  /// \return a shared pointer to the node representing the loop condition
-  ExprNodePtr loopCond() const { return loopCond_; }
+  /// \return a pointer to the node representing the loop condition
+  ExprNode *loopCond() const { return loopCond_.get(); }
 
   /// Get the node of the subexpression representing the loop body
   ///
-  /// \return a shared pointer to the node representing the loop body
-  ExprNodePtr loopBody() const { return loopBody_; }
+  /// \return a pointer to the node representing the loop body
+  ExprNode *loopBody() const { return loopBody_.get(); }
 
 private:
-  WhileExprNode(ExprNodePtr loopCond, ExprNodePtr loopBody, const uint32_t lloc,
-                const uint32_t cloc);
+  friend class NodeArena;
+
+  WhileExprNode(ExprNodePtr loopCond, ExprNodePtr loopBody, const uint32_t loc);
 
   const ExprNodePtr loopCond_;
   const ExprNodePtr loopBody_;
@@ -591,13 +659,13 @@ public:
   /// \param[in] methodName function name
   /// \param[in] expr expression on which function is called
   /// \param[in] params function parameters
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
   /// \return a shared pointer to the newly created dispatch expression node
   static DispatchExprNodePtr
-  MakeDispatchExprNode(const std::string &methodName, ExprNodePtr expr,
-                       std::vector<ExprNodePtr> params, const uint32_t lloc,
-                       const uint32_t cloc);
+  MakeDispatchExprNode(const Symbol &methodName, ExprNodePtr expr,
+                       std::vector<ExprNodePtr> params, const uint32_t loc,
+                       NodeArena *arena = nullptr);
 
   /// Return a list of pointers to the function arguments nodes
   ///
@@ -611,27 +679,39 @@ public:
 
   /// Return the expression node
   ///
-  /// \return a shared pointer to the expression node
-  ExprNodePtr expr() const { return expr_; }
+  /// \return a pointer to the expression node
+  ExprNode *expr() const { return expr_.get(); }
 
   /// Return the method name
   ///
   /// \return the method name
-  const std::string &methodName() const { return methodName_; }
+  const Symbol &methodName() const { return methodName_; }
 
   /// Return whether the expression node is present or not
   ///
   /// \return true if the expression exists, false otherwise
   bool hasExpr() const { return expr_ != nullptr; }
 
+  /// Return the slot of the method in the dispatch table
+  ///
+  /// \return the slot of the method, -1 if not resolved
+  int32_t slot() const { return slot_; }
+
+  /// Set the slot of the method in the dispatch table
+  ///
+  /// \param[in] slot slot of the method
+  void setSlot(const int32_t slot) { slot_ = slot; }
+
 private:
-  DispatchExprNode(const std::string &methodName, ExprNodePtr expr,
-                   std::vector<ExprNodePtr> params, const uint32_t lloc,
-                   const uint32_t cloc);
+  friend class NodeArena;
+
+  DispatchExprNode(const Symbol &methodName, ExprNodePtr expr,
+                   std::vector<ExprNodePtr> params, const uint32_t loc);
 
-  std::string methodName_;
+  Symbol methodName_;
   ExprNodePtr expr_;
   std::vector<ExprNodePtr> params_;
+  int32_t slot_ = -1;
 };
 
 /// Class for a node representing a static dispatch expression
@@ -650,14 +730,14 @@ public:
   /// \param[in] callerClass static caller class name
   /// \param[in] expr shared pointer to expression on which function is called
   /// \param[in] params function parameters
-  /// \param[in] lloc line location
-  /// \param[in] cloc character location
-  /// \return a shared pointer to the static dispatch expression node
+  /// \param[in] loc location in the program text, as a byte offset
+  /// \param[in] arena node arena, nullptr to allocate the node on the heap
+  /// \return a shared pointer to the new static dispatch expression node
   static StaticDispatchExprNodePtr
-  MakeStaticDispatchExprNode(const std::string &methodName,
-                             const std::string &callerClass, ExprNodePtr expr,
+  MakeStaticDispatchExprNode(const Symbol &methodName,
+                             const Symbol &callerClass, ExprNodePtr expr,
                              std::vector<ExprNodePtr> params,
-                             const uint32_t lloc, const uint32_t cloc);
+                             const uint32_t loc, NodeArena *arena = nullptr);
 
   /// Return a list of pointers to the function parameters nodes
   ///
@@ -672,28 +752,40 @@ public:
   /// Return the parent class name on which the function should be called
   ///
   /// \return the parent class name on which the function should be called
-  const std::string &callerClass() const { return callerClass_; }
+  const Symbol &callerClass() const { return callerClass_; }
 
   /// Return the expression node
   ///
-  /// \return a shared pointer to the expression node
-  ExprNodePtr expr() const { return expr_; }
+  /// \return a pointer to the expression node
+  ExprNode *expr() const { return expr_.get(); }
 
   /// Return the method name
   ///
   /// \return the method name
-  const std::string &methodName() const { return methodName_; }
+  const Symbol &methodName() const { return methodName_; }
+
+  /// Return the slot of the method in the dispatch table
+  ///
+  /// \return the slot of the method, -1 if not resolved
+  int32_t slot() const { return slot_; }
+
+  /// Set the slot of the method in the dispatch table
+  ///
+  /// \param[in] slot slot of the method
+  void setSlot(const int32_t slot) { slot_ = slot; }
 
 private:
-  StaticDispatchExprNode(const std::string &methodName,
-                         const std::string &callerClass, ExprNodePtr expr,
-                         std::vector<ExprNodePtr> params, const uint32_t lloc,
-                         const uint32_t cloc);
+  friend class NodeArena;
+
+  StaticDispatchExprNode(const Symbol &methodName, const Symbol &callerClass,
+                         ExprNodePtr expr, std::vector<ExprNodePtr> params,
+                         const uint32_t loc);
 
-  std::string methodName_;
-  std::string callerClass_;
+  Symbol methodName_;
+  Symbol callerClass_;
   ExprNodePtr expr_;
   std::vector<ExprNodePtr> params_;
+  int32_t slot_ = -1;
 };
 
 } // namespace cool
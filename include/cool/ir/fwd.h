@@ -8,6 +8,9 @@ namespace cool {
 /// Base node class
 class Node;
 
+/// Arena for the nodes of the AST
+class NodeArena;
+
 /// Program-related nodes
 class AttributeNode;
 class ClassNode;
@@ -3,6 +3,7 @@
 
 #include <cool/core/status.h>
 #include <cool/ir/common.h>
+#include <cool/ir/fwd.h>
 
 #include <cstdlib>
 
@@ -14,6 +15,68 @@ class CodegenContext;
 class Pass;
 class CodegenBasePass;
 
+/// Identifiers of the concrete node types of the abstract syntax tree
+enum class NodeKind : uint8_t {
+  Invalid,
+  Attribute,
+  Class,
+  Formal,
+  Method,
+  Program,
+  AssignmentExpr,
+  ArithmeticExpr,
+  ComparisonExpr,
+  BlockExpr,
+  BooleanExpr,
+  CaseBinding,
+  CaseExpr,
+  DispatchExpr,
+  IdExpr,
+  IfExpr,
+  LetBinding,
+  LetExpr,
+  IntLiteralExpr,
+  StringLiteralExpr,
+  NewExpr,
+  StaticDispatchExpr,
+  UnaryExpr,
+  WhileExpr
+};
+
+/// Metafunction that maps a concrete node type to its node kind
+template <typename NodeT> struct NodeKindOf;
+
+#define COOL_DEFINE_NODE_KIND(NodeT, Kind)                                     \
+  template <> struct NodeKindOf<NodeT> {                                       \
+    static constexpr NodeKind value = NodeKind::Kind;                          \
+  };
+
+COOL_DEFINE_NODE_KIND(AttributeNode, Attribute)
+COOL_DEFINE_NODE_KIND(ClassNode, Class)
+COOL_DEFINE_NODE_KIND(FormalNode, Formal)
+COOL_DEFINE_NODE_KIND(MethodNode, Method)
+COOL_DEFINE_NODE_KIND(ProgramNode, Program)
+COOL_DEFINE_NODE_KIND(AssignmentExprNode, AssignmentExpr)
+COOL_DEFINE_NODE_KIND(BinaryExprNode<ArithmeticOpID>, ArithmeticExpr)
+COOL_DEFINE_NODE_KIND(BinaryExprNode<ComparisonOpID>, ComparisonExpr)
+COOL_DEFINE_NODE_KIND(BlockExprNode, BlockExpr)
+COOL_DEFINE_NODE_KIND(BooleanExprNode, BooleanExpr)
+COOL_DEFINE_NODE_KIND(CaseBindingNode, CaseBinding)
+COOL_DEFINE_NODE_KIND(CaseExprNode, CaseExpr)
+COOL_DEFINE_NODE_KIND(DispatchExprNode, DispatchExpr)
+COOL_DEFINE_NODE_KIND(IdExprNode, IdExpr)
+COOL_DEFINE_NODE_KIND(IfExprNode, IfExpr)
+COOL_DEFINE_NODE_KIND(LetBindingNode, LetBinding)
+COOL_DEFINE_NODE_KIND(LetExprNode, LetExpr)
+COOL_DEFINE_NODE_KIND(LiteralExprNode<int32_t>, IntLiteralExpr)
+COOL_DEFINE_NODE_KIND(LiteralExprNode<std::string>, StringLiteralExpr)
+COOL_DEFINE_NODE_KIND(NewExprNode, NewExpr)
+COOL_DEFINE_NODE_KIND(StaticDispatchExprNode, StaticDispatchExpr)
+COOL_DEFINE_NODE_KIND(UnaryExprNode, UnaryExpr)
+COOL_DEFINE_NODE_KIND(WhileExprNode, WhileExpr)
+
+#undef COOL_DEFINE_NODE_KIND
+
 /// Base class for a node in the abstract syntax tree
 class Node {
 
@@ -21,19 +84,18 @@ public:
   Node() = delete;
   virtual ~Node() = default;
 
-  /// Get the location in the current line of the program text where the node is
-  /// defined
+  /// Get the location in the program text where the node is defined
+  ///
+  /// Locations are byte offsets, which the source manager of the program
+  /// converts to lines and columns when they are reported
   ///
-  /// \return the location in the current line of the program text where the
-  /// node is defined
-  uint32_t lineLoc() const { return lloc_; }
+  /// \return the offset in the program text where the node is defined
+  uint32_t loc() const { return loc_; }
 
-  /// Get the location in the current line of the program text where the node is
-  /// defined
+  /// Get the kind of the node
   ///
-  /// \return the location in the current line of the program text where the
-  /// node is defined
-  uint32_t charLoc() const { return cloc_; }
+  /// \return the kind of the concrete node type
+  NodeKind kind() const { return kind_; }
 
   /// Visit the node and execute the operation associated with the analysis pass
   ///
@@ -52,11 +114,16 @@ public:
                               std::ostream *ios) = 0;
 
 protected:
-  Node(const uint32_t lloc, const uint32_t cloc) : lloc_(lloc), cloc_(cloc) {}
+  Node(const uint32_t loc) : loc_(loc) {}
+
+  /// Set the kind of the node. Invoked by Visitable on construction
+  ///
+  /// \param[in] kind kind of the concrete node type
+  void setKind(const NodeKind kind) { kind_ = kind; }
 
 private:
-  uint32_t lloc_ = 0;
-  uint32_t cloc_ = 0;
+  uint32_t loc_ = 0;
+  NodeKind kind_ = NodeKind::Invalid;
 };
 
 } // namespace cool
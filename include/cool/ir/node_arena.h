@@ -0,0 +1,78 @@
+#ifndef COOL_IR_NODE_ARENA_H
+#define COOL_IR_NODE_ARENA_H
+
+#include <cool/ir/node.h>
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace cool {
+
+/// Class that implements a bump-pointer arena for the nodes of the AST
+///
+/// Nodes are carved out of large memory blocks and are destroyed in bulk, in
+/// reverse order of creation, when the arena is destroyed. The shared pointers
+/// returned by NodeArena::Make do not own the node: they share no control
+/// block, so copying them does not touch any reference count. It is the client
+/// code responsibility to keep the arena alive for as long as its nodes are in
+/// use. Programs parsed by the frontend own the arena of their nodes
+class NodeArena {
+
+public:
+  NodeArena() = default;
+  NodeArena(const NodeArena &) = delete;
+  NodeArena &operator=(const NodeArena &) = delete;
+
+  ~NodeArena();
+
+  /// \brief Create a node of the AST
+  ///
+  /// \note If arena is nullptr, the node is allocated on the heap and is owned
+  /// by the returned shared pointer
+  ///
+  /// \param[in] arena arena in which to allocate the node, can be nullptr
+  /// \param[in] args arguments forwarded to the node constructor
+  /// \return a shared pointer to the new node
+  template <typename T, typename... Args>
+  static std::shared_ptr<T> Make(NodeArena *arena, Args &&... args);
+
+  /// \brief Return the number of bytes reserved by the arena
+  ///
+  /// \return the number of bytes reserved by the arena
+  size_t bytesReserved() const { return bytesReserved_; }
+
+  /// \brief Return the number of bytes used by the nodes in the arena
+  ///
+  /// \return the number of bytes used by the nodes in the arena
+  size_t bytesUsed() const { return bytesUsed_; }
+
+  /// \brief Return the number of nodes in the arena
+  ///
+  /// \return the number of nodes in the arena
+  size_t nodesCount() const { return nodes_.size(); }
+
+private:
+  /// \brief Allocate uninitialized memory from the current block
+  ///
+  /// \param[in] size number of bytes to allocate
+  /// \param[in] alignment alignment of the allocation
+  /// \return a pointer to the allocated memory
+  void *allocate(const size_t size, const size_t alignment);
+
+  static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  char *current_ = nullptr;
+  char *end_ = nullptr;
+
+  size_t bytesReserved_ = 0;
+  size_t bytesUsed_ = 0;
+  std::vector<Node *> nodes_;
+};
+
+} // namespace cool
+
+#include <cool/ir/node_arena.inl>
+
+#endif
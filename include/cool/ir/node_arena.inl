@@ -0,0 +1,26 @@
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace cool {
+
+template <typename T, typename... Args>
+std::shared_ptr<T> NodeArena::Make(NodeArena *arena, Args &&... args) {
+  static_assert(std::is_base_of<Node, T>::value,
+                "Only AST nodes can be allocated in a node arena");
+
+  /// No arena, node is owned by the shared pointer
+  if (arena == nullptr) {
+    return std::shared_ptr<T>(new T(std::forward<Args>(args)...));
+  }
+
+  /// Construct the node in the arena and register it for destruction
+  void *memory = arena->allocate(sizeof(T), alignof(T));
+  T *node = new (memory) T(std::forward<Args>(args)...);
+  arena->nodes_.push_back(node);
+
+  /// Aliasing constructor with an empty owner: the pointer is not owning
+  return std::shared_ptr<T>(std::shared_ptr<T>(), node);
+}
+
+} // namespace cool
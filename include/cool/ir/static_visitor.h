@@ -0,0 +1,44 @@
+#ifndef COOL_IR_STATIC_VISITOR_H
+#define COOL_IR_STATIC_VISITOR_H
+
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+#include <cool/ir/node.h>
+
+#include <cassert>
+#include <utility>
+
+namespace cool {
+
+/// CRTP base class for passes that dispatch over the AST with a single switch
+/// on the node kind, instead of the double virtual dispatch implemented by
+/// Visitable.
+///
+/// The derived class must provide a member function template
+///
+///   template <typename NodeT, typename... Args>
+///   ReturnT apply(NodeT *node, Args &&... args);
+///
+/// which is invoked with the node downcast to its concrete type. Since the
+/// call is resolved statically, the handlers of the derived class can be
+/// inlined in the traversal
+template <typename Derived, typename ReturnT = Status> class StaticVisitor {
+
+public:
+  /// \brief Dispatch a node to the handler of the derived class
+  ///
+  /// \param[in] node node to visit
+  /// \param[in] args arguments forwarded to the handler
+  /// \return the value returned by the handler
+  template <typename... Args> ReturnT dispatch(Node *node, Args &&... args);
+
+protected:
+  StaticVisitor() = default;
+  ~StaticVisitor() = default;
+};
+
+} // namespace cool
+
+#include <cool/ir/static_visitor.inl>
+
+#endif
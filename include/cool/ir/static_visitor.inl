@@ -0,0 +1,48 @@
+namespace cool {
+
+#define COOL_STATIC_VISITOR_CASE(NodeT)                                        \
+  case NodeKindOf<NodeT>::value:                                               \
+    return derived->apply(static_cast<NodeT *>(node),                          \
+                          std::forward<Args>(args)...);
+
+template <typename Derived, typename ReturnT>
+template <typename... Args>
+ReturnT StaticVisitor<Derived, ReturnT>::dispatch(Node *node,
+                                                  Args &&... args) {
+  auto *derived = static_cast<Derived *>(this);
+  switch (node->kind()) {
+    COOL_STATIC_VISITOR_CASE(AttributeNode)
+    COOL_STATIC_VISITOR_CASE(ClassNode)
+    COOL_STATIC_VISITOR_CASE(FormalNode)
+    COOL_STATIC_VISITOR_CASE(MethodNode)
+    COOL_STATIC_VISITOR_CASE(ProgramNode)
+    COOL_STATIC_VISITOR_CASE(AssignmentExprNode)
+    COOL_STATIC_VISITOR_CASE(BinaryExprNode<ArithmeticOpID>)
+    COOL_STATIC_VISITOR_CASE(BinaryExprNode<ComparisonOpID>)
+    COOL_STATIC_VISITOR_CASE(BlockExprNode)
+    COOL_STATIC_VISITOR_CASE(BooleanExprNode)
+    COOL_STATIC_VISITOR_CASE(CaseBindingNode)
+    COOL_STATIC_VISITOR_CASE(CaseExprNode)
+    COOL_STATIC_VISITOR_CASE(DispatchExprNode)
+    COOL_STATIC_VISITOR_CASE(IdExprNode)
+    COOL_STATIC_VISITOR_CASE(IfExprNode)
+    COOL_STATIC_VISITOR_CASE(LetBindingNode)
+    COOL_STATIC_VISITOR_CASE(LetExprNode)
+    COOL_STATIC_VISITOR_CASE(LiteralExprNode<int32_t>)
+    COOL_STATIC_VISITOR_CASE(LiteralExprNode<std::string>)
+    COOL_STATIC_VISITOR_CASE(NewExprNode)
+    COOL_STATIC_VISITOR_CASE(StaticDispatchExprNode)
+    COOL_STATIC_VISITOR_CASE(UnaryExprNode)
+    COOL_STATIC_VISITOR_CASE(WhileExprNode)
+  case NodeKind::Invalid:
+    break;
+  }
+
+  /// Node kinds are set on construction, this point cannot be reached
+  assert(false);
+  return ReturnT();
+}
+
+#undef COOL_STATIC_VISITOR_CASE
+
+} // namespace cool
@@ -0,0 +1,147 @@
+#ifndef COOL_IR_SYMBOL_H
+#define COOL_IR_SYMBOL_H
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+
+namespace cool {
+
+/// Class representing an interned identifier
+///
+/// A symbol is a handle to a unique, immutable copy of an identifier stored in
+/// a global interner. Symbols with the same text share the same handle, so
+/// that comparing and hashing symbols does not touch the identifier text. Each
+/// symbol is also assigned a dense integer ID. The interner is thread-safe;
+/// interned identifiers are never released
+class Symbol {
+
+public:
+  /// Construct the symbol for the empty identifier
+  Symbol();
+
+  /// Construct the symbol for an identifier, interning it if needed
+  ///
+  /// \param[in] name identifier
+  Symbol(const std::string &name);
+
+  /// Construct the symbol for an identifier, interning it if needed
+  ///
+  /// \param[in] name null-terminated identifier
+  Symbol(const char *name);
+
+  /// Construct the symbol for an identifier, interning it if needed
+  ///
+  /// \param[in] name pointer to the first character of the identifier
+  /// \param[in] length identifier length
+  Symbol(const char *name, const size_t length);
+
+  /// Return the identifier text
+  ///
+  /// \return a reference to the interned identifier
+  const std::string &str() const { return entry_->name; }
+
+  /// Return the identifier text as a null-terminated string
+  ///
+  /// \return a pointer to the interned identifier
+  const char *c_str() const { return entry_->name.c_str(); }
+
+  /// Return the dense ID of the symbol
+  ///
+  /// \return the symbol ID
+  uint32_t id() const { return entry_->id; }
+
+  /// Check whether the symbol is the empty identifier
+  ///
+  /// \return true if the identifier is empty, false otherwise
+  bool empty() const { return entry_->name.empty(); }
+
+  /// Return the identifier length
+  ///
+  /// \return the identifier length
+  size_t length() const { return entry_->name.length(); }
+
+  /// Conversion to the identifier text
+  operator const std::string &() const { return entry_->name; }
+
+  /// Return the number of interned symbols
+  ///
+  /// \return the number of interned symbols
+  static size_t InternedCount();
+
+private:
+  /// Entry of the global interner
+  struct Entry {
+    std::string name;
+    uint32_t id;
+    size_t hash;
+  };
+
+  const Entry *entry_;
+
+  friend class SymbolInterner;
+  friend bool operator==(const Symbol lhs, const Symbol rhs);
+};
+
+/// Equality operator between symbols
+///
+/// \param[in] lhs first symbol to compare
+/// \param[in] rhs second symbol to compare
+/// \return true if the two symbols are the same, false otherwise
+inline bool operator==(const Symbol lhs, const Symbol rhs) {
+  return lhs.entry_ == rhs.entry_;
+}
+
+/// Inequality operator between symbols
+///
+/// \param[in] lhs first symbol to compare
+/// \param[in] rhs second symbol to compare
+/// \return true if the two symbols are not the same, false otherwise
+inline bool operator!=(const Symbol lhs, const Symbol rhs) {
+  return !(lhs == rhs);
+}
+
+/// Stream insertion operator for symbols
+///
+/// \param[out] os output stream
+/// \param[in] symbol symbol to print
+/// \return the output stream
+inline std::ostream &operator<<(std::ostream &os, const Symbol symbol) {
+  return os << symbol.str();
+}
+
+/// Symbols for identifiers that the compiler refers to directly. Comparing
+/// against these symbols avoids interning the identifiers again
+struct WellKnownSymbols {
+  const Symbol empty;
+  const Symbol self = "self";
+  const Symbol selfType = "SELF_TYPE";
+  const Symbol object = "Object";
+  const Symbol io = "IO";
+  const Symbol intType = "Int";
+  const Symbol boolType = "Bool";
+  const Symbol stringType = "String";
+  const Symbol main = "Main";
+  const Symbol mainMethod = "main";
+
+  /// Return the well-known symbols
+  ///
+  /// \return a reference to the well-known symbols
+  static const WellKnownSymbols &Get();
+};
+
+} // namespace cool
+
+namespace std {
+
+/// Hash function specialization for cool::Symbol
+template <> struct hash<cool::Symbol> {
+  std::size_t operator()(cool::Symbol const &symbol) const noexcept {
+    return std::hash<uint32_t>{}(symbol.id());
+  }
+};
+
+} // namespace std
+
+#endif
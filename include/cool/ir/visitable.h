@@ -4,6 +4,7 @@
 #include <cool/analysis/pass.h>
 #include <cool/codegen/codegen_base.h>
 #include <cool/core/status.h>
+#include <cool/ir/node.h>
 
 #include <ostream>
 #include <utility>
@@ -26,7 +27,9 @@ public:
 
 protected:
   template <typename... Args>
-  Visitable(Args &&... args) : Base(std::forward<Args>(args)...) {}
+  Visitable(Args &&... args) : Base(std::forward<Args>(args)...) {
+    this->setKind(NodeKindOf<Derived>::value);
+  }
 };
 
 } // namespace cool
@@ -0,0 +1,416 @@
+#include <cool/analysis/analysis_context.h>
+#include <cool/analysis/analysis_session.h>
+#include <cool/analysis/classes_definition.h>
+#include <cool/analysis/classes_implementation.h>
+#include <cool/analysis/name_resolution.h>
+#include <cool/analysis/prelude.h>
+#include <cool/analysis/type_check.h>
+#include <cool/core/class_registry.h>
+#include <cool/core/sha256.h>
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+#include <cool/ir/static_visitor.h>
+
+#include <cassert>
+#include <unordered_set>
+
+namespace cool {
+
+namespace {
+
+/// Class that walks the nodes of a class in preorder. The walker hashes the
+/// kind and the fields of each node, except for its location, and collects
+/// the expression nodes, so that two classes with the same fingerprint have
+/// their expressions in the same order
+class ClassWalker : public StaticVisitor<ClassWalker, void> {
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param[in] hash hash to update, nullptr to skip hashing
+  /// \param[out] exprs expression nodes, nullptr to skip collecting them
+  ClassWalker(Sha256 *hash, std::vector<ExprNode *> *exprs)
+      : hash_(hash), exprs_(exprs) {}
+
+  /// Program, class and attributes nodes
+  void apply(ProgramNode *node) {
+    for (const auto &classNode : node->classes()) {
+      dispatch(classNode.get());
+    }
+  }
+
+  void apply(ClassNode *node) {
+    addNode(node);
+    add(node->className());
+    add(node->parentClassName());
+    addChildren(node->attributes());
+    addChildren(node->methods());
+  }
+
+  void apply(AttributeNode *node) {
+    addNode(node);
+    add(node->id());
+    add(node->typeName());
+    addOptional(node->initExpr());
+  }
+
+  void apply(MethodNode *node) {
+    addNode(node);
+    add(node->id());
+    add(node->returnTypeName());
+    addChildren(node->arguments());
+    addOptional(node->body());
+  }
+
+  void apply(FormalNode *node) {
+    addNode(node);
+    add(node->id());
+    add(node->typeName());
+  }
+
+  /// Expressions nodes
+  void apply(AssignmentExprNode *node) {
+    addExpr(node);
+    add(node->id());
+    dispatch(node->rhsExpr());
+  }
+
+  template <typename OperatorT> void apply(BinaryExprNode<OperatorT> *node) {
+    addExpr(node);
+    add(static_cast<uint32_t>(node->opID()));
+    dispatch(node->lhsExpr());
+    dispatch(node->rhsExpr());
+  }
+
+  void apply(BlockExprNode *node) {
+    addExpr(node);
+    addChildren(node->exprs());
+  }
+
+  void apply(BooleanExprNode *node) {
+    addExpr(node);
+    add(static_cast<uint32_t>(node->value()));
+  }
+
+  void apply(CaseBindingNode *node) {
+    addNode(node);
+    add(node->id());
+    add(node->typeName());
+    dispatch(node->expr());
+  }
+
+  void apply(CaseExprNode *node) {
+    addExpr(node);
+    dispatch(node->expr());
+    addChildren(node->cases());
+  }
+
+  void apply(DispatchExprNode *node) {
+    addExpr(node);
+    add(node->methodName());
+    addOptional(node->expr());
+    addChildren(node->params());
+  }
+
+  void apply(IdExprNode *node) {
+    addExpr(node);
+    add(node->id());
+  }
+
+  void apply(IfExprNode *node) {
+    addExpr(node);
+    dispatch(node->ifExpr());
+    dispatch(node->thenExpr());
+    dispatch(node->elseExpr());
+  }
+
+  void apply(LetBindingNode *node) {
+    addNode(node);
+    add(node->id());
+    add(node->typeName());
+    addOptional(node->expr());
+  }
+
+  void apply(LetExprNode *node) {
+    addExpr(node);
+    addChildren(node->bindings());
+    dispatch(node->expr());
+  }
+
+  void apply(LiteralExprNode<int32_t> *node) {
+    addExpr(node);
+    add(static_cast<uint32_t>(node->value()));
+  }
+
+  void apply(LiteralExprNode<std::string> *node) {
+    addExpr(node);
+    add(node->value());
+  }
+
+  void apply(NewExprNode *node) {
+    addExpr(node);
+    add(node->typeName());
+  }
+
+  void apply(StaticDispatchExprNode *node) {
+    addExpr(node);
+    add(node->methodName());
+    add(node->callerClass());
+    dispatch(node->expr());
+    addChildren(node->params());
+  }
+
+  void apply(UnaryExprNode *node) {
+    addExpr(node);
+    add(static_cast<uint32_t>(node->opID()));
+    dispatch(node->expr());
+  }
+
+  void apply(WhileExprNode *node) {
+    addExpr(node);
+    dispatch(node->loopCond());
+    dispatch(node->loopBody());
+  }
+
+private:
+  void add(const uint32_t value) {
+    if (hash_) {
+      hash_->update(&value, sizeof(value));
+    }
+  }
+
+  void add(const std::string &value) {
+    add(static_cast<uint32_t>(value.length()));
+    if (hash_) {
+      hash_->update(value);
+    }
+  }
+
+  void add(const Symbol &value) { add(value.str()); }
+
+  void addNode(Node *node) { add(static_cast<uint32_t>(node->kind())); }
+
+  void addExpr(ExprNode *node) {
+    addNode(node);
+    if (exprs_) {
+      exprs_->push_back(node);
+    }
+  }
+
+  void addOptional(Node *node) {
+    add(static_cast<uint32_t>(node != nullptr));
+    if (node) {
+      dispatch(node);
+    }
+  }
+
+  template <typename NodePtrT>
+  void addChildren(const std::vector<NodePtrT> &nodes) {
+    add(static_cast<uint32_t>(nodes.size()));
+    for (const auto &node : nodes) {
+      dispatch(node.get());
+    }
+  }
+
+  Sha256 *hash_;
+  std::vector<ExprNode *> *exprs_;
+};
+
+/// \brief Helper function to compute the fingerprint of a class, which covers
+/// the whole class except for the node locations
+///
+/// \param[in] node class node
+/// \return the fingerprint of the class
+std::string Fingerprint(ClassNode *node) {
+  Sha256 hash;
+  ClassWalker(&hash, nullptr).dispatch(node);
+  return hash.hexDigest();
+}
+
+/// \brief Helper function to compute the fingerprint of the signature of a
+/// class: its parent class and the types of its attributes and methods
+///
+/// \param[in] node class node
+/// \return the fingerprint of the signature of the class
+std::string Signature(const ClassNode &node) {
+  Sha256 hash;
+  auto add = [&hash](const Symbol &value) {
+    const uint32_t length = value.length();
+    hash.update(&length, sizeof(length));
+    hash.update(value.str());
+  };
+
+  add(node.parentClassName());
+  for (const auto &attributeNode : node.attributes()) {
+    add(attributeNode->id());
+    add(attributeNode->typeName());
+  }
+
+  /// Methods and attributes live in different namespaces
+  add("");
+  for (const auto &methodNode : node.methods()) {
+    add(methodNode->id());
+    add(methodNode->returnTypeName());
+    const uint32_t argumentsCount = methodNode->arguments().size();
+    hash.update(&argumentsCount, sizeof(argumentsCount));
+    for (const auto &argument : methodNode->arguments()) {
+      add(argument->typeName());
+    }
+  }
+  return hash.hexDigest();
+}
+
+/// \brief Helper function to convert the dependencies of a class to class
+/// names, adding the ancestors of each dependency
+///
+/// \param[in] registry class registry
+/// \param[in] dependencies type IDs of the dependencies
+/// \return the names of the dependencies
+std::vector<Symbol>
+DependencyNames(const ClassRegistry &registry,
+                const std::unordered_set<IdentifierType> &dependencies) {
+  std::unordered_set<IdentifierType> closure;
+  for (auto typeID : dependencies) {
+    while (registry.hasClass(typeID) && closure.insert(typeID).second &&
+           registry.hasParentClass(typeID)) {
+      typeID = registry.parentID(typeID);
+    }
+  }
+
+  std::vector<Symbol> names;
+  for (auto typeID : closure) {
+    names.push_back(registry.className(typeID));
+  }
+  return names;
+}
+
+} // namespace
+
+AnalysisSession::AnalysisSession(std::shared_ptr<LoggerCollection> logger)
+    : prelude_(Prelude::Get()), logger_(std::move(logger)) {}
+
+Status AnalysisSession::analyze(ProgramNodePtr program) {
+  auto registry = prelude_->makeClassRegistry();
+  auto context = prelude_->makeAnalysisContext(registry, logger_);
+
+  /// Analyze the class hierarchy and the class signatures
+  ClassesDefinitionPass definitionPass;
+  ClassesImplementationPass implementationPass;
+  for (Pass *pass : {static_cast<Pass *>(&definitionPass),
+                     static_cast<Pass *>(&implementationPass)}) {
+    auto status = pass->visit(context.get(), program.get());
+    if (!status.isOk()) {
+      return status;
+    }
+  }
+
+  /// Collect the parents and the signatures of the new classes
+  std::unordered_map<Symbol, Symbol> parents;
+  std::unordered_map<Symbol, std::string> signatures;
+  for (const auto &classNode : program->classes()) {
+    parents[classNode->className()] = classNode->parentClassName();
+    signatures[classNode->className()] = Signature(*classNode);
+  }
+
+  /// Results cannot be reused if a previous class was removed or changed
+  /// parent, since conformance between unchanged classes may differ
+  bool hierarchyOk = true;
+  for (const auto &entry : states_) {
+    auto it = parents.find(entry.first);
+    if (it == parents.end() || it->second != entry.second.parentClassName) {
+      hierarchyOk = false;
+      break;
+    }
+  }
+
+  /// Type-check the classes whose previous results cannot be reused
+  std::unordered_map<Symbol, ClassState> states;
+  TypeCheckPass typeCheckPass;
+  NameResolutionPass resolutionPass;
+  bool typeCheckOk = true;
+  checkedClasses_.clear();
+  for (const auto &classNode : program->classes()) {
+    if (classNode->builtIn()) {
+      continue;
+    }
+
+    const auto &className = classNode->className();
+    ClassState state;
+    state.node = classNode;
+    state.parentClassName = classNode->parentClassName();
+    state.fingerprint = Fingerprint(classNode.get());
+    state.signature = signatures[className];
+
+    auto it = states_.find(className);
+    if (hierarchyOk && it != states_.end() &&
+        canReuse(it->second, state.fingerprint, signatures)) {
+      copyTypes(it->second, *registry, classNode.get());
+      state.dependencies = it->second.dependencies;
+      state.typeCheckOk = true;
+    } else {
+      std::unordered_set<IdentifierType> dependencies;
+      context->setDependencies(&dependencies);
+      state.typeCheckOk =
+          classNode->visitNode(context.get(), &typeCheckPass).isOk();
+      context->setDependencies(nullptr);
+
+      state.dependencies = DependencyNames(*registry, dependencies);
+      typeCheckOk &= state.typeCheckOk;
+      checkedClasses_.push_back(className);
+    }
+
+    /// Names are resolved again, since attribute positions and method slots
+    /// may change with the other classes
+    if (state.typeCheckOk) {
+      classNode->visitNode(context.get(), &resolutionPass);
+    }
+    states.insert({className, std::move(state)});
+  }
+
+  /// Keep the results for the next version of the program
+  registry_ = registry;
+  states_ = std::move(states);
+  signatures_ = std::move(signatures);
+  return typeCheckOk ? Status::Ok() : Status::Error();
+}
+
+bool AnalysisSession::canReuse(
+    const ClassState &state, const std::string &fingerprint,
+    const std::unordered_map<Symbol, std::string> &signatures) const {
+  if (!state.typeCheckOk || state.fingerprint != fingerprint) {
+    return false;
+  }
+
+  /// Signatures of the dependencies must be unchanged
+  for (const auto &dependency : state.dependencies) {
+    auto previous = signatures_.find(dependency);
+    auto current = signatures.find(dependency);
+    if (previous == signatures_.end() || current == signatures.end() ||
+        previous->second != current->second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void AnalysisSession::copyTypes(const ClassState &state,
+                                const ClassRegistry &registry,
+                                ClassNode *node) const {
+  std::vector<ExprNode *> previousExprs;
+  ClassWalker(nullptr, &previousExprs).dispatch(state.node.get());
+
+  std::vector<ExprNode *> exprs;
+  ClassWalker(nullptr, &exprs).dispatch(node);
+  assert(exprs.size() == previousExprs.size());
+
+  /// Class IDs may differ between the two versions, while names do not
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    auto type = previousExprs[i]->type();
+    if (registry_->hasClass(type.typeID)) {
+      type.typeID = registry.typeID(registry_->className(type.typeID));
+    }
+    exprs[i]->setType(type);
+  }
+}
+
+} // namespace cool
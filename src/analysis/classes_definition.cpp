@@ -23,9 +23,13 @@ Status ClassesDefinitionPass::visit(AnalysisContext *context,
                                           "String"};
 
   /// Check class definitions
-  for (auto classNode : node->classes()) {
+  for (const auto &classNode : node->classes()) {
     const auto &className = classNode->className();
-    if (reservedClasses.count(className) && !classNode->builtIn()) {
+    if (registry->hasClass(className) &&
+        registry->classNode(className) == classNode.get()) {
+      /// Classes of the prelude are registered already
+      continue;
+    } else if (reservedClasses.count(className) && !classNode->builtIn()) {
       /// Classes cannot redefine built-in classes
       classesDefinitionOk = false;
       LOG_ERROR_MESSAGE_WITH_LOCATION(
@@ -38,7 +42,7 @@ Status ClassesDefinitionPass::visit(AnalysisContext *context,
       LOG_ERROR_MESSAGE_WITH_LOCATION(
           logger, classNode,
           "Class %s was defined at line %d and cannot be redefined",
-          className.c_str(), classNode->lineLoc());
+          className.c_str(), logger->sourceLocation(classNode->loc()).line);
     } else if (className == "SELF_TYPE") {
       /// Class name cannot be SELF_TYPE
       classesDefinitionOk = false;
@@ -55,7 +59,7 @@ Status ClassesDefinitionPass::visit(AnalysisContext *context,
 
   /// Check parent classes
   StringSetType invalidParents = {"Bool", "Int", "String"};
-  for (auto classNode : node->classes()) {
+  for (const auto &classNode : node->classes()) {
     if (!classNode->hasParentClass()) {
       continue;
     }
@@ -87,8 +91,14 @@ Status ClassesDefinitionPass::visit(AnalysisContext *context,
     return GenericError("Error: Main class is not defined");
   }
 
-  /// Sort the classes and return
-  return node->sortClasses();
+  /// Sort the classes
+  auto status = node->sortClasses();
+  if (!status.isOk()) {
+    return status;
+  }
+
+  /// Inheritance tree is well formed, freeze the registry and return
+  return registry->freeze();
 }
 
 } // namespace cool
\ No newline at end of file
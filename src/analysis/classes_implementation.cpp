@@ -1,5 +1,7 @@
 #include <cool/analysis/analysis_context.h>
 #include <cool/analysis/classes_implementation.h>
+#include <cool/core/class_layout.h>
+#include <cool/core/class_registry.h>
 #include <cool/core/logger_collection.h>
 #include <cool/ir/class.h>
 
@@ -39,7 +41,7 @@ Status ClassesImplementationPass::visit(AnalysisContext *context,
   auto *symbolTable = context->symbolTable();
 
   /// Attribute id cannot be self
-  if (node->id() == "self") {
+  if (node->id() == WellKnownSymbols::Get().self) {
     LOG_ERROR_MESSAGE_WITH_LOCATION(logger, node,
                                     "'self' is not a valid attribute name");
     return Status::Error();
@@ -54,7 +56,8 @@ Status ClassesImplementationPass::visit(AnalysisContext *context,
 
   /// Attribute must be of valid type
   const auto typeName = node->typeName();
-  if (typeName != "SELF_TYPE" && !registry->hasClass(typeName)) {
+  if (typeName != WellKnownSymbols::Get().selfType &&
+      !registry->hasClass(typeName)) {
     LOG_ERROR_MESSAGE_WITH_LOCATION(logger, node,
                                     "Attribute %s has undefined type %s",
                                     node->id().c_str(), typeName.c_str());
@@ -62,8 +65,8 @@ Status ClassesImplementationPass::visit(AnalysisContext *context,
   }
 
   /// All good, insert symbol in table and return
-  if (typeName == "SELF_TYPE") {
-    auto type = registry->toSelfType(context->currentClassName());
+  if (typeName == WellKnownSymbols::Get().selfType) {
+    const ExprType type{.typeID = context->currentClassID(), .isSelf = true};
     symbolTable->addElement(node->id(), type);
   } else {
     auto type = registry->toType(typeName);
@@ -85,7 +88,7 @@ Status ClassesImplementationPass::visit(AnalysisContext *context,
 
   /// Formal types of class attributes must be valid
   bool classesImplementationOk = true;
-  for (auto attributeNode : node->attributes()) {
+  for (const auto &attributeNode : node->attributes()) {
     auto status = attributeNode->visitNode(context, this);
     if (!status.isOk()) {
       classesImplementationOk = false;
@@ -93,7 +96,7 @@ Status ClassesImplementationPass::visit(AnalysisContext *context,
   }
 
   /// Class methods must be properly defined
-  for (auto methodNode : node->methods()) {
+  for (const auto &methodNode : node->methods()) {
     auto status = methodNode->visitNode(context, this);
     if (!status.isOk()) {
       classesImplementationOk = false;
@@ -120,9 +123,9 @@ Status ClassesImplementationPass::visit(AnalysisContext *context,
   /// Verify method formal parameters
   std::vector<ExprType> argsTypes;
   std::unordered_set<std::string> argsIds;
-  for (auto argument : node->arguments()) {
+  for (const auto &argument : node->arguments()) {
     /// The type of a parameter cannot be SELF_TYPE
-    if (argument->typeName() == "SELF_TYPE") {
+    if (argument->typeName() == WellKnownSymbols::Get().selfType) {
       methodImplementationOk = false;
       LOG_ERROR_MESSAGE_WITH_LOCATION(
           logger, argument,
@@ -152,7 +155,7 @@ Status ClassesImplementationPass::visit(AnalysisContext *context,
     }
 
     /// self is not a valid parameter
-    if (argument->id() == "self") {
+    if (argument->id() == WellKnownSymbols::Get().self) {
       methodImplementationOk = false;
       LOG_ERROR_MESSAGE_WITH_LOCATION(
           logger, argument, "'self' in method %s is not a valid parameter name",
@@ -168,7 +171,7 @@ Status ClassesImplementationPass::visit(AnalysisContext *context,
   /// Return type must be defined or be SELF_TYPE
   ExprType returnType;
   const auto &returnTypeName = node->returnTypeName();
-  if (returnTypeName == "SELF_TYPE") {
+  if (returnTypeName == WellKnownSymbols::Get().selfType) {
     const auto &typeName = context->currentClassName();
     returnType = registry->toSelfType(typeName);
   } else {
@@ -242,8 +245,14 @@ Status ClassesImplementationPass::visit(AnalysisContext *context,
 
 Status ClassesImplementationPass::visit(AnalysisContext *context,
                                         ProgramNode *node) {
+  auto *registry = context->classRegistry();
   bool classesImplementationOk = true;
-  for (auto classNode : node->classes()) {
+  for (const auto &classNode : node->classes()) {
+    /// The tables of the prelude classes are shared and already complete
+    if (context->hasTables(registry->typeID(classNode->className()))) {
+      continue;
+    }
+
     auto status = classNode->visitNode(context, this);
     if (!status.isOk()) {
       classesImplementationOk = false;
@@ -253,6 +262,9 @@ Status ClassesImplementationPass::visit(AnalysisContext *context,
   if (!classesImplementationOk) {
     return GenericError("Error. Class arguments or methods contain errors");
   }
+
+  /// Lay out the objects and the dispatch tables once, for the later passes
+  registry->setClassLayout(ClassLayout::MakeClassLayout(*registry));
   return Status::Ok();
 }
 
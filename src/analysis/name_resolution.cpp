@@ -0,0 +1,215 @@
+#include <cool/analysis/analysis_context.h>
+#include <cool/analysis/name_resolution.h>
+#include <cool/core/class_layout.h>
+#include <cool/core/class_registry.h>
+#include <cool/core/flat_symbol_table.h>
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+#include <cool/ir/static_visitor.h>
+
+#include <cassert>
+#include <vector>
+
+namespace cool {
+
+namespace {
+
+/// Class that resolves the identifiers and the dispatch expressions of a class.
+/// The resolver keeps the bindings visible at each node in a scoped symbol
+/// table, whose class scope holds self and the attributes of the class
+class BindingResolver : public StaticVisitor<BindingResolver, void> {
+
+public:
+  /// \brief Constructor
+  ///
+  /// \param[in] registry class registry
+  /// \param[in] classID class ID of the class to resolve
+  BindingResolver(const ClassRegistry *registry, const IdentifierType classID)
+      : registry_(registry), layout_(registry->classLayout()),
+        classID_(classID) {
+    assert(layout_);
+    bindings_.addElement("self", Binding{BindingKind::Self, 0});
+
+    /// Attributes of the ancestors come first in the object
+    std::vector<IdentifierType> classIDs;
+    for (auto typeID = classID; registry->hasClass(typeID);
+         typeID = registry->parentID(typeID)) {
+      classIDs.push_back(typeID);
+      if (!registry->hasParentClass(typeID)) {
+        break;
+      }
+    }
+
+    for (auto it = classIDs.rbegin(); it != classIDs.rend(); ++it) {
+      int32_t position = layout_->attributesBegin(*it);
+      for (const auto &attributeNode : registry->classNode(*it)->attributes()) {
+        const Binding binding{BindingKind::Attribute, position++};
+        bindings_.addElement(attributeNode->id(), binding);
+      }
+    }
+  }
+
+  /// Program, class and attributes nodes. Programs are resolved one class at
+  /// a time, and formal parameters are bound by their method
+  void apply(ProgramNode *node) { assert(false); }
+
+  void apply(ClassNode *node) {
+    for (const auto &attributeNode : node->attributes()) {
+      dispatch(attributeNode.get());
+    }
+    for (const auto &methodNode : node->methods()) {
+      dispatch(methodNode.get());
+    }
+  }
+
+  void apply(AttributeNode *node) {
+    node->setPosition(bindings_.get(node->id()).index);
+    localsCount_ = 0;
+    resolveOptional(node->initExpr());
+  }
+
+  void apply(FormalNode *node) {}
+
+  void apply(MethodNode *node) {
+    bindings_.enterScope();
+    const int32_t argumentsCount = node->arguments().size();
+    for (int32_t i = 0; i < argumentsCount; ++i) {
+      const Binding binding{BindingKind::Argument, argumentsCount - i};
+      bindings_.addElement(node->arguments()[i]->id(), binding);
+    }
+
+    localsCount_ = 0;
+    resolveOptional(node->body());
+    bindings_.exitScope();
+  }
+
+  /// Expressions nodes
+  void apply(AssignmentExprNode *node) {
+    dispatch(node->rhsExpr());
+    node->setBinding(bindings_.get(node->id()));
+  }
+
+  template <typename OperatorT> void apply(BinaryExprNode<OperatorT> *node) {
+    dispatch(node->lhsExpr());
+    dispatch(node->rhsExpr());
+  }
+
+  void apply(BlockExprNode *node) { resolveChildren(node->exprs()); }
+
+  void apply(BooleanExprNode *node) {}
+
+  void apply(CaseBindingNode *node) {
+    bindings_.enterScope();
+    const Binding binding{BindingKind::Local, localsCount_++};
+    bindings_.addElement(node->id(), binding);
+    node->setBinding(binding);
+
+    dispatch(node->expr());
+    bindings_.exitScope();
+  }
+
+  void apply(CaseExprNode *node) {
+    dispatch(node->expr());
+    resolveChildren(node->cases());
+  }
+
+  void apply(DispatchExprNode *node) {
+    auto typeID = classID_;
+    if (node->hasExpr()) {
+      dispatch(node->expr());
+      typeID = node->expr()->type().typeID;
+    }
+    node->setSlot(layout_->slot(typeID, node->methodName()));
+    resolveChildren(node->params());
+  }
+
+  void apply(IdExprNode *node) { node->setBinding(bindings_.get(node->id())); }
+
+  void apply(IfExprNode *node) {
+    dispatch(node->ifExpr());
+    dispatch(node->thenExpr());
+    dispatch(node->elseExpr());
+  }
+
+  void apply(LetBindingNode *node) {
+    /// The initialization expression does not see the new variable
+    resolveOptional(node->expr());
+
+    bindings_.enterScope();
+    const Binding binding{BindingKind::Local, localsCount_++};
+    bindings_.addElement(node->id(), binding);
+    node->setBinding(binding);
+  }
+
+  void apply(LetExprNode *node) {
+    resolveChildren(node->bindings());
+    dispatch(node->expr());
+    for (size_t i = 0; i < node->bindings().size(); ++i) {
+      bindings_.exitScope();
+    }
+  }
+
+  void apply(LiteralExprNode<int32_t> *node) {}
+
+  void apply(LiteralExprNode<std::string> *node) {}
+
+  void apply(NewExprNode *node) {}
+
+  void apply(StaticDispatchExprNode *node) {
+    dispatch(node->expr());
+    const auto typeID = registry_->typeID(node->callerClass());
+    node->setSlot(layout_->slot(typeID, node->methodName()));
+    resolveChildren(node->params());
+  }
+
+  void apply(UnaryExprNode *node) { dispatch(node->expr()); }
+
+  void apply(WhileExprNode *node) {
+    dispatch(node->loopCond());
+    dispatch(node->loopBody());
+  }
+
+private:
+  void resolveOptional(Node *node) {
+    if (node) {
+      dispatch(node);
+    }
+  }
+
+  template <typename NodePtrT>
+  void resolveChildren(const std::vector<NodePtrT> &nodes) {
+    for (const auto &node : nodes) {
+      dispatch(node.get());
+    }
+  }
+
+  const ClassRegistry *registry_;
+  const ClassLayout *layout_;
+  const IdentifierType classID_;
+
+  FlatSymbolTable<Symbol, Binding> bindings_;
+  int32_t localsCount_ = 0;
+};
+
+} // namespace
+
+Status NameResolutionPass::visit(AnalysisContext *context, ClassNode *node) {
+  /// Built-in classes have no expressions, and are shared across programs
+  if (node->builtIn()) {
+    return Status::Ok();
+  }
+
+  auto registry = context->classRegistry();
+  BindingResolver(registry, registry->typeID(node->className()))
+      .dispatch(node);
+  return Status::Ok();
+}
+
+Status NameResolutionPass::visit(AnalysisContext *context, ProgramNode *node) {
+  for (const auto &classNode : node->classes()) {
+    visit(context, classNode.get());
+  }
+  return Status::Ok();
+}
+
+} // namespace cool
@@ -0,0 +1,72 @@
+#include <cool/analysis/analysis_context.h>
+#include <cool/analysis/parallel_type_check.h>
+#include <cool/analysis/type_check.h>
+#include <cool/core/class_registry.h>
+#include <cool/core/logger.h>
+#include <cool/core/logger_collection.h>
+#include <cool/core/thread_pool.h>
+#include <cool/ir/class.h>
+
+#include <cassert>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace cool {
+
+Status ParallelTypeCheckPass::visit(AnalysisContext *context,
+                                    ProgramNode *node) {
+  /// The class hierarchy index is shared by the workers
+  assert(context->classRegistry()->isFrozen());
+
+  const auto &classes = node->classes();
+  const size_t classesCount = classes.size();
+  auto *loggers = context->logger();
+
+  /// Each class logs to its own buffer
+  std::vector<std::shared_ptr<LoggerCollection>> classLoggers(classesCount);
+  std::vector<std::shared_ptr<BufferedLogger>> buffers(classesCount);
+  if (loggers) {
+    for (size_t i = 0; i < classesCount; ++i) {
+      buffers[i] = std::make_shared<BufferedLogger>(loggers->severity());
+      classLoggers[i] = std::make_shared<LoggerCollection>();
+      classLoggers[i]->registerLogger("buffer", buffers[i]);
+      classLoggers[i]->setSourceManager(loggers->sourceManager());
+    }
+  }
+
+  /// Type-check the classes. The statuses are stored as integers, since the
+  /// elements of a vector of booleans cannot be written concurrently
+  std::vector<uint8_t> statuses(classesCount);
+  {
+    ThreadPool pool(threadsCount_);
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < classesCount; ++i) {
+      results.push_back(pool.submit([&, i]() {
+        AnalysisContext classContext(*context, classLoggers[i]);
+        classContext.setCurrentClassName(classes[i]->className());
+        classContext.overlaySymbolTable();
+
+        TypeCheckPass typeCheckPass;
+        statuses[i] =
+            classes[i]->visitNode(&classContext, &typeCheckPass).isOk();
+      }));
+    }
+
+    for (auto &result : results) {
+      result.get();
+    }
+  }
+
+  /// Replay the log messages and check for errors in the order of the classes
+  bool isOk = true;
+  for (size_t i = 0; i < classesCount; ++i) {
+    if (buffers[i]) {
+      buffers[i]->flush(loggers);
+    }
+    isOk &= statuses[i] != 0;
+  }
+  return isOk ? Status::Ok() : Status::Error();
+}
+
+} // namespace cool
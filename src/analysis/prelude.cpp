@@ -0,0 +1,48 @@
+#include <cool/analysis/classes_implementation.h>
+#include <cool/analysis/prelude.h>
+#include <cool/core/class_registry.h>
+#include <cool/ir/class.h>
+
+#include <cassert>
+
+namespace cool {
+
+Prelude::Prelude() : classRegistry_(std::make_shared<ClassRegistry>()) {
+  const auto &classes = ProgramNode::BuiltInClasses();
+  for (const auto &classNode : classes) {
+    auto status = classRegistry_->addClass(classNode);
+    assert(status.isOk());
+  }
+
+  /// Build the tables of the built-in classes. Parent classes come first
+  context_ = std::make_unique<AnalysisContext>(classRegistry_);
+  ClassesImplementationPass pass;
+  for (const auto &classNode : classes) {
+    auto status = classNode->visitNode(context_.get(), &pass);
+    assert(status.isOk());
+  }
+}
+
+std::shared_ptr<const Prelude> Prelude::Get() {
+  static const std::shared_ptr<const Prelude> prelude(new Prelude());
+  return prelude;
+}
+
+std::shared_ptr<ClassRegistry> Prelude::makeClassRegistry() const {
+  return std::make_shared<ClassRegistry>(*classRegistry_);
+}
+
+std::unique_ptr<AnalysisContext>
+Prelude::makeAnalysisContext(std::shared_ptr<ClassRegistry> classRegistry,
+                             std::shared_ptr<LoggerCollection> logger) const {
+  auto context = std::make_unique<AnalysisContext>(classRegistry, logger);
+  for (const auto &classNode : ProgramNode::BuiltInClasses()) {
+    const auto classID = classRegistry_->typeID(classNode->className());
+    assert(classRegistry->hasClass(classID) &&
+           classRegistry->classNode(classID) == classNode.get());
+    context->importTables(*context_, classID);
+  }
+  return context;
+}
+
+} // namespace cool
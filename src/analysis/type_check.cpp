@@ -4,8 +4,8 @@
 #include <cool/ir/class.h>
 #include <cool/ir/expr.h>
 
+#include <algorithm>
 #include <iostream>
-#include <unordered_set>
 
 namespace cool {
 
@@ -22,13 +22,13 @@ Status TypeCheckPass::visit(AnalysisContext *context,
   }
 
   /// Variable cannot be self
-  if (node->id() == "self") {
+  if (node->id() == WellKnownSymbols::Get().self) {
     LOG_ERROR_MESSAGE_WITH_LOCATION(logger, node, "Cannot assign to 'self'");
     return Status::Error();
   }
 
   /// Type-check right hand side of assignment expression
-  auto statusValue = node->rhsExpr()->visitNode(context, this);
+  auto statusValue = dispatch(node->rhsExpr(), context);
   if (!statusValue.isOk()) {
     return statusValue;
   }
@@ -60,7 +60,7 @@ Status TypeCheckPass::visit(AnalysisContext *context, AttributeNode *node) {
   }
 
   /// Return early if an error occurred while evaluating the rhs
-  if (!node->initExpr()->visitNode(context, this).isOk()) {
+  if (!dispatch(node->initExpr(), context).isOk()) {
     return Status::Error();
   }
 
@@ -84,12 +84,11 @@ Status TypeCheckPass::visit(AnalysisContext *context, AttributeNode *node) {
 
 Status TypeCheckPass::visit(AnalysisContext *context,
                             BinaryExprNode<ArithmeticOpID> *node) {
-  const auto intTypeID = context->classRegistry()->typeID("Int");
-  const ExprType returnType = ExprType{.typeID = intTypeID, .isSelf = false};
+  const ExprType returnType = context->classRegistry()->intType();
+  const auto intTypeID = returnType.typeID;
 
-  auto typeCheckF = [context, node](const auto &lhsTypeID,
-                                    const auto &rhsTypeID) {
-    const auto intTypeID = context->classRegistry()->typeID("Int");
+  auto typeCheckF = [context, node, intTypeID](const auto &lhsTypeID,
+                                               const auto &rhsTypeID) {
     if (lhsTypeID != intTypeID || rhsTypeID != intTypeID) {
       auto *logger = context->logger();
       LOG_ERROR_MESSAGE_WITH_LOCATION(
@@ -105,17 +104,18 @@ Status TypeCheckPass::visit(AnalysisContext *context,
 
 Status TypeCheckPass::visit(AnalysisContext *context,
                             BinaryExprNode<ComparisonOpID> *node) {
-  const ExprType returnType = context->classRegistry()->toType("Bool");
+  const auto *registry = context->classRegistry();
+  const ExprType returnType = registry->boolType();
+  const auto intTypeID = registry->intType().typeID;
 
-  /// Allowed types in equality expression
-  std::unordered_set<IdentifierType> types;
-  types.insert(context->classRegistry()->typeID("Bool"));
-  types.insert(context->classRegistry()->typeID("Int"));
-  types.insert(context->classRegistry()->typeID("String"));
+  /// Types that can only be compared for equality with the same type
+  auto isBasicType = [registry, intTypeID](const IdentifierType typeID) {
+    return typeID == intTypeID || typeID == registry->boolType().typeID ||
+           typeID == registry->stringType().typeID;
+  };
 
   /// Type-check function for comparison expressions
-  auto typeCheckC = [context](const auto &lhsTypeID, const auto &rhsTypeID) {
-    const auto intTypeID = context->classRegistry()->typeID("Int");
+  auto typeCheckC = [intTypeID](const auto &lhsTypeID, const auto &rhsTypeID) {
     if (lhsTypeID != intTypeID || rhsTypeID != intTypeID) {
       return GenericError(
           "Error: only integer operands allowed in comparison expressions");
@@ -124,11 +124,10 @@ Status TypeCheckPass::visit(AnalysisContext *context,
   };
 
   /// Type-check function for equality expressions
-  auto typeCheckE = [context, node, types](const auto &lhsTypeID,
-                                           const auto &rhsTypeID) {
-    if (types.count(lhsTypeID) || types.count(rhsTypeID)) {
+  auto typeCheckE = [context, node, registry, isBasicType](
+                        const auto &lhsTypeID, const auto &rhsTypeID) {
+    if (isBasicType(lhsTypeID) || isBasicType(rhsTypeID)) {
       if (lhsTypeID != rhsTypeID) {
-        auto *registry = context->classRegistry();
         auto *logger = context->logger();
         LOG_ERROR_MESSAGE_WITH_LOCATION(
             logger, node,
@@ -151,7 +150,7 @@ Status TypeCheckPass::visit(AnalysisContext *context,
 
 Status TypeCheckPass::visit(AnalysisContext *context, BlockExprNode *node) {
   for (auto &subNode : node->exprs()) {
-    auto status = subNode->visitNode(context, this);
+    auto status = dispatch(subNode.get(), context);
     if (!status.isOk()) {
       return status;
     }
@@ -163,29 +162,30 @@ Status TypeCheckPass::visit(AnalysisContext *context, BlockExprNode *node) {
 }
 
 Status TypeCheckPass::visit(AnalysisContext *context, BooleanExprNode *node) {
-  const auto *registry = context->classRegistry();
-  node->setType(registry->toType("Bool"));
+  node->setType(context->classRegistry()->boolType());
   return Status::Ok();
 }
 
 Status TypeCheckPass::visit(AnalysisContext *context, CaseBindingNode *node) {
   const auto *registry = context->classRegistry();
-  auto *symbolTable = context->symbolTable();
-  symbolTable->enterScope();
 
   /// Type must be valid and not SELF_TYPE
   const auto &typeName = node->typeName();
-  if (typeName == "SELF_TYPE" || !registry->hasClass(typeName)) {
+  if (typeName == WellKnownSymbols::Get().selfType ||
+      !registry->hasClass(typeName)) {
     return GenericError("Error: invalid type of case binding");
   }
 
   /// Modify symbol table
   const auto typeID = registry->typeID(node->typeName());
   const auto exprType = ExprType{.typeID = typeID, .isSelf = false};
+  context->addDependency(typeID);
+  auto *symbolTable = context->symbolTable();
+  symbolTable->enterScope();
   symbolTable->addElement(node->id(), exprType);
 
   /// Type-check case expression, exit scope and return
-  auto statusExpr = node->expr()->visitNode(context, this);
+  auto statusExpr = dispatch(node->expr(), context);
   symbolTable->exitScope();
   return statusExpr;
 }
@@ -195,28 +195,30 @@ Status TypeCheckPass::visit(AnalysisContext *context, CaseExprNode *node) {
   const auto *registry = context->classRegistry();
 
   /// Typecheck expression first
-  auto statusExpr = node->expr()->visitNode(context, this);
+  auto statusExpr = dispatch(node->expr(), context);
   if (!statusExpr.isOk()) {
     return statusExpr;
   }
 
-  /// No duplicate case allowed
-  std::unordered_set<std::string> usedTypes;
+  /// No duplicate case allowed. Case expressions have few branches, so that
+  /// each type is compared with the types of the previous branches
   const auto &caseNodes = node->cases();
-  for (auto caseNode : caseNodes) {
-    auto statusCase = caseNode->visitNode(context, this);
+  for (auto it = caseNodes.begin(); it != caseNodes.end(); ++it) {
+    const auto &caseNode = *it;
+    auto statusCase = dispatch(caseNode.get(), context);
     if (!statusCase.isOk()) {
       return statusCase;
     }
 
-    if (usedTypes.count(caseNode->typeName())) {
+    auto sameType = [&caseNode](const CaseBindingNodePtr &otherNode) {
+      return otherNode->typeName() == caseNode->typeName();
+    };
+    if (std::any_of(caseNodes.begin(), it, sameType)) {
       auto *logger = context->logger();
       LOG_ERROR_MESSAGE_WITH_LOCATION(
           logger, caseNode, "Types of case expressions must be unique");
       return Status::Error();
     }
-
-    usedTypes.insert(caseNode->typeName());
   }
 
   /// Compute the return type
@@ -236,17 +238,23 @@ Status TypeCheckPass::visit(AnalysisContext *context, ClassNode *node) {
   context->setCurrentClassName(node->className());
   auto *symbolTable = context->symbolTable();
 
+  /// Inherited attributes and methods depend on the parent class
+  if (node->hasParentClass()) {
+    const auto *registry = context->classRegistry();
+    context->addDependency(registry->typeID(node->parentClassName()));
+  }
+
   /// Type-check each attribute
   bool isOk = true;
-  for (auto attribute : node->attributes()) {
-    if (!attribute->visitNode(context, this).isOk()) {
+  for (const auto &attribute : node->attributes()) {
+    if (!dispatch(attribute.get(), context).isOk()) {
       isOk = false;
     }
   }
 
   /// Type-check each method
-  for (auto method : node->methods()) {
-    if (!method->visitNode(context, this).isOk()) {
+  for (const auto &method : node->methods()) {
+    if (!dispatch(method.get(), context).isOk()) {
       isOk = false;
     }
   }
@@ -258,7 +266,7 @@ Status TypeCheckPass::visit(AnalysisContext *context, ClassNode *node) {
 Status TypeCheckPass::visit(AnalysisContext *context, DispatchExprNode *node) {
   /// Type-check expression if it exists
   if (node->hasExpr()) {
-    auto statusExpr = node->expr()->visitNode(context, this);
+    auto statusExpr = dispatch(node->expr(), context);
     if (!statusExpr.isOk()) {
       return statusExpr;
     }
@@ -293,25 +301,25 @@ Status TypeCheckPass::visit(AnalysisContext *context, IfExprNode *node) {
   const auto *registry = context->classRegistry();
 
   /// Type-check if-expression
-  auto statusIfExpr = node->ifExpr()->visitNode(context, this);
+  auto statusIfExpr = dispatch(node->ifExpr(), context);
   if (!statusIfExpr.isOk()) {
     return statusIfExpr;
   }
 
   /// Type-check then-expression
-  auto statusThenExpr = node->thenExpr()->visitNode(context, this);
+  auto statusThenExpr = dispatch(node->thenExpr(), context);
   if (!statusThenExpr.isOk()) {
     return statusThenExpr;
   }
 
   /// Type-check else-expression
-  auto statusElseExpr = node->elseExpr()->visitNode(context, this);
+  auto statusElseExpr = dispatch(node->elseExpr(), context);
   if (!statusElseExpr.isOk()) {
     return statusElseExpr;
   }
 
   /// If-expression type must be Bool
-  if (node->ifExpr()->type() != registry->toType("Bool")) {
+  if (node->ifExpr()->type() != registry->boolType()) {
     auto *logger = context->logger();
     LOG_ERROR_MESSAGE_WITH_LOCATION(
         logger, node->ifExpr(),
@@ -333,23 +341,25 @@ Status TypeCheckPass::visit(AnalysisContext *context, LetBindingNode *node) {
 
   /// Helper function to determine the let binding type
   auto getBindingType = [context, registry, node]() {
-    if (node->typeName() == "SELF_TYPE") {
+    if (node->typeName() == WellKnownSymbols::Get().selfType) {
       return ExprType{.typeID = context->currentClassID(), .isSelf = true};
     }
     const auto typeID = registry->typeID(node->typeName());
+    context->addDependency(typeID);
     return ExprType{.typeID = typeID, .isSelf = false};
   };
 
   /// Type must be valid or SELF_TYPE
   const auto &typeName = node->typeName();
-  if (!registry->hasClass(typeName) && typeName != "SELF_TYPE") {
+  if (!registry->hasClass(typeName) &&
+      typeName != WellKnownSymbols::Get().selfType) {
     return GenericError("Error: invalid type of let binding");
   }
 
   /// Type-check let binding initialization expression if needed
   const auto bindingType = getBindingType();
   if (node->hasExpr()) {
-    auto statusExpr = node->expr()->visitNode(context, this);
+    auto statusExpr = dispatch(node->expr(), context);
     if (!statusExpr.isOk()) {
       return statusExpr;
     }
@@ -376,10 +386,10 @@ Status TypeCheckPass::visit(AnalysisContext *context, LetExprNode *node) {
 
   /// Process let bindings
   uint32_t unwindCount = 0;
-  for (auto bindingNode : node->bindings()) {
+  for (const auto &bindingNode : node->bindings()) {
     ++unwindCount;
     symbolTable->enterScope();
-    auto statusBinding = bindingNode->visitNode(context, this);
+    auto statusBinding = dispatch(bindingNode.get(), context);
     if (!statusBinding.isOk()) {
       unwindSymbolTable(unwindCount);
       return statusBinding;
@@ -387,7 +397,7 @@ Status TypeCheckPass::visit(AnalysisContext *context, LetExprNode *node) {
   }
 
   /// Type-check let body and unwind symbol table
-  auto statusExpr = node->expr()->visitNode(context, this);
+  auto statusExpr = dispatch(node->expr(), context);
   unwindSymbolTable(unwindCount);
 
   /// Check for errors, assign type to let expression and return
@@ -400,15 +410,13 @@ Status TypeCheckPass::visit(AnalysisContext *context, LetExprNode *node) {
 
 Status TypeCheckPass::visit(AnalysisContext *context,
                             LiteralExprNode<int32_t> *node) {
-  const auto *registry = context->classRegistry();
-  node->setType(registry->toType("Int"));
+  node->setType(context->classRegistry()->intType());
   return Status::Ok();
 }
 
 Status TypeCheckPass::visit(AnalysisContext *context,
                             LiteralExprNode<std::string> *node) {
-  const auto *registry = context->classRegistry();
-  node->setType(registry->toType("String"));
+  node->setType(context->classRegistry()->stringType());
   return Status::Ok();
 }
 
@@ -426,20 +434,23 @@ Status TypeCheckPass::visit(AnalysisContext *context, MethodNode *node) {
   symbolTable->enterScope();
 
   /// Add method arguments to symbol table
-  for (auto argument : node->arguments()) {
+  for (const auto &argument : node->arguments()) {
     const auto exprType = registry->toType(argument->typeName());
     symbolTable->addElement(argument->id(), exprType);
   }
 
-  /// Type-check method body
-  if (!node->body()->visitNode(context, this).isOk()) {
+  /// Type-check method body. The arguments go out of scope afterwards, so
+  /// that they are not visible from the other methods and the subclasses
+  auto statusBody = dispatch(node->body(), context);
+  symbolTable->exitScope();
+  if (!statusBody.isOk()) {
     return Status::Error();
   }
 
   /// Body type must be a subtype of return type
   const auto returnType =
-      node->returnTypeName() == "SELF_TYPE"
-          ? registry->toSelfType(context->currentClassName())
+      node->returnTypeName() == WellKnownSymbols::Get().selfType
+          ? ExprType{.typeID = context->currentClassID(), .isSelf = true}
           : registry->toType(node->returnTypeName());
   if (!registry->conformTo(node->body()->type(), returnType)) {
     auto logger = context->logger();
@@ -459,8 +470,9 @@ Status TypeCheckPass::visit(AnalysisContext *context, NewExprNode *node) {
   const auto *registry = context->classRegistry();
 
   /// SELF_TYPE needs a special treatment
-  if (node->typeName() == "SELF_TYPE") {
-    node->setType(registry->toSelfType(context->currentClassName()));
+  if (node->typeName() == WellKnownSymbols::Get().selfType) {
+    node->setType(
+        ExprType{.typeID = context->currentClassID(), .isSelf = true});
     return Status::Ok();
   }
 
@@ -475,14 +487,15 @@ Status TypeCheckPass::visit(AnalysisContext *context, NewExprNode *node) {
 
   /// Assign type to expression and return
   node->setType(registry->toType(node->typeName()));
+  context->addDependency(node->type().typeID);
   return Status::Ok();
 }
 
 Status TypeCheckPass::visit(AnalysisContext *context, ProgramNode *node) {
   /// Process all classes, regardless of whether errors are encountered or not
   bool isOk = true;
-  for (auto classNode : node->classes()) {
-    if (!classNode->visitNode(context, this).isOk()) {
+  for (const auto &classNode : node->classes()) {
+    if (!dispatch(classNode.get(), context).isOk()) {
       isOk = false;
     }
   }
@@ -494,7 +507,7 @@ Status TypeCheckPass::visit(AnalysisContext *context,
   auto *logger = context->logger();
 
   /// Type-check expression
-  auto statusExpr = node->expr()->visitNode(context, this);
+  auto statusExpr = dispatch(node->expr(), context);
   if (!statusExpr.isOk()) {
     return statusExpr;
   }
@@ -526,7 +539,7 @@ Status TypeCheckPass::visit(AnalysisContext *context,
 
 Status TypeCheckPass::visit(AnalysisContext *context, UnaryExprNode *node) {
   /// Type-check subexpression
-  auto statusExpr = node->expr()->visitNode(context, this);
+  auto statusExpr = dispatch(node->expr(), context);
   if (!statusExpr.isOk()) {
     return statusExpr;
   }
@@ -538,7 +551,9 @@ Status TypeCheckPass::visit(AnalysisContext *context, UnaryExprNode *node) {
   }
   case UnaryOpID::Not:
   case UnaryOpID::Complement: {
-    const std::string type = node->opID() == UnaryOpID::Not ? "Bool" : "Int";
+    const auto *registry = context->classRegistry();
+    const auto type = node->opID() == UnaryOpID::Not ? registry->boolType()
+                                                      : registry->intType();
     return visitNotOrCompExpr(context, node, type);
   }
   default: {
@@ -552,7 +567,7 @@ Status TypeCheckPass::visit(AnalysisContext *context, UnaryExprNode *node) {
 
 Status TypeCheckPass::visit(AnalysisContext *context, WhileExprNode *node) {
   /// Type-check loop condition expression
-  auto statusLoopCond = node->loopCond()->visitNode(context, this);
+  auto statusLoopCond = dispatch(node->loopCond(), context);
   if (!statusLoopCond.isOk()) {
     return statusLoopCond;
   }
@@ -560,7 +575,7 @@ Status TypeCheckPass::visit(AnalysisContext *context, WhileExprNode *node) {
   /// Type of loop condition must be bool
   const auto *registry = context->classRegistry();
   auto *logger = context->logger();
-  if (node->loopCond()->type() != registry->toType("Bool")) {
+  if (node->loopCond()->type() != registry->boolType()) {
     LOG_ERROR_MESSAGE_WITH_LOCATION(
         logger, node->loopCond(),
         "Loop condition must be of type Bool. Actual type: %s",
@@ -569,13 +584,13 @@ Status TypeCheckPass::visit(AnalysisContext *context, WhileExprNode *node) {
   }
 
   /// Type-check loop body expression
-  auto statusLoopBody = node->loopBody()->visitNode(context, this);
+  auto statusLoopBody = dispatch(node->loopBody(), context);
   if (!statusLoopBody.isOk()) {
     return statusLoopBody;
   }
 
   /// Type of while expression is Object
-  node->setType(registry->toType("Object"));
+  node->setType(registry->objectType());
   return Status::Ok();
 }
 
@@ -587,13 +602,13 @@ Status TypeCheckPass::visitBinaryExpr(AnalysisContext *context,
   const auto *registry = context->classRegistry();
 
   /// Type-check left subexpression
-  auto statusLhs = node->lhsExpr()->visitNode(context, this);
+  auto statusLhs = dispatch(node->lhsExpr(), context);
   if (!statusLhs.isOk()) {
     return statusLhs;
   }
 
   /// Type-check right subexpression
-  auto statusRhs = node->rhsExpr()->visitNode(context, this);
+  auto statusRhs = dispatch(node->rhsExpr(), context);
   if (!statusRhs.isOk()) {
     return statusRhs;
   }
@@ -614,17 +629,15 @@ Status TypeCheckPass::visitBinaryExpr(AnalysisContext *context,
 Status TypeCheckPass::visitIsVoidExpr(AnalysisContext *context,
                                       UnaryExprNode *node) {
   /// Assign Bool type to isvoid expression and return
-  node->setType(context->classRegistry()->toType("Bool"));
+  node->setType(context->classRegistry()->boolType());
   return Status::Ok();
 }
 
 Status TypeCheckPass::visitNotOrCompExpr(AnalysisContext *context,
                                          UnaryExprNode *node,
-                                         const std::string &expectedType) {
-  const auto expectedTypeID = context->classRegistry()->typeID(expectedType);
-
+                                         const ExprType &expectedType) {
   /// Subexpression type must be bool for not, int for complement
-  if (node->expr()->type().typeID != expectedTypeID) {
+  if (node->expr()->type().typeID != expectedType.typeID) {
     return GenericError(
         "Error: operand of unary expression is of incorrect type");
   }
@@ -650,7 +663,9 @@ Status TypeCheckPass::visitDispatchExpr(AnalysisContext *context,
     return Status::Error();
   }
 
-  /// Search for method record in table
+  /// Search for method record in table. The method signature depends on the
+  /// dispatch class
+  context->addDependency(dispatchType.typeID);
   if (!methodTable->findKeyInTable(node->methodName())) {
     LOG_ERROR_MESSAGE_WITH_LOCATION(
         logger, node, "Method %s of class %s has not been defined",
@@ -675,7 +690,7 @@ Status TypeCheckPass::visitDispatchExpr(AnalysisContext *context,
   /// Type-check each parameter
   bool isOk = true;
   for (uint32_t i = 0; i < node->paramsCount(); ++i) {
-    auto statusExpr = node->params()[i]->visitNode(context, this);
+    auto statusExpr = dispatch(node->params()[i].get(), context);
     if (!statusExpr.isOk()) {
       return statusExpr;
     }
@@ -15,11 +15,11 @@ Status CodegenBasePass::codegen(CodegenContext *context, AttributeNode *node,
 
 Status CodegenBasePass::codegen(CodegenContext *context, ClassNode *node,
                                 std::ostream *ios) {
-  for (auto attributeNode : node->attributes()) {
+  for (const auto &attributeNode : node->attributes()) {
     attributeNode->generateCode(context, this, ios);
   }
 
-  for (auto methodNode : node->methods()) {
+  for (const auto &methodNode : node->methods()) {
     methodNode->generateCode(context, this, ios);
   }
 
@@ -32,7 +32,7 @@ Status CodegenBasePass::codegen(CodegenContext *context, MethodNode *node,
     node->body()->generateCode(context, this, ios);
   }
 
-  for (auto argumentNode : node->arguments()) {
+  for (const auto &argumentNode : node->arguments()) {
     argumentNode->generateCode(context, this, ios);
   }
 
@@ -41,7 +41,7 @@ Status CodegenBasePass::codegen(CodegenContext *context, MethodNode *node,
 
 Status CodegenBasePass::codegen(CodegenContext *context, ProgramNode *node,
                                 std::ostream *ios) {
-  for (auto classNode : node->classes()) {
+  for (const auto &classNode : node->classes()) {
     classNode->generateCode(context, this, ios);
   }
   return Status::Ok();
@@ -71,7 +71,7 @@ Status CodegenBasePass::codegen(CodegenContext *context,
 
 Status CodegenBasePass::codegen(CodegenContext *context, BlockExprNode *node,
                                 std::ostream *ios) {
-  for (auto exprNode : node->exprs()) {
+  for (const auto &exprNode : node->exprs()) {
     exprNode->generateCode(context, this, ios);
   }
   return Status::Ok();
@@ -85,7 +85,7 @@ Status CodegenBasePass::codegen(CodegenContext *context, CaseBindingNode *node,
 
 Status CodegenBasePass::codegen(CodegenContext *context, CaseExprNode *node,
                                 std::ostream *ios) {
-  for (auto exprNode : node->cases()) {
+  for (const auto &exprNode : node->cases()) {
     exprNode->generateCode(context, this, ios);
   }
   return Status::Ok();
@@ -93,7 +93,7 @@ Status CodegenBasePass::codegen(CodegenContext *context, CaseExprNode *node,
 
 Status CodegenBasePass::codegen(CodegenContext *context, DispatchExprNode *node,
                                 std::ostream *ios) {
-  for (auto paramNode : node->params()) {
+  for (const auto &paramNode : node->params()) {
     paramNode->generateCode(context, this, ios);
   }
 
@@ -121,7 +121,7 @@ Status CodegenBasePass::codegen(CodegenContext *context, LetBindingNode *node,
 
 Status CodegenBasePass::codegen(CodegenContext *context, LetExprNode *node,
                                 std::ostream *ios) {
-  for (auto bindingNode : node->bindings()) {
+  for (const auto &bindingNode : node->bindings()) {
     bindingNode->generateCode(context, this, ios);
   }
 
@@ -132,7 +132,7 @@ Status CodegenBasePass::codegen(CodegenContext *context, LetExprNode *node,
 Status CodegenBasePass::codegen(CodegenContext *context,
                                 StaticDispatchExprNode *node,
                                 std::ostream *ios) {
-  for (auto paramNode : node->params()) {
+  for (const auto &paramNode : node->params()) {
     paramNode->generateCode(context, this, ios);
   }
 
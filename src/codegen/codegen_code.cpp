@@ -12,18 +12,6 @@ namespace {
 const std::vector<std::string> GLOBAL_LABELS = {"Main_init", "Main.main",
                                                 "Int_init", "String_init"};
 
-/// \brief Get attribute offset
-///
-/// \param[in] symbolTable symbol table
-/// \param[in] attributeID attribute ID
-/// \return the attribute offset in bytes
-template <typename SymbolTableT>
-int32_t GetAttributeOffset(SymbolTableT *symbolTable,
-                           const std::string &attributeID) {
-  auto position = symbolTable->get(attributeID).position;
-  return WORD_SIZE * position + OBJECT_CONTENT_OFFSET;
-}
-
 /// \brief Store the new attribute value in the object and reset the accumulator
 /// register to self.
 ///
@@ -44,9 +32,9 @@ Status CodegenObjectsInitPass::codegen(CodegenContext *context,
                                        AttributeNode *node, std::ostream *ios) {
   /// If attribute has an initialization expression, use it
   if (node->initExpr()) {
-    auto symbolTable = context->symbolTable();
-    const int32_t offset = GetAttributeOffset(symbolTable, node->id());
-    node->initExpr()->generateCode(context, this, ios);
+    assert(node->position() >= 0);
+    const int32_t offset = WORD_SIZE * node->position() + OBJECT_CONTENT_OFFSET;
+    dispatch(node->initExpr(), context, ios);
     StoreAttributeAndSetAccumulatorToSelf(offset, ios);
   }
   return Status::Ok();
@@ -54,37 +42,29 @@ Status CodegenObjectsInitPass::codegen(CodegenContext *context,
 
 Status CodegenObjectsInitPass::codegen(CodegenContext *context, ClassNode *node,
                                        std::ostream *ios) {
-  /// Set current class name in context and fetch symbol table
+  /// Set current class name in context
   context->resetStackPosition();
   context->setCurrentClassName(node->className());
-  auto symbolTable = context->symbolTable();
 
   /// Generate init label. Nothing to do for built-in classes
-  emit_label(node->className() + "_init", ios);
+  emit_label(node->className().str() + "_init", ios);
   if (node->builtIn() && node->className() != "String") {
     emit_jump_and_link_instruction("$ra", ios);
     return Status::Ok();
   }
 
-  /// Load attributes in symbol table
-  for (auto attributeNode : node->attributes()) {
-    const size_t attributePosition = symbolTable->count();
-    IdentifierCodegenInfo attributeInfo(true, attributePosition);
-    symbolTable->addElement(attributeNode->id(), attributeInfo);
-  }
-
   /// Push stack frame
   PushStackFrame(context, ios);
 
   /// Initialize parent class if needed
   if (node->hasParentClass()) {
-    const std::string label = node->parentClassName() + "_init";
+    const std::string label = node->parentClassName().str() + "_init";
     emit_jump_and_link_instruction(label, ios);
   }
 
   /// Initialize attributes
-  for (auto attribute : node->attributes()) {
-    attribute->generateCode(context, this, ios);
+  for (const auto &attribute : node->attributes()) {
+    dispatch(attribute.get(), context, ios);
   }
 
   /// Restore calling stack frame and return control to caller
@@ -92,18 +72,31 @@ Status CodegenObjectsInitPass::codegen(CodegenContext *context, ClassNode *node,
   emit_jump_register_instruction("$ra", ios);
 
   /// Generate code for remaining methods
-  for (auto methodNode : node->methods()) {
-    methodNode->generateCode(context, this, ios);
+  for (const auto &methodNode : node->methods()) {
+    dispatch(methodNode.get(), context, ios);
   }
   return Status::Ok();
 }
 
 Status CodegenObjectsInitPass::codegen(CodegenContext *context,
                                        ProgramNode *node, std::ostream *ios) {
-  /// Emit heap start
+  /// Emit heap start and text segment header
+  codegenHeapStart(context, ios);
+  codegenHeader(context, ios);
+
+  /// Traverse each class
+  return CodegenBasePass::codegen(context, node, ios);
+}
+
+Status CodegenObjectsInitPass::codegenHeapStart(CodegenContext *context,
+                                                std::ostream *ios) {
   emit_label("heap_start", ios);
   emit_word_data(0, ios);
+  return Status::Ok();
+}
 
+Status CodegenObjectsInitPass::codegenHeader(CodegenContext *context,
+                                             std::ostream *ios) {
   /// Emit text directive
   emit_directive(".text", ios);
 
@@ -111,9 +104,7 @@ Status CodegenObjectsInitPass::codegen(CodegenContext *context,
   for (const auto &label : GLOBAL_LABELS) {
     emit_global_declaration(label, ios);
   }
-
-  /// Traverse each class
-  return CodegenBasePass::codegen(context, node, ios);
+  return Status::Ok();
 }
 
 } // namespace cool
@@ -239,14 +239,14 @@ Status GenerateDispatchCode(CodegenContext *context, CodegenCodePass *pass,
                             NodeT *node, FuncT fetchMethodAddress,
                             std::ostream *ios) {
   /// Evaluate parameters
-  for (auto param : node->params()) {
-    param->generateCode(context, pass, ios);
+  for (const auto &param : node->params()) {
+    pass->dispatch(param.get(), context, ios);
     PushAccumulatorToStack(context, ios);
   }
 
   /// Evaluate expresssion if applicable, otherwise fetch self object
   if (node->expr() != nullptr) {
-    node->expr()->generateCode(context, pass, ios);
+    pass->dispatch(node->expr(), context, ios);
   } else {
     emit_lw_instruction("$a0", "$fp", 0, ios);
   }
@@ -256,7 +256,7 @@ Status GenerateDispatchCode(CodegenContext *context, CodegenCodePass *pass,
   emit_bgtz_instruction("$a0", notVoidLabel, ios);
 
   /// Dispatch on void object, start abort procedure
-  emit_li_instruction("$t1", node->lineLoc(), ios);
+  emit_li_instruction("$t1", context->sourceLocation(node->loc()).line, ios);
   GetStringObject(context, "Program_fileName", ios);
   emit_jump_label_instruction("_dispatch_abort", ios);
 
@@ -325,11 +325,11 @@ void SelectCaseStatement(CodegenContext *context, CaseExprNode *node,
   emit_li_instruction("$t2", -1, ios);
 
   /// Loop over bindings
-  for (auto caseBinding : node->cases()) {
+  for (const auto &caseBinding : node->cases()) {
 
     /// Generate label for case binding
     const auto bindingLabel =
-        context->generateLabel("Binding_" + caseBinding->typeName());
+        context->generateLabel("Binding_" + caseBinding->typeName().str());
     caseBinding->setBindingLabel(bindingLabel);
 
     /// Store parent distance into $t3
@@ -360,6 +360,20 @@ void SelectCaseStatement(CodegenContext *context, CaseExprNode *node,
   }
 }
 
+/// \brief Helper function that returns the stack position, relative to the
+/// frame pointer, of an argument or of a let or case variable
+///
+/// \param[in] context Codegen context
+/// \param[in] binding binding of the variable
+/// \return the stack position of the variable
+int32_t StackPosition(CodegenContext *context, const Binding &binding) {
+  if (binding.kind == BindingKind::Argument) {
+    return binding.index;
+  }
+  assert(binding.kind == BindingKind::Local);
+  return context->localPosition(binding.index);
+}
+
 /// \brief Helper function that checks whether $a0 points to a void object and,
 /// if so, interrupt execution
 ///
@@ -385,18 +399,16 @@ void TerminateExecutionIfVoid(CodegenContext *context, FuncT errorFunc,
 Status CodegenCodePass::codegen(CodegenContext *context,
                                 AssignmentExprNode *node, std::ostream *ios) {
   /// Generate code for right hand side expression
-  node->rhsExpr()->generateCode(context, this, ios);
+  dispatch(node->rhsExpr(), context, ios);
 
   /// Update object
-  auto symbolInfo = context->symbolTable()->get(node->id());
-  const int32_t position = symbolInfo.position;
-  const bool isAttribute = symbolInfo.isAttribute;
-  if (isAttribute) {
-    const int32_t offset = OBJECT_CONTENT_OFFSET + position * WORD_SIZE;
+  const auto &binding = node->binding();
+  if (binding.kind == BindingKind::Attribute) {
+    const int32_t offset = OBJECT_CONTENT_OFFSET + binding.index * WORD_SIZE;
     emit_lw_instruction("$t0", "$fp", 0, ios);
     emit_sw_instruction("$a0", "$t0", offset, ios);
   } else {
-    const int32_t offset = position * WORD_SIZE;
+    const int32_t offset = StackPosition(context, binding) * WORD_SIZE;
     emit_sw_instruction("$a0", "$fp", offset, ios);
   }
 
@@ -408,9 +420,9 @@ Status CodegenCodePass::codegen(CodegenContext *context,
                                 BinaryExprNode<ArithmeticOpID> *node,
                                 std::ostream *ios) {
   /// Evaluate left and right hand side expressions
-  node->lhsExpr()->generateCode(context, this, ios);
+  dispatch(node->lhsExpr(), context, ios);
   PushAccumulatorToStack(context, ios);
-  node->rhsExpr()->generateCode(context, this, ios);
+  dispatch(node->rhsExpr(), context, ios);
 
   /// Store lhs value on register $t0
   emit_lw_instruction("$t0", "$sp", WORD_SIZE, ios);
@@ -445,8 +457,8 @@ Status CodegenCodePass::codegen(CodegenContext *context,
 
 Status CodegenCodePass::codegen(CodegenContext *context, BlockExprNode *node,
                                 std::ostream *ios) {
-  for (auto expr : node->exprs()) {
-    expr->generateCode(context, this, ios);
+  for (const auto &expr : node->exprs()) {
+    dispatch(expr.get(), context, ios);
   }
   return Status::Ok();
 }
@@ -464,32 +476,27 @@ Status CodegenCodePass::codegen(CodegenContext *context, CaseBindingNode *node,
   /// Emit label
   emit_label(node->bindingLabel(), ios);
 
-  /// Enter a new symbol table scope
-  auto symbolTable = context->symbolTable();
-  symbolTable->enterScope();
-
-  /// Update symbol table. ID value is stored two positions below top of stack
+  /// Record variable position. Its value is stored two positions below top of
+  /// stack
   const int32_t position = context->stackPosition() + 2;
-  symbolTable->addElement(node->id(), IdentifierCodegenInfo(false, position));
-
-  /// Emit code for case binding
-  node->expr()->generateCode(context, this, ios);
+  context->setLocalPosition(node->binding().index, position);
 
-  /// Exit from the symbol table scope and return
-  symbolTable->exitScope();
+  /// Emit code for case binding and return
+  dispatch(node->expr(), context, ios);
   return Status::Ok();
 }
 
 Status CodegenCodePass::codegen(CodegenContext *context, CaseExprNode *node,
                                 std::ostream *ios) {
   /// Evaluate case expression
-  node->expr()->generateCode(context, this, ios);
+  dispatch(node->expr(), context, ios);
   PushAccumulatorToStack(context, ios);
 
   /// Interrupt execution if case expression is void
   auto voidExprError = [context, node, ios]() {
     GetStringObject(context, "Program_fileName", ios);
-    emit_li_instruction("$t1", node->lineLoc(), ios);
+    emit_li_instruction("$t1", context->sourceLocation(node->loc()).line,
+                        ios);
     emit_jump_label_instruction("_case_abort2", ios);
   };
   TerminateExecutionIfVoid(context, voidExprError, ios);
@@ -519,8 +526,8 @@ Status CodegenCodePass::codegen(CodegenContext *context, CaseExprNode *node,
 
   /// Generate code for each case statement
   const std::string endLabel = context->generateLabel("CaseEnd");
-  for (auto binding : node->cases()) {
-    binding->generateCode(context, this, ios);
+  for (const auto &binding : node->cases()) {
+    dispatch(binding.get(), context, ios);
     emit_jump_label_instruction(endLabel, ios);
   }
 
@@ -540,14 +547,8 @@ Status CodegenCodePass::codegen(CodegenContext *context, DispatchExprNode *node,
     emit_lw_instruction("$t0", "$a0", DISPATCH_TABLE_OFFSET, ios);
 
     /// Fetch method address
-    auto registry = context->classRegistry();
-    auto typeID = registry->typeID(context->currentClassName());
-    if (node->hasExpr()) {
-      typeID = node->expr()->type().typeID;
-    }
-    auto methodTable = context->methodTable(typeID);
-    const size_t position = methodTable->get(node->methodName()).position;
-    emit_lw_instruction("$t0", "$t0", position * WORD_SIZE, ios);
+    assert(node->slot() >= 0);
+    emit_lw_instruction("$t0", "$t0", node->slot() * WORD_SIZE, ios);
   };
 
   return GenerateDispatchCode(context, this, node, fetchMethodAddress, ios);
@@ -556,21 +557,19 @@ Status CodegenCodePass::codegen(CodegenContext *context, DispatchExprNode *node,
 Status CodegenCodePass::codegen(CodegenContext *context, IdExprNode *node,
                                 std::ostream *ios) {
   /// Handle self object separately
-  if (node->id() == "self") {
+  const auto &binding = node->binding();
+  if (binding.kind == BindingKind::Self) {
     emit_lw_instruction("$a0", "$fp", 0, ios);
     return Status::Ok();
   }
 
   /// Handle identifiers other than self
-  auto symbolInfo = context->symbolTable()->get(node->id());
-  const int32_t position = symbolInfo.position;
-  const bool isAttribute = symbolInfo.isAttribute;
-  if (isAttribute) {
-    const int32_t offset = OBJECT_CONTENT_OFFSET + position * WORD_SIZE;
+  if (binding.kind == BindingKind::Attribute) {
+    const int32_t offset = OBJECT_CONTENT_OFFSET + binding.index * WORD_SIZE;
     emit_lw_instruction("$a0", "$fp", 0, ios);
     emit_lw_instruction("$a0", "$a0", offset, ios);
   } else {
-    const int32_t offset = position * WORD_SIZE;
+    const int32_t offset = StackPosition(context, binding) * WORD_SIZE;
     emit_lw_instruction("$a0", "$fp", offset, ios);
   }
   return Status::Ok();
@@ -583,21 +582,21 @@ Status CodegenCodePass::codegen(CodegenContext *context, IfExprNode *node,
   const std::string endLabel = context->generateLabel("EndIf");
 
   /// Emit code for if expression
-  node->ifExpr()->generateCode(context, this, ios);
+  dispatch(node->ifExpr(), context, ios);
 
   /// Load boolean value. Branch if false
   emit_lw_instruction("$a0", "$a0", OBJECT_CONTENT_OFFSET, ios);
   emit_beqz_instruction("$a0", falseLabel, ios);
 
   /// Emit code for then expression
-  node->thenExpr()->generateCode(context, this, ios);
+  dispatch(node->thenExpr(), context, ios);
   emit_jump_label_instruction(endLabel, ios);
 
   /// Emit label for true branch
   emit_label(falseLabel, ios);
 
   /// Emit code for else expression
-  node->elseExpr()->generateCode(context, this, ios);
+  dispatch(node->elseExpr(), context, ios);
 
   /// Emit label for end of if construct and return
   emit_label(endLabel, ios);
@@ -622,51 +621,32 @@ Status CodegenCodePass::codegen(CodegenContext *context,
 
 Status CodegenCodePass::codegen(CodegenContext *context, LetBindingNode *node,
                                 std::ostream *ios) {
-  /// Fetch symbol table
-  auto symbolTable = context->symbolTable();
-
   /// Generate code for right hand side expression first
   if (node->hasExpr()) {
-    node->expr()->generateCode(context, this, ios);
+    dispatch(node->expr(), context, ios);
   } else {
     const std::string typeName = node->typeName();
     CreateDefaultObject(context, typeName, ios);
   }
 
-  /// Create new scope
-  symbolTable->enterScope();
-
-  /// Add binding to symbol table
-  const int32_t position = context->stackPosition();
-  IdentifierCodegenInfo symbolInfo{false, position};
-  symbolTable->addElement(node->id(), symbolInfo);
-
-  /// Increment stack size and return
+  /// Record variable position. Its value is pushed next on the stack
+  context->setLocalPosition(node->binding().index, context->stackPosition());
   return Status::Ok();
 }
 
 Status CodegenCodePass::codegen(CodegenContext *context, LetExprNode *node,
                                 std::ostream *ios) {
-  /// Fetch symbol table
-  auto symbolTable = context->symbolTable();
-
   /// Generate code for let bindings
-  for (auto binding : node->bindings()) {
-    binding->generateCode(context, this, ios);
+  for (const auto &binding : node->bindings()) {
+    dispatch(binding.get(), context, ios);
     PushAccumulatorToStack(context, ios);
   }
 
   /// Generate code for main let expression
-  node->expr()->generateCode(context, this, ios);
-
-  /// Unwind scopes
-  const size_t nCount = node->bindings().size();
-  for (size_t iCount = 0; iCount < nCount; ++iCount) {
-    symbolTable->exitScope();
-  }
+  dispatch(node->expr(), context, ios);
 
   /// Restore stack and return
-  PopStack(context, nCount, ios);
+  PopStack(context, node->bindings().size(), ios);
   return Status::Ok();
 }
 
@@ -680,32 +660,21 @@ Status CodegenCodePass::codegen(CodegenContext *context, MethodNode *node,
   /// Store number of arguments in local variable
   const size_t nArgs = node->arguments().size();
 
-  /// Reset stack size, fetch symbol table and enter a new scope
+  /// Reset stack size
   context->resetStackPosition();
-  auto symbolTable = context->symbolTable();
-  symbolTable->enterScope();
 
   /// Emit method label
-  emit_label(context->currentClassName() + "." + node->id(), ios);
+  emit_label(context->currentClassName().str() + "." + node->id().str(), ios);
 
   /// Push stack frame
   PushStackFrame(context, ios);
 
-  /// Update environment
-  for (size_t iArg = 0; iArg < nArgs; ++iArg) {
-    IdentifierCodegenInfo argInfo(false, nArgs - iArg);
-    symbolTable->addElement(node->arguments()[iArg]->id(), argInfo);
-  }
-
   /// Generate code for method body
-  node->body()->generateCode(context, this, ios);
+  dispatch(node->body(), context, ios);
 
   /// Restore caller's stack frame
   PopStackFrame(context, nArgs, ios);
   emit_jump_register_instruction("$ra", ios);
-
-  /// Exit scope and return
-  symbolTable->exitScope();
   return Status::Ok();
 }
 
@@ -719,15 +688,10 @@ Status CodegenCodePass::codegen(CodegenContext *context, NewExprNode *node,
 Status CodegenCodePass::codegen(CodegenContext *context,
                                 StaticDispatchExprNode *node,
                                 std::ostream *ios) {
-  auto fetchMethodAddress = [context, node, ios]() {
-    auto registry = context->classRegistry();
-    const size_t classID = registry->typeID(node->callerClass());
-
-    auto methodTable = context->methodTable(classID);
-    const size_t position = methodTable->get(node->methodName()).position;
-
-    emit_la_instruction("$t0", node->callerClass() + "_dispTab", ios);
-    emit_lw_instruction("$t0", "$t0", position * WORD_SIZE, ios);
+  auto fetchMethodAddress = [node, ios]() {
+    assert(node->slot() >= 0);
+    emit_la_instruction("$t0", node->callerClass().str() + "_dispTab", ios);
+    emit_lw_instruction("$t0", "$t0", node->slot() * WORD_SIZE, ios);
   };
 
   return GenerateDispatchCode(context, this, node, fetchMethodAddress, ios);
@@ -751,12 +715,12 @@ Status CodegenCodePass::codegen(CodegenContext *context, WhileExprNode *node,
   emit_label(loopBeginLabel, ios);
 
   /// Evaluate loop condition and branch if needed
-  node->loopCond()->generateCode(context, this, ios);
+  dispatch(node->loopCond(), context, ios);
   emit_lw_instruction("$t0", "$a0", OBJECT_CONTENT_OFFSET, ios);
   emit_beqz_instruction("$t0", loopEndLabel, ios);
 
   /// Generate code for loop body and jump to start of loop
-  node->loopBody()->generateCode(context, this, ios);
+  dispatch(node->loopBody(), context, ios);
   emit_jump_label_instruction(loopBeginLabel, ios);
 
   /// Emit label for end of loop construct
@@ -772,9 +736,9 @@ CodegenCodePass::binaryEqualityCodegen(CodegenContext *context,
                                        BinaryExprNode<ComparisonOpID> *node,
                                        std::ostream *ios) {
   /// Evaluate lhs and rhs expressions
-  node->lhsExpr()->generateCode(context, this, ios);
+  dispatch(node->lhsExpr(), context, ios);
   PushAccumulatorToStack(context, ios);
-  node->rhsExpr()->generateCode(context, this, ios);
+  dispatch(node->rhsExpr(), context, ios);
 
   /// Get lhs object type name
   auto registry = context->classRegistry();
@@ -800,9 +764,9 @@ CodegenCodePass::binaryInequalityCodegen(CodegenContext *context,
                                          BinaryExprNode<ComparisonOpID> *node,
                                          std::ostream *ios) {
   /// Evaluate left and right hand side expressions
-  node->lhsExpr()->generateCode(context, this, ios);
+  dispatch(node->lhsExpr(), context, ios);
   PushAccumulatorToStack(context, ios);
-  node->rhsExpr()->generateCode(context, this, ios);
+  dispatch(node->rhsExpr(), context, ios);
 
   /// Store lhs value in $t0
   emit_lw_instruction("$t0", "$sp", WORD_SIZE, ios);
@@ -833,7 +797,7 @@ Status CodegenCodePass::unaryComplementCodegen(CodegenContext *context,
                                                UnaryExprNode *node,
                                                std::ostream *ios) {
   /// Generate code for the unary expression
-  node->expr()->generateCode(context, this, ios);
+  dispatch(node->expr(), context, ios);
 
   /// Store complement of int value on the stack
   emit_lw_instruction("$a0", "$a0", OBJECT_CONTENT_OFFSET, ios);
@@ -854,7 +818,7 @@ Status CodegenCodePass::unaryEqualityCodegen(CodegenContext *context,
                                              UnaryExprNode *node,
                                              std::ostream *ios) {
   /// Generate code for the unary expression
-  node->expr()->generateCode(context, this, ios);
+  dispatch(node->expr(), context, ios);
   if (node->opID() == UnaryOpID::Not) {
     emit_lw_instruction("$a0", "$a0", OBJECT_CONTENT_OFFSET, ios);
   }
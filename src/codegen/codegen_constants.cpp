@@ -120,7 +120,7 @@ Status GenerateStringLiteral(CodegenContext *context, const std::string &label,
 
 Status CodegenConstantsPass::codegen(CodegenContext *context, ClassNode *node,
                                      std::ostream *ios) {
-  const std::string label = node->className() + "_className";
+  const std::string label = node->className().str() + "_className";
   GenerateStringLiteral(context, label, node->className(), ios);
   return CodegenBasePass::codegen(context, node, ios);
 }
@@ -147,6 +147,13 @@ Status CodegenConstantsPass::codegen(CodegenContext *context,
 
 Status CodegenConstantsPass::codegen(CodegenContext *context, ProgramNode *node,
                                      std::ostream *ios) {
+  codegenHeader(context, node, ios);
+  return CodegenBasePass::codegen(context, node, ios);
+}
+
+Status CodegenConstantsPass::codegenHeader(CodegenContext *context,
+                                           ProgramNode *node,
+                                           std::ostream *ios) {
   /// Emit data directive
   emit_directive(".data", ios);
 
@@ -188,7 +195,7 @@ Status CodegenConstantsPass::codegen(CodegenContext *context, ProgramNode *node,
   GenerateIntegerLiteral(context, "Bool_protObj", BOOL_TYPE, 0, ios);
   GenerateIntegerLiteral(context, "Bool_const0", BOOL_TYPE, 0, ios);
   GenerateIntegerLiteral(context, "Bool_const1", BOOL_TYPE, 1, ios);
-  return CodegenBasePass::codegen(context, node, ios);
+  return Status::Ok();
 }
 
 } // namespace cool
@@ -0,0 +1,42 @@
+#include <cool/codegen/codegen_context.h>
+#include <cool/codegen/codegen_helpers.h>
+#include <cool/codegen/codegen_stream.h>
+#include <cool/ir/class.h>
+
+namespace cool {
+
+Status CodegenStream::begin(ProgramNode *node) {
+  /// Generate the data segment header and the class tables
+  auto status = constantsPass_.codegenHeader(context_, node, ios_);
+  if (!status.isOk()) {
+    return status;
+  }
+
+  status = tablesPass_.codegen(context_, node, ios_);
+  if (!status.isOk()) {
+    return status;
+  }
+
+  /// Generate the text segment header
+  return objectsInitPass_.codegenHeader(context_, ios_);
+}
+
+Status CodegenStream::generateClass(ClassNode *node) {
+  /// Generate the class constants
+  emit_directive(".data", ios_);
+  auto status = node->generateCode(context_, &constantsPass_, ios_);
+  if (!status.isOk()) {
+    return status;
+  }
+
+  /// Generate the class code
+  emit_directive(".text", ios_);
+  return node->generateCode(context_, &objectsInitPass_, ios_);
+}
+
+Status CodegenStream::end() {
+  emit_directive(".data", ios_);
+  return objectsInitPass_.codegenHeapStart(context_, ios_);
+}
+
+} // namespace cool
@@ -25,7 +25,7 @@ void GenerateClassNameTable(CodegenContext *context, ProgramNode *node,
   /// Sort classes by ID
   auto registry = context->classRegistry();
   std::map<int32_t, std::string> idToName;
-  for (auto classNode : node->classes()) {
+  for (const auto &classNode : node->classes()) {
     idToName[registry->typeID(classNode->className())] = classNode->className();
   }
 
@@ -49,7 +49,7 @@ void GenerateClassDispatchTableIndexTable(CodegenContext *context,
   /// Sort classes by ID
   auto registry = context->classRegistry();
   std::map<int32_t, std::string> idToName;
-  for (auto classNode : node->classes()) {
+  for (const auto &classNode : node->classes()) {
     idToName[registry->typeID(classNode->className())] = classNode->className();
   }
 
@@ -88,16 +88,17 @@ void GenerateClassHierarchyTable(CodegenContext *context, ClassNode *node,
   /// Compute class hierarchy
   size_t distance = 0;
   std::vector<size_t> hierarchy(registry->size(), -1);
-  while (node) {
-    const size_t typeID = registry->typeID(node->className());
+  IdentifierType typeID = registry->typeID(className);
+  while (true) {
     hierarchy[typeID] = distance++;
-    node = node->hasParentClass()
-               ? registry->classNode(node->parentClassName()).get()
-               : nullptr;
+    if (!registry->hasParentClass(typeID)) {
+      break;
+    }
+    typeID = registry->parentID(typeID);
   }
 
   /// Generate class hierarchy table
-  emit_label(className + CLASS_PARENT_TABLE_SUFFIX, ios);
+  emit_label(className.str() + CLASS_PARENT_TABLE_SUFFIX, ios);
   for (auto value : hierarchy) {
     emit_word_data(value, ios);
   }
@@ -109,7 +110,7 @@ void GenerateClassHierarchyTableIndexTable(CodegenContext *context,
   /// Sort classes by ID
   auto registry = context->classRegistry();
   std::map<int32_t, std::string> idToName;
-  for (auto classNode : node->classes()) {
+  for (const auto &classNode : node->classes()) {
     idToName[registry->typeID(classNode->className())] = classNode->className();
   }
 
@@ -125,37 +126,23 @@ void GenerateClassHierarchyTableIndexTable(CodegenContext *context,
 
 Status CodegenTablesPass::codegen(CodegenContext *context, ClassNode *node,
                                   std::ostream *ios) {
-  /// Initialize symbol table and method table
   context->setCurrentClassName(node->className());
-  context->initializeTables();
 
   /// Generate the class hierarchy table
   GenerateClassHierarchyTable(context, node, ios);
 
-  /// Compute the position of each method in the dispatch table
-  auto methodTable = context->methodTable();
-  for (auto methodNode : node->methods()) {
-    size_t methodPosition = 0;
-    if (!methodTable->findKey(methodNode->id())) {
-      methodPosition = methodTable->count();
-    } else {
-      methodPosition = methodTable->get(methodNode->id()).position;
-    }
-    MethodCodegenInfo methodInfo(node->className(), methodPosition);
-    methodTable->addElement(methodNode->id(), methodInfo);
-  }
-
-  /// Assemble the dispatch table
-  std::map<size_t, std::string> methods;
-  for (auto it = methodTable->begin(); it != methodTable->end(); ++it) {
-    const std::string label = it->second.className + "." + it->first;
-    methods[it->second.position] = label;
-  }
-
-  /// Generate code for the dispatch table
-  emit_label(node->className() + "_dispTab", ios);
-  for (auto it = methods.begin(); it != methods.end(); ++it) {
-    emit_word_data(it->second, ios);
+  /// Generate code for the dispatch table, whose slots are in the class layout
+  auto registry = context->classRegistry();
+  const auto *layout = context->classLayout();
+  const auto classID = registry->typeID(node->className());
+  std::vector<DispatchTableEntry> entries;
+  layout->dispatchTable(classID, &entries);
+
+  emit_label(node->className().str() + "_dispTab", ios);
+  for (const auto &entry : entries) {
+    const std::string label = registry->className(entry.classID).str() + "." +
+                              layout->selectorName(entry.selectorID).str();
+    emit_word_data(label, ios);
   }
 
   /// Nothing to do for built-in classes
@@ -168,22 +155,21 @@ Status CodegenTablesPass::codegen(CodegenContext *context, ClassNode *node,
   std::vector<ClassNode *> nodes{currentNode};
 
   /// Fetch ancestors
-  size_t nAttributes = currentNode->attributes().size();
-  auto registry = context->classRegistry();
-  while (currentNode->hasParentClass()) {
-    currentNode = registry->classNode(currentNode->parentClassName()).get();
-    nAttributes += currentNode->attributes().size();
+  auto currentID = classID;
+  while (registry->hasParentClass(currentID)) {
+    currentID = registry->parentID(currentID);
+    currentNode = registry->classNode(currentID);
     nodes.push_back(currentNode);
   }
   std::reverse(nodes.begin(), nodes.end());
 
   /// Generate code for prototype object
-  emit_object_label(node->className() + "_protObj", ios);
-  emit_word_data(registry->typeID(node->className()), ios);
-  emit_word_data(nAttributes + 3, ios);
-  emit_word_data(node->className() + "_dispTab", ios);
+  emit_object_label(node->className().str() + "_protObj", ios);
+  emit_word_data(classID, ios);
+  emit_word_data(layout->attributesCount(classID) + 3, ios);
+  emit_word_data(node->className().str() + "_dispTab", ios);
   for (auto node : nodes) {
-    for (auto attributeNode : node->attributes()) {
+    for (const auto &attributeNode : node->attributes()) {
       GenerateDefaultAttributeValue(attributeNode.get(), ios);
     }
   }
@@ -202,7 +188,7 @@ Status CodegenTablesPass::codegen(CodegenContext *context, ProgramNode *node,
   GenerateClassHierarchyTableIndexTable(context, node, ios);
 
   /// Generate class symbol tables and prototype objects
-  for (auto classNode : node->classes()) {
+  for (const auto &classNode : node->classes()) {
     classNode->generateCode(context, this, ios);
   }
   return Status::Ok();
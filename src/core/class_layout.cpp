@@ -0,0 +1,151 @@
+#include <cool/core/class_layout.h>
+#include <cool/core/class_registry.h>
+#include <cool/ir/class.h>
+
+#include <utility>
+
+namespace cool {
+
+constexpr SelectorID ClassLayout::INVALID_SELECTOR;
+
+ClassLayout::ClassLayout(const ClassRegistry &registry) {
+  /// Build the children lists and collect the root classes
+  const auto classesCount = static_cast<IdentifierType>(registry.size());
+  classes_.resize(classesCount);
+  std::vector<std::vector<IdentifierType>> children(classesCount);
+  std::vector<IdentifierType> roots;
+  for (IdentifierType classID = 0; classID < classesCount; ++classID) {
+    if (!registry.hasParentClass(classID)) {
+      roots.push_back(classID);
+      continue;
+    }
+
+    const auto parentID = registry.parentID(classID);
+    classes_[classID].parentID = parentID;
+    children[parentID].push_back(classID);
+  }
+
+  /// Lay out a class once its parent class is laid out. The classes on the
+  /// path from the root are the ancestors of the class, and a method whose
+  /// selector was introduced by an ancestor keeps its slot
+  std::vector<bool> onPath(classesCount, false);
+  uint32_t position = 0;
+  auto layOut = [&](const IdentifierType classID) {
+    auto &record = classes_[classID];
+    record.preorderBegin = position++;
+    onPath[classID] = true;
+
+    if (record.parentID >= 0) {
+      const auto &parentRecord = classes_[record.parentID];
+      record.attributesBegin = parentRecord.attributesCount;
+      record.slotsCount = parentRecord.slotsCount;
+    }
+
+    const auto *node = registry.classNode(classID);
+    record.attributesCount =
+        record.attributesBegin +
+        static_cast<uint32_t>(node->attributes().size());
+
+    record.methodsBegin = static_cast<uint32_t>(methods_.size());
+    for (const auto &methodNode : node->methods()) {
+      const auto selectorID = internSelector(methodNode->id());
+      auto &introductions = introductions_[selectorID];
+      auto it = introductions.begin();
+      while (it != introductions.end() &&
+             (it->classID == classID || !onPath[it->classID])) {
+        ++it;
+      }
+
+      uint32_t slot = 0;
+      if (it != introductions.end()) {
+        slot = it->slot;
+      } else {
+        slot = record.slotsCount++;
+        introductions.push_back(Introduction{classID, slot});
+      }
+      methods_.push_back(MethodSlot{selectorID, slot});
+    }
+    record.methodsEnd = static_cast<uint32_t>(methods_.size());
+  };
+
+  /// Visit the classes in depth-first preorder. An explicit stack is used
+  /// since inheritance chains can be arbitrarily deep
+  std::vector<std::pair<IdentifierType, size_t>> stack;
+  for (const auto root : roots) {
+    layOut(root);
+    stack.push_back({root, 0});
+    while (!stack.empty()) {
+      auto &top = stack.back();
+      if (top.second < children[top.first].size()) {
+        const auto childID = children[top.first][top.second++];
+        layOut(childID);
+        stack.push_back({childID, 0});
+        continue;
+      }
+
+      classes_[top.first].preorderEnd = position;
+      onPath[top.first] = false;
+      stack.pop_back();
+    }
+  }
+}
+
+std::shared_ptr<const ClassLayout>
+ClassLayout::MakeClassLayout(const ClassRegistry &registry) {
+  assert(registry.isFrozen());
+  return std::shared_ptr<const ClassLayout>(new ClassLayout(registry));
+}
+
+int32_t ClassLayout::slot(const IdentifierType classID,
+                          const SelectorID selectorID) const {
+  assert(selectorID < introductions_.size());
+
+  /// At most one of the classes that introduce the selector is an ancestor
+  const auto position = record(classID).preorderBegin;
+  for (const auto &introduction : introductions_[selectorID]) {
+    const auto &ancestorRecord = classes_[introduction.classID];
+    if (ancestorRecord.preorderBegin <= position &&
+        position < ancestorRecord.preorderEnd) {
+      return static_cast<int32_t>(introduction.slot);
+    }
+  }
+  return -1;
+}
+
+void ClassLayout::dispatchTable(
+    const IdentifierType classID,
+    std::vector<DispatchTableEntry> *entries) const {
+  /// Collect the ancestors of the class, the class included
+  std::vector<IdentifierType> ancestors;
+  for (auto ancestorID = classID; ancestorID >= 0;
+       ancestorID = classes_[ancestorID].parentID) {
+    ancestors.push_back(ancestorID);
+  }
+
+  /// Methods defined by a class replace those defined by its ancestors
+  entries->assign(record(classID).slotsCount,
+                  DispatchTableEntry{INVALID_SELECTOR, -1});
+  for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
+    const auto &ancestorRecord = classes_[*it];
+    for (auto i = ancestorRecord.methodsBegin; i < ancestorRecord.methodsEnd;
+         ++i) {
+      const auto &method = methods_[i];
+      (*entries)[method.slot] = DispatchTableEntry{method.selectorID, *it};
+    }
+  }
+}
+
+SelectorID ClassLayout::internSelector(const Symbol &methodName) {
+  auto it = selectorIDs_.find(methodName);
+  if (it != selectorIDs_.end()) {
+    return it->second;
+  }
+
+  const auto selectorID = static_cast<SelectorID>(selectorNames_.size());
+  selectorIDs_.insert({methodName, selectorID});
+  selectorNames_.push_back(methodName);
+  introductions_.emplace_back();
+  return selectorID;
+}
+
+} // namespace cool
@@ -1,43 +1,110 @@
 #include <cool/core/class_registry.h>
 #include <cool/ir/class.h>
 
-#include <unordered_set>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace cool {
 
 Status ClassRegistry::addClass(std::shared_ptr<ClassNode> node) {
+  /// Hierarchy index would be invalidated by a new class
+  if (frozen_) {
+    return cool::GenericError("Error: class registry is frozen");
+  }
+
   /// Class ID must have not been added to registry before
   IdentifierType classID = findOrCreateClassID(node->className());
-  if (classRegistry_.count(classID) > 0) {
+  if (classes_[classID].node != nullptr) {
     return cool::GenericError("Error: class is already defined");
   }
 
+  /// Resolve parent class ID. Parent class may be defined later
+  IdentifierType parentID = -1;
+  if (node->hasParentClass()) {
+    parentID = findOrCreateClassID(node->parentClassName());
+  }
+
   /// Add class to registry and return
-  classRegistry_[classID] = std::move(node);
+  classes_[classID].node = std::move(node);
+  classes_[classID].parentID = parentID;
+  ++classesCount_;
   return Status::Ok();
 }
 
-const std::string &
-ClassRegistry::className(const IdentifierType classID) const {
-  auto it = classRegistry_.find(classID);
-  assert(it != classRegistry_.end());
-  return it->second->className();
+Status ClassRegistry::reserveClassIDs(const std::vector<Symbol> &classNames) {
+  if (frozen_) {
+    return cool::GenericError("Error: class registry is frozen");
+  }
+
+  for (size_t i = 0; i < classNames.size(); ++i) {
+    const IdentifierType classID = findOrCreateClassID(classNames[i]);
+    if (classID != static_cast<IdentifierType>(i)) {
+      return cool::GenericError("Error: class ID cannot be reserved");
+    }
+  }
+  return Status::Ok();
 }
 
 uint32_t ClassRegistry::distanceToRoot(const IdentifierType &classID) const {
-  auto tailClassNode = classRegistry_.find(classID)->second;
+  if (frozen_) {
+    return classes_[classID].depth;
+  }
 
   uint32_t distance = 0;
-  while (tailClassNode->hasParentClass()) {
+  for (auto tailID = classes_[classID].parentID; tailID >= 0;
+       tailID = classes_[tailID].parentID) {
     ++distance;
-    auto className = tailClassNode->parentClassName();
-    auto classID = namesToIDs_.find(className)->second;
-    tailClassNode = classRegistry_.find(classID)->second;
   }
-
   return distance;
 }
 
+IdentifierType
+ClassRegistry::chainWalkAncestor(const IdentifierType firstClassID,
+                                 const IdentifierType secondClassID) const {
+  auto aDistance = distanceToRoot(firstClassID);
+  auto bDistance = distanceToRoot(secondClassID);
+
+  if (aDistance < bDistance) {
+    return chainWalkAncestor(secondClassID, firstClassID);
+  }
+
+  auto tailIDA = firstClassID;
+  auto tailIDB = secondClassID;
+  while (aDistance > bDistance) {
+    --aDistance;
+    tailIDA = classes_[tailIDA].parentID;
+  }
+
+  while (tailIDA != tailIDB) {
+    tailIDA = classes_[tailIDA].parentID;
+    tailIDB = classes_[tailIDB].parentID;
+  }
+
+  return tailIDA;
+}
+
+IdentifierType
+ClassRegistry::eulerTourAncestor(const IdentifierType firstClassID,
+                                 const IdentifierType secondClassID) const {
+  auto first = classes_[firstClassID].eulerFirst;
+  auto last = classes_[secondClassID].eulerFirst;
+  if (first > last) {
+    std::swap(first, last);
+  }
+
+  /// Two overlapping power-of-two ranges cover the tour range [first, last]
+  uint32_t level = 0;
+  while ((2u << level) <= last - first + 1) {
+    ++level;
+  }
+
+  const auto &row = eulerSparseTable_[level];
+  const auto leftID = row[first];
+  const auto rightID = row[last + 1 - (1u << level)];
+  return classes_[leftID].depth <= classes_[rightID].depth ? leftID : rightID;
+}
+
 ExprType ClassRegistry::leastCommonAncestor(const ExprType &descendantA,
                                             const ExprType &descendantB) const {
   /// Least common ancestor of identical types is the type itself
@@ -45,47 +112,146 @@ ExprType ClassRegistry::leastCommonAncestor(const ExprType &descendantA,
     return descendantA;
   }
 
-  auto aDistance = distanceToRoot(descendantA.typeID);
-  auto bDistance = distanceToRoot(descendantB.typeID);
+  /// Look up the pair in the cache first
+  const auto firstClassID = std::min(descendantA.typeID, descendantB.typeID);
+  const auto secondClassID = std::max(descendantA.typeID, descendantB.typeID);
+  const size_t slot =
+      (static_cast<size_t>(firstClassID) * 31 + secondClassID) %
+      ANCESTOR_CACHE_SIZE;
 
-  if (aDistance < bDistance) {
-    return leastCommonAncestor(descendantB, descendantA);
+  auto findAncestor = [this, firstClassID, secondClassID]() {
+    return frozen_ ? eulerTourAncestor(firstClassID, secondClassID)
+                   : chainWalkAncestor(firstClassID, secondClassID);
+  };
+
+  /// IDs too large for the packed fields bypass the cache
+  const uint64_t idMask = (uint64_t(1) << ANCESTOR_ID_BITS) - 1;
+  if (static_cast<uint64_t>(secondClassID) > idMask) {
+    return ExprType{.typeID = findAncestor(), .isSelf = false};
   }
 
-  auto tailClassNodeA = classRegistry_.find(descendantA.typeID)->second;
-  auto tailClassNodeB = classRegistry_.find(descendantB.typeID)->second;
+  /// The two class IDs form the high bits of the entry, the ancestor ID the
+  /// low bits. An empty entry never matches, since its top bit is set
+  const uint64_t key = ((static_cast<uint64_t>(firstClassID)
+                         << ANCESTOR_ID_BITS) |
+                        static_cast<uint64_t>(secondClassID))
+                       << ANCESTOR_ID_BITS;
+  auto &entry = ancestorCache_[slot].value;
+  auto packed = entry.load(std::memory_order_relaxed);
+  if ((packed & ~idMask) != key) {
+    packed = key | static_cast<uint64_t>(findAncestor());
+    entry.store(packed, std::memory_order_relaxed);
+  }
 
-  while (aDistance > bDistance) {
-    --aDistance;
-    auto className = tailClassNodeA->parentClassName();
-    auto classID = namesToIDs_.find(className)->second;
-    tailClassNodeA = classRegistry_.find(classID)->second;
+  const auto ancestorID = static_cast<IdentifierType>(packed & idMask);
+  return ExprType{.typeID = ancestorID, .isSelf = false};
+}
+
+Status ClassRegistry::freeze() {
+  if (frozen_) {
+    return Status::Ok();
+  }
+
+  /// Build the children lists and collect the root classes
+  const auto classesCount = static_cast<IdentifierType>(classes_.size());
+  std::vector<std::vector<IdentifierType>> children(classesCount);
+  std::vector<IdentifierType> roots;
+  for (IdentifierType classID = 0; classID < classesCount; ++classID) {
+    if (!hasClass(classID)) {
+      return GenericError("Error: parent class is not defined");
+    }
+
+    const auto parentID = classes_[classID].parentID;
+    if (parentID < 0) {
+      roots.push_back(classID);
+    } else {
+      children[parentID].push_back(classID);
+    }
   }
 
-  while (tailClassNodeA != tailClassNodeB) {
-    {
-      auto className = tailClassNodeB->parentClassName();
-      auto classID = namesToIDs_.find(className)->second;
-      tailClassNodeA = classRegistry_.find(classID)->second;
+  /// Number the classes in depth-first preorder. An explicit stack is used
+  /// since inheritance chains can be arbitrarily deep. The same traversal
+  /// records the Euler tour of the tree
+  std::vector<IdentifierType> eulerTour;
+  std::vector<std::pair<IdentifierType, size_t>> stack;
+  uint32_t position = 0;
+  for (auto root : roots) {
+    classes_[root].depth = 0;
+    classes_[root].preorderBegin = position++;
+    classes_[root].eulerFirst = eulerTour.size();
+    eulerTour.push_back(root);
+    stack.emplace_back(root, 0);
+    while (!stack.empty()) {
+      auto &top = stack.back();
+      const auto &topChildren = children[top.first];
+      if (top.second < topChildren.size()) {
+        const auto childID = topChildren[top.second++];
+        auto &childRecord = classes_[childID];
+        childRecord.depth = classes_[top.first].depth + 1;
+        childRecord.preorderBegin = position++;
+        childRecord.eulerFirst = eulerTour.size();
+        eulerTour.push_back(childID);
+        stack.emplace_back(childID, 0);
+      } else {
+        classes_[top.first].preorderEnd = position;
+        stack.pop_back();
+        if (!stack.empty()) {
+          eulerTour.push_back(stack.back().first);
+        }
+      }
     }
+  }
 
-    {
-      auto className = tailClassNodeB->parentClassName();
-      auto classID = namesToIDs_.find(className)->second;
-      tailClassNodeB = classRegistry_.find(classID)->second;
+  /// Classes not reachable from a root are part of a cycle
+  if (position != static_cast<uint32_t>(classesCount)) {
+    return GenericError("Error. Cyclic classes definition detected");
+  }
+
+  /// Build the sparse table for range minimum queries over the Euler tour
+  std::vector<std::vector<IdentifierType>> sparseTable;
+  sparseTable.push_back(std::move(eulerTour));
+  for (size_t width = 2; width <= sparseTable[0].size(); width *= 2) {
+    const auto &previousRow = sparseTable.back();
+    std::vector<IdentifierType> row(sparseTable[0].size() - width + 1);
+    for (size_t i = 0; i < row.size(); ++i) {
+      const auto leftID = previousRow[i];
+      const auto rightID = previousRow[i + width / 2];
+      row[i] =
+          classes_[leftID].depth <= classes_[rightID].depth ? leftID : rightID;
     }
+    sparseTable.push_back(std::move(row));
   }
 
-  const auto typeID = namesToIDs_.find(tailClassNodeA->className())->second;
-  return ExprType{.typeID = typeID, .isSelf = false};
+  eulerSparseTable_ = std::move(sparseTable);
+  ancestorCache_.fill(AncestorCacheEntry{});
+  frozen_ = true;
+  return Status::Ok();
 }
 
 IdentifierType
-ClassRegistry::findOrCreateClassID(const std::string &className) {
-  if (namesToIDs_.count(className) == 0) {
-    namesToIDs_[className] = namesToIDs_.size();
+ClassRegistry::findOrCreateClassID(const Symbol &className) {
+  auto it = namesToIDs_.find(className);
+  if (it != namesToIDs_.end()) {
+    return it->second;
   }
-  return namesToIDs_[className];
+
+  const auto classID = static_cast<IdentifierType>(classes_.size());
+  namesToIDs_.emplace(className, classID);
+  classes_.emplace_back();
+  classes_.back().name = className;
+
+  /// Record the IDs of the built-in classes
+  const auto &symbols = WellKnownSymbols::Get();
+  if (className == symbols.object) {
+    builtInIDs_.object = classID;
+  } else if (className == symbols.intType) {
+    builtInIDs_.intType = classID;
+  } else if (className == symbols.boolType) {
+    builtInIDs_.boolType = classID;
+  } else if (className == symbols.stringType) {
+    builtInIDs_.stringType = classID;
+  }
+  return classID;
 }
 
 bool ClassRegistry::conformTo(const ExprType &childType,
@@ -95,6 +261,14 @@ bool ClassRegistry::conformTo(const ExprType &childType,
     return childType.isSelf && (childType.typeID == parentType.typeID);
   }
 
+  /// Constant time check using the class hierarchy index
+  if (frozen_) {
+    const auto childPosition = classes_[childType.typeID].preorderBegin;
+    const auto &parentRecord = classes_[parentType.typeID];
+    return parentRecord.preorderBegin <= childPosition &&
+           childPosition < parentRecord.preorderEnd;
+  }
+
   auto childDistance = distanceToRoot(childType.typeID);
   const auto parentDistance = distanceToRoot(parentType.typeID);
 
@@ -102,19 +276,13 @@ bool ClassRegistry::conformTo(const ExprType &childType,
     return false;
   }
 
-  auto tailClassNode = classRegistry_.find(childType.typeID)->second;
+  auto tailID = childType.typeID;
   while (childDistance > parentDistance) {
     --childDistance;
-    auto className = tailClassNode->parentClassName();
-    auto classID = namesToIDs_.find(className)->second;
-    tailClassNode = classRegistry_.find(classID)->second;
+    tailID = classes_[tailID].parentID;
   }
 
-  auto targetID = namesToIDs_.find(tailClassNode->className())->second;
-  if (parentType.typeID == targetID) {
-    return true;
-  }
-  return false;
+  return parentType.typeID == tailID;
 }
 
 } // namespace cool
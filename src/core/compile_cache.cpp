@@ -0,0 +1,190 @@
+#include <cool/core/compile_cache.h>
+#include <cool/core/sha256.h>
+
+#include "compiler_stamp.h"
+
+#include <atomic>
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cool {
+
+namespace {
+
+/// Extension of the cache entries
+const std::string ENTRY_EXTENSION = ".s";
+
+/// Name of the statistics file, and bytes recorded for hits and misses
+const std::string STATISTICS_FILE_NAME = "statistics";
+constexpr char HIT = 'h';
+constexpr char MISS = 'm';
+
+/// \brief Helper function to append a field to a hash, preceded by its length
+/// so that the boundaries between fields are unambiguous
+///
+/// \param[in] field field to append
+/// \param[out] hash hash
+void HashField(const std::string &field, Sha256 *hash) {
+  const uint64_t length = field.length();
+  hash->update(&length, sizeof(length));
+  hash->update(field);
+}
+
+/// \brief Helper function to check whether a string ends with a suffix
+///
+/// \param[in] value string
+/// \param[in] suffix suffix
+/// \return true if the string ends with the suffix, false otherwise
+bool EndsWith(const std::string &value, const std::string &suffix) {
+  return value.length() >= suffix.length() &&
+         value.compare(value.length() - suffix.length(), suffix.length(),
+                       suffix) == 0;
+}
+
+} // namespace
+
+Status CompileCache::initialize() const {
+  if (mkdir(directory_.c_str(), 0755) != 0 && errno != EEXIST) {
+    return GenericError("Error: cache directory cannot be created: " +
+                        directory_);
+  }
+
+  struct stat directoryStat;
+  if (stat(directory_.c_str(), &directoryStat) != 0 ||
+      !S_ISDIR(directoryStat.st_mode)) {
+    return GenericError("Error: cache directory is not a directory: " +
+                        directory_);
+  }
+  return Status::Ok();
+}
+
+Status CompileCache::MakeKey(const std::vector<std::string> &filePaths,
+                             const std::vector<std::string> &options,
+                             std::string *key) {
+  Sha256 hash;
+  HashField(CompilerStamp(), &hash);
+
+  HashField(std::to_string(options.size()), &hash);
+  for (const auto &option : options) {
+    HashField(option, &hash);
+  }
+
+  /// Hash the name and the contents of each file
+  HashField(std::to_string(filePaths.size()), &hash);
+  for (const auto &filePath : filePaths) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file) {
+      return GenericError("Error: file cannot be read: " + filePath);
+    }
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    HashField(filePath, &hash);
+    HashField(contents.str(), &hash);
+  }
+
+  *key = hash.hexDigest();
+  return Status::Ok();
+}
+
+std::string CompileCache::CompilerStamp() { return COOL_COMPILER_STAMP; }
+
+bool CompileCache::lookup(const std::string &key, std::string *code) const {
+  std::ifstream file(entryPath(key), std::ios::binary);
+  if (!file) {
+    recordLookup(false);
+    return false;
+  }
+
+  std::ostringstream contents;
+  contents << file.rdbuf();
+  *code = contents.str();
+  recordLookup(true);
+  return true;
+}
+
+Status CompileCache::store(const std::string &key,
+                           const std::string &code) const {
+  /// Temporary files are unique across processes and threads
+  static std::atomic<uint32_t> counter{0};
+  const std::string path = entryPath(key);
+  const std::string temporaryPath = path + ".tmp." +
+                                    std::to_string(getpid()) + "." +
+                                    std::to_string(counter++);
+
+  {
+    std::ofstream file(temporaryPath, std::ios::binary);
+    file.write(code.data(), code.size());
+    file.close();
+    if (!file) {
+      unlink(temporaryPath.c_str());
+      return GenericError("Error: cache entry cannot be written: " + path);
+    }
+  }
+
+  if (rename(temporaryPath.c_str(), path.c_str()) != 0) {
+    unlink(temporaryPath.c_str());
+    return GenericError("Error: cache entry cannot be written: " + path);
+  }
+  return Status::Ok();
+}
+
+Status CompileCache::statistics(CompileCacheStatistics *statistics) const {
+  *statistics = CompileCacheStatistics();
+
+  /// Count hits and misses
+  std::ifstream file(directory_ + "/" + STATISTICS_FILE_NAME,
+                     std::ios::binary);
+  char outcome;
+  while (file.get(outcome)) {
+    statistics->hits += outcome == HIT ? 1 : 0;
+    statistics->misses += outcome == MISS ? 1 : 0;
+  }
+
+  /// Count entries and their size
+  DIR *directory = opendir(directory_.c_str());
+  if (directory == nullptr) {
+    return GenericError("Error: cache directory cannot be read: " +
+                        directory_);
+  }
+
+  while (const struct dirent *entry = readdir(directory)) {
+    const std::string name(entry->d_name);
+    struct stat entryStat;
+    if (!EndsWith(name, ENTRY_EXTENSION) ||
+        stat((directory_ + "/" + name).c_str(), &entryStat) != 0) {
+      continue;
+    }
+    statistics->entries += 1;
+    statistics->bytes += entryStat.st_size;
+  }
+  closedir(directory);
+  return Status::Ok();
+}
+
+std::string CompileCache::entryPath(const std::string &key) const {
+  return directory_ + "/" + key + ENTRY_EXTENSION;
+}
+
+void CompileCache::recordLookup(const bool hit) const {
+  /// Appends of a single byte are atomic, even across processes
+  const std::string path = directory_ + "/" + STATISTICS_FILE_NAME;
+  const int fd = open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+  if (fd < 0) {
+    return;
+  }
+
+  /// Statistics are best effort, so that write errors are ignored
+  const char outcome = hit ? HIT : MISS;
+  const ssize_t written = write(fd, &outcome, 1);
+  (void)written;
+  close(fd);
+}
+
+} // namespace cool
@@ -0,0 +1,32 @@
+# Write the compiler stamp header, which defines COOL_COMPILER_STAMP as the
+# SHA-256 digest of the names and contents of the compiler sources. The header
+# is only rewritten when the stamp changes, so that the files that include it
+# are only rebuilt when the compiler sources change
+#
+# Usage: cmake -DSOURCE_DIR=<project source dir> -DOUTPUT=<header> -P <script>
+
+file(
+    GLOB_RECURSE SOURCES
+    RELATIVE ${SOURCE_DIR}
+    ${SOURCE_DIR}/include/*
+    ${SOURCE_DIR}/src/*
+)
+list(SORT SOURCES)
+
+# The stamp is left empty if no source is found, which disables the cache
+set(STAMP "")
+if(SOURCES)
+    set(DIGESTS "")
+    foreach(SOURCE ${SOURCES})
+        file(SHA256 ${SOURCE_DIR}/${SOURCE} DIGEST)
+        string(APPEND DIGESTS "${SOURCE} ${DIGEST}\n")
+    endforeach()
+    string(SHA256 STAMP "${DIGESTS}")
+endif()
+
+file(
+    WRITE ${OUTPUT}.tmp
+    "#pragma once\n\n#define COOL_COMPILER_STAMP \"${STAMP}\"\n"
+)
+configure_file(${OUTPUT}.tmp ${OUTPUT} COPYONLY)
+file(REMOVE ${OUTPUT}.tmp)
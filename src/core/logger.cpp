@@ -1,4 +1,5 @@
 #include <cool/core/logger.h>
+#include <cool/core/logger_collection.h>
 
 #include <iostream>
 
@@ -15,6 +16,19 @@ void Logger::logMessage(const LogMessage &message) {
   }
 }
 
+void BufferedLogger::logMessage(const LogMessage &message) {
+  if (message.severity() >= severity_) {
+    messages_.push_back(message);
+  }
+}
+
+void BufferedLogger::flush(const LoggerCollection *loggers) {
+  for (const auto &message : messages_) {
+    loggers->logMessage(message);
+  }
+  messages_.clear();
+}
+
 void StdoutSink::record(const LogMessage &logMessage) {
   std::cout << logMessage.message() << std::endl;
 }
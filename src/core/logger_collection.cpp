@@ -1,6 +1,8 @@
 #include <cool/core/logger.h>
 #include <cool/core/logger_collection.h>
 
+#include <algorithm>
+
 namespace cool {
 
 ILogger *LoggerCollection::logger(const std::string &loggerName) const {
@@ -23,6 +25,7 @@ Status LoggerCollection::registerLogger(const std::string &loggerName,
   }
 
   loggers_.insert({loggerName, logger});
+  updateSeverity();
   return Status::Ok();
 }
 
@@ -32,7 +35,15 @@ Status LoggerCollection::removeLogger(const std::string &loggerName) {
   }
 
   loggers_.erase(loggers_.find(loggerName));
+  updateSeverity();
   return Status::Ok();
 }
 
+void LoggerCollection::updateSeverity() {
+  severity_ = LogMessageSeverity::FATAL;
+  for (auto &logger : loggers_) {
+    severity_ = std::min(severity_, logger.second->severity());
+  }
+}
+
 } // namespace cool
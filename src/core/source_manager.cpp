@@ -0,0 +1,122 @@
+#include <cool/core/source_manager.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+#include <sys/stat.h>
+
+namespace cool {
+
+uint32_t SourceManager::addFile(const std::string &filePath) {
+  struct stat fileStat;
+  auto status = stat(filePath.c_str(), &fileStat);
+  assert(status == 0);
+
+  Source source{0, 0, filePath, std::string(), false, {0}, 0};
+  return add(std::move(source), fileStat.st_size);
+}
+
+uint32_t SourceManager::addText(std::string text) {
+  const size_t length = text.length();
+  Source source{0, 0, std::string(), std::move(text), true, {0}, 0};
+  return add(std::move(source), length);
+}
+
+uint32_t SourceManager::addLines(SourceLines lines) {
+  const size_t length = lines.length;
+  assert(!lines.lineStarts.empty() && lines.lineStarts.front() == 0);
+  Source source{0, 0, std::string(), std::string(), true, {}, 0};
+  source.lineStarts = std::move(lines.lineStarts);
+  source.scannedLength = length;
+  return add(std::move(source), length);
+}
+
+std::vector<SourceLines> SourceManager::lines() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  std::vector<SourceLines> lines;
+  for (auto &source : sources_) {
+    scanLines(source, source.length);
+    lines.push_back(SourceLines{source.length, source.lineStarts});
+  }
+  return lines;
+}
+
+uint32_t SourceManager::add(Source source, const size_t length) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  /// The offset past the last character is reserved, so that the end of a
+  /// text has a location too
+  const size_t maxOffset = std::numeric_limits<uint32_t>::max();
+  assert(length < maxOffset - nextOffset_);
+  source.base = nextOffset_;
+  source.length = length;
+  nextOffset_ += length + 1;
+
+  sources_.push_back(std::move(source));
+  return sources_.back().base;
+}
+
+SourceLocation SourceManager::location(const uint32_t offset) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  /// Find the text the offset belongs to
+  auto it = std::upper_bound(
+      sources_.begin(), sources_.end(), offset,
+      [](const uint32_t offset, const Source &source) {
+        return offset < source.base;
+      });
+  if (it == sources_.begin()) {
+    return SourceLocation();
+  }
+
+  Source &source = *std::prev(it);
+  const uint32_t relativeOffset = offset - source.base;
+  if (relativeOffset > source.length) {
+    return SourceLocation();
+  }
+
+  scanLines(source, relativeOffset);
+
+  /// Find the line the offset belongs to
+  const auto &lineStarts = source.lineStarts;
+  auto line =
+      std::upper_bound(lineStarts.begin(), lineStarts.end(), relativeOffset);
+  SourceLocation location;
+  location.line = line - lineStarts.begin();
+  location.column = relativeOffset - *std::prev(line) + 1;
+  return location;
+}
+
+void SourceManager::scanLines(Source &source, const uint32_t relativeOffset) {
+  /// Read the file the first time one of its locations is converted
+  if (!source.loaded) {
+    std::ifstream file(source.filePath, std::ios::binary);
+    source.text.assign(std::istreambuf_iterator<char>(file),
+                       std::istreambuf_iterator<char>());
+    source.loaded = true;
+  }
+
+  /// Extend the line starts up to the offset
+  const uint32_t scanEnd =
+      std::min<size_t>(relativeOffset, source.text.length());
+  if (scanEnd > source.scannedLength) {
+    const char *text = source.text.data();
+    const char *cursor = text + source.scannedLength;
+    const char *end = text + scanEnd;
+    while (cursor < end) {
+      cursor = static_cast<const char *>(memchr(cursor, '\n', end - cursor));
+      if (!cursor) {
+        break;
+      }
+      source.lineStarts.push_back(++cursor - text);
+    }
+    source.scannedLength = scanEnd;
+  }
+}
+
+} // namespace cool
@@ -0,0 +1,49 @@
+#include <cool/core/thread_pool.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace cool {
+
+ThreadPool::ThreadPool(const size_t threadsCount) {
+  assert(threadsCount > 0);
+  for (size_t i = 0; i < threadsCount; ++i) {
+    threads_.emplace_back(&ThreadPool::run, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+
+  for (auto &thread : threads_) {
+    thread.join();
+  }
+}
+
+size_t ThreadPool::DefaultThreadsCount() {
+  return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+void ThreadPool::run() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+
+      /// Drain the queue before stopping
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+} // namespace cool
@@ -1,21 +1,35 @@
 #include <cool/analysis/analysis_context.h>
 #include <cool/analysis/classes_definition.h>
 #include <cool/analysis/classes_implementation.h>
+#include <cool/analysis/name_resolution.h>
+#include <cool/analysis/parallel_type_check.h>
+#include <cool/analysis/prelude.h>
 #include <cool/analysis/type_check.h>
 #include <cool/codegen/codegen_code.h>
 #include <cool/codegen/codegen_constants.h>
 #include <cool/codegen/codegen_context.h>
+#include <cool/codegen/codegen_stream.h>
 #include <cool/codegen/codegen_tables.h>
 #include <cool/core/class_registry.h>
+#include <cool/core/compile_cache.h>
 #include <cool/core/logger.h>
+#include <cool/core/logger_collection.h>
+#include <cool/core/source_manager.h>
+#include <cool/core/thread_pool.h>
+#include <cool/frontend/chunked_parser.h>
 #include <cool/frontend/parser.h>
+#include <cool/ir/ast_cache.h>
 #include <cool/ir/class.h>
 
+#include <cstdlib>
 #include <experimental/filesystem>
+#include <fstream>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 using namespace cool;
 
@@ -26,6 +40,60 @@ constexpr static const int32_t INVALID_NUMBER_OF_PARAMETERS = -1;
 constexpr static const int32_t INPUT_FILE_DOES_NOT_EXIST = -2;
 constexpr static const int32_t PARSER_ERROR = -3;
 constexpr static const int32_t SEMANTIC_ANALYSIS_ERROR = -4;
+constexpr static const int32_t AST_CACHE_ERROR = -5;
+constexpr static const int32_t COMPILE_CACHE_ERROR = -6;
+constexpr static const int32_t INVALID_OPTIONS = -7;
+
+/// Command line options
+struct Options {
+  std::vector<std::string> fileNames;
+  bool useFastScanner = false;
+  bool streaming = false;
+  std::string emitAstCache;
+  std::string fromAstCache;
+  std::string cacheDirectory;
+  bool cacheStatistics = false;
+  size_t typeCheckThreads = 1;
+};
+
+/// \brief Helper function to parse the command line options
+///
+/// \param[in] argc number of command line arguments
+/// \param[in] argv command line arguments
+/// \param[out] options command line options
+/// \return Status::Ok() if the options are valid, an error otherwise
+Status ParseOptions(int argc, char *argv[], Options *options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string argument(argv[i]);
+    if (argument == "--fast-scanner") {
+      options->useFastScanner = true;
+    } else if (argument == "--streaming") {
+      options->streaming = true;
+    } else if (argument == "--emit-ast-cache" && i + 1 < argc) {
+      options->emitAstCache = argv[++i];
+    } else if (argument == "--from-ast-cache" && i + 1 < argc) {
+      options->fromAstCache = argv[++i];
+    } else if (argument == "--cache-dir" && i + 1 < argc) {
+      options->cacheDirectory = argv[++i];
+    } else if (argument == "--cache-stats") {
+      options->cacheStatistics = true;
+    } else if (argument == "-j" && i + 1 < argc) {
+      const auto threadsCount = std::atoi(argv[++i]);
+      options->typeCheckThreads =
+          threadsCount > 0 ? threadsCount : ThreadPool::DefaultThreadsCount();
+    } else {
+      options->fileNames.push_back(argument);
+    }
+  }
+
+  /// Streaming compilations release the classes once they are compiled, so
+  /// that there is no whole program to cache
+  if (options->streaming && !options->emitAstCache.empty()) {
+    return GenericError(
+        "Error: --emit-ast-cache cannot be used with --streaming");
+  }
+  return Status::Ok();
+}
 
 /// \brief Helper function to create a logger to stdout
 ///
@@ -35,9 +103,134 @@ std::shared_ptr<Logger> CreateStdoutLogger() {
   return std::make_shared<Logger>(new StdoutSink(), kSeverity);
 }
 
-void DoCodegen(ProgramNodePtr node, std::shared_ptr<ClassRegistry> registry) {
+/// \brief Helper function to parse the input files concurrently
+///
+/// Each file is parsed by its own parser on a thread pool. Files that are
+/// large enough to be split at their class boundaries are instead parsed in
+/// chunks, on the same thread pool. The log messages of each file are buffered
+/// and replayed in the order of the files, and the classes of the programs are
+/// merged in the same order
+///
+/// \param[in] options command line options
+/// \param[in] loggers loggers collection
+/// \return the merged program, nullptr if any of the files could not be parsed
+ProgramNodePtr ParseFiles(const Options &options,
+                          std::shared_ptr<LoggerCollection> loggers) {
+  const auto &fileNames = options.fileNames;
+  const size_t filesCount = fileNames.size();
+  std::vector<ProgramNodePtr> programs(filesCount);
+  std::vector<FrontEndErrorCode> errorCodes(filesCount);
+
+  /// Each parser logs to its own buffer
+  std::vector<std::shared_ptr<LoggerCollection>> fileLoggers;
+  std::vector<std::shared_ptr<BufferedLogger>> buffers;
+  for (size_t i = 0; i < filesCount; ++i) {
+    buffers.push_back(std::make_shared<BufferedLogger>(loggers->severity()));
+    fileLoggers.push_back(std::make_shared<LoggerCollection>());
+    fileLoggers.back()->registerLogger("buffer", buffers.back());
+  }
+
+  /// The files are registered with a single source manager, so that the
+  /// locations of the merged program can be converted to lines and columns
+  auto sourceManager = std::make_shared<SourceManager>();
+
+  /// Files shorter than two chunks are not worth splitting
+  std::vector<bool> splitFile(filesCount);
+  for (size_t i = 0; i < filesCount; ++i) {
+    splitFile[i] = std::experimental::filesystem::file_size(fileNames[i]) >=
+                   2 * ChunkedParser::DEFAULT_MIN_CHUNK_LENGTH;
+  }
+
+  /// Parse the files
+  {
+    ThreadPool pool(ThreadPool::DefaultThreadsCount());
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < filesCount; ++i) {
+      if (splitFile[i]) {
+        continue;
+      }
+      results.push_back(pool.submit([&, i]() {
+        auto parser = Parser::MakeFromMappedFile(fileNames[i]);
+        parser.registerLoggers(fileLoggers[i]);
+        parser.setSourceManager(sourceManager);
+        parser.useFastScanner(options.useFastScanner);
+        programs[i] = parser.parse();
+        errorCodes[i] = parser.lastErrorCode();
+      }));
+    }
+
+    for (size_t i = 0; i < filesCount; ++i) {
+      if (!splitFile[i]) {
+        continue;
+      }
+      auto parser = ChunkedParser::MakeFromFile(fileNames[i]);
+      parser.registerLoggers(fileLoggers[i]);
+      parser.setSourceManager(sourceManager);
+      parser.useFastScanner(options.useFastScanner);
+      programs[i] = parser.parse(&pool);
+      errorCodes[i] = parser.lastErrorCode();
+    }
+
+    for (auto &result : results) {
+      result.get();
+    }
+  }
+
+  /// Replay the log messages and check for errors in the order of the files
+  bool success = true;
+  for (size_t i = 0; i < filesCount; ++i) {
+    buffers[i]->flush(loggers.get());
+    success &= programs[i] && errorCodes[i] == FrontEndErrorCode::NO_ERROR;
+  }
+
+  if (!success) {
+    return nullptr;
+  }
+  return ProgramNode::MakeMergedProgramNode(programs);
+}
+
+/// \brief Helper function to parse the class signatures of the input files
+///
+/// Each file is split at every class boundary, and its chunks are parsed in
+/// turn. Only the class signatures are kept, so that the expressions of one
+/// class at a time are kept in memory. The parsers are returned too, so that
+/// the expressions of each class can be parsed again when needed
+///
+/// \param[in] options command line options
+/// \param[in] loggers loggers collection
+/// \param[out] parsers parsers of the files, in the order of the files
+/// \return the merged program, nullptr if any of the files could not be parsed
+ProgramNodePtr ParseSignatures(const Options &options,
+                               std::shared_ptr<LoggerCollection> loggers,
+                               std::vector<ChunkedParser> *parsers) {
+  /// The files are registered with a single source manager, so that the
+  /// locations of the merged program can be converted to lines and columns
+  auto sourceManager = std::make_shared<SourceManager>();
+
+  /// Parse the files in order. A chunk ends at each class boundary
+  std::vector<ProgramNodePtr> programs;
+  bool success = true;
+  for (const auto &fileName : options.fileNames) {
+    parsers->push_back(ChunkedParser::MakeFromFile(fileName, 0));
+    auto &parser = parsers->back();
+    parser.registerLoggers(loggers);
+    parser.setSourceManager(sourceManager);
+    parser.useFastScanner(options.useFastScanner);
+    programs.push_back(parser.parseSignatures());
+    success &= programs.back() != nullptr;
+  }
+
+  if (!success) {
+    return nullptr;
+  }
+  return ProgramNode::MakeMergedProgramNode(programs);
+}
+
+void DoCodegen(ProgramNodePtr node, std::shared_ptr<ClassRegistry> registry,
+               std::ostream *ios) {
   /// Create a codegen context
   auto context = std::make_unique<CodegenContext>(registry);
+  context->setSourceManager(node->sourceManager());
 
   /// Initialize passes
   std::vector<std::shared_ptr<CodegenBasePass>> passes = {
@@ -47,7 +240,7 @@ void DoCodegen(ProgramNodePtr node, std::shared_ptr<ClassRegistry> registry) {
 
   /// Run passes
   for (auto pass : passes) {
-    auto status = pass->codegen(context.get(), node.get(), &std::cout);
+    auto status = pass->codegen(context.get(), node.get(), ios);
     assert(status.isOk());
   }
 }
@@ -55,20 +248,30 @@ void DoCodegen(ProgramNodePtr node, std::shared_ptr<ClassRegistry> registry) {
 /// \brief Helper function to run the semantic analysis phase
 ///
 /// \param[in] node program node
-/// \param[in] registry class registry
+/// \param[in] prelude prelude of the built-in classes
+/// \param[in] registry class registry, created by the prelude
 /// \param[in] loggers loggers collection
+/// \param[in] typeCheckThreads number of threads of the type-check pass
 /// \return Status::Ok() is successful, an error message otherwise
 Status DoSemanticAnalysis(ProgramNodePtr node,
+                          std::shared_ptr<const Prelude> prelude,
                           std::shared_ptr<ClassRegistry> registry,
-                          std::shared_ptr<LoggerCollection> loggers) {
-  /// Create an analysis context
-  auto context = std::make_unique<AnalysisContext>(registry, loggers);
+                          std::shared_ptr<LoggerCollection> loggers,
+                          const size_t typeCheckThreads) {
+  /// Create an analysis context layered on top of the prelude
+  auto context = prelude->makeAnalysisContext(registry, loggers);
+
+  /// Classes are type-checked concurrently if more than one thread is used
+  std::shared_ptr<Pass> typeCheckPass = std::make_shared<TypeCheckPass>();
+  if (typeCheckThreads > 1) {
+    typeCheckPass = std::make_shared<ParallelTypeCheckPass>(typeCheckThreads);
+  }
 
   /// Initialize passes
   std::vector<std::shared_ptr<Pass>> passes = {
       std::make_shared<ClassesDefinitionPass>(),
-      std::make_shared<ClassesImplementationPass>(),
-      std::make_shared<TypeCheckPass>()};
+      std::make_shared<ClassesImplementationPass>(), typeCheckPass,
+      std::make_shared<NameResolutionPass>()};
 
   /// Run passes
   for (auto pass : passes) {
@@ -81,48 +284,315 @@ Status DoSemanticAnalysis(ProgramNodePtr node,
   return Status::Ok();
 }
 
+/// \brief Helper function to run the semantic analysis and the code generation
+/// one class at a time
+///
+/// The class hierarchy and the class signatures are analyzed first. The
+/// expressions of each class are then parsed again, type-checked and their
+/// code generated, after which they are freed, so that only the expressions of
+/// one class at a time are kept in memory. Code generation stops at the first
+/// class that does not type-check, while the remaining classes are still
+/// type-checked
+///
+/// \param[in] node program node with the class signatures
+/// \param[in] parsers parsers of the class signatures
+/// \param[in] prelude prelude of the built-in classes
+/// \param[in] registry class registry, created by the prelude
+/// \param[in] loggers loggers collection
+/// \param[out] ios output stream
+/// \return Status::Ok() is successful, an error message otherwise
+Status DoStreamingCompilation(ProgramNodePtr node,
+                              const std::vector<ChunkedParser> &parsers,
+                              std::shared_ptr<const Prelude> prelude,
+                              std::shared_ptr<ClassRegistry> registry,
+                              std::shared_ptr<LoggerCollection> loggers,
+                              std::ostream *ios) {
+  /// Create an analysis context layered on top of the prelude
+  auto context = prelude->makeAnalysisContext(registry, loggers);
+
+  /// Analyze the class hierarchy and the class signatures
+  std::vector<std::shared_ptr<Pass>> passes = {
+      std::make_shared<ClassesDefinitionPass>(),
+      std::make_shared<ClassesImplementationPass>()};
+  for (auto pass : passes) {
+    auto status = pass->visit(context.get(), node.get());
+    if (!status.isOk()) {
+      std::cout << status.getErrorMessage() << std::endl;
+      return status;
+    }
+  }
+
+  /// Generate the data segment header and the class tables
+  auto codegenContext = std::make_unique<CodegenContext>(registry);
+  codegenContext->setSourceManager(node->sourceManager());
+  CodegenStream stream(codegenContext.get(), ios);
+  auto status = stream.begin(node.get());
+  assert(status.isOk());
+
+  /// Parse each class again, type-check it and generate its code. Built-in
+  /// classes have no expressions to parse
+  TypeCheckPass typeCheckPass;
+  NameResolutionPass resolutionPass;
+  bool typeCheckOk = true;
+  for (const auto &signatureNode : node->classes()) {
+    const auto &className = signatureNode->className();
+    ClassNode *classNode = signatureNode.get();
+    ProgramNodePtr classProgram;
+    if (!signatureNode->builtIn()) {
+      for (const auto &parser : parsers) {
+        if (parser.hasClass(className)) {
+          classProgram = parser.parseClass(className, &classNode);
+          break;
+        }
+      }
+    }
+    assert(classNode);
+
+    if (!classNode->visitNode(context.get(), &typeCheckPass).isOk()) {
+      typeCheckOk = false;
+    }
+
+    if (typeCheckOk) {
+      classNode->visitNode(context.get(), &resolutionPass);
+      status = stream.generateClass(classNode);
+      assert(status.isOk());
+    }
+  }
+
+  if (!typeCheckOk) {
+    return Status::Error();
+  }
+  return stream.end();
+}
+
+/// \brief Helper function to load a program from an AST cache and generate
+/// its code
+///
+/// The program was type-checked before the cache was written, so that only the
+/// class hierarchy and the class signatures are analyzed again, and the names
+/// of the program resolved. The class IDs
+/// stored in the cache are reserved first, so that the expression types of the
+/// program refer to the same classes
+///
+/// \param[in] options command line options
+/// \param[in] loggers loggers collection
+/// \return Status::Ok() is successful, an error message otherwise
+Status DoCachedCompilation(const Options &options,
+                           std::shared_ptr<LoggerCollection> loggers) {
+  std::vector<Symbol> classNames;
+  auto node = AstCache::ReadFile(options.fromAstCache, &classNames);
+  if (!node) {
+    return GenericError("Error: invalid AST cache: " + options.fromAstCache);
+  }
+  loggers->setSourceManager(node->sourceManager());
+
+  /// Create the class registry and reserve the class IDs of the cache
+  auto prelude = Prelude::Get();
+  auto registry = prelude->makeClassRegistry();
+  auto status = registry->reserveClassIDs(classNames);
+  if (!status.isOk()) {
+    return status;
+  }
+
+  /// Analyze the class hierarchy and the class signatures, and resolve names
+  auto context = prelude->makeAnalysisContext(registry, loggers);
+  std::vector<std::shared_ptr<Pass>> passes = {
+      std::make_shared<ClassesDefinitionPass>(),
+      std::make_shared<ClassesImplementationPass>(),
+      std::make_shared<NameResolutionPass>()};
+  for (auto pass : passes) {
+    status = pass->visit(context.get(), node.get());
+    if (!status.isOk()) {
+      return status;
+    }
+  }
+
+  DoCodegen(node, registry, &std::cout);
+  return Status::Ok();
+}
+
+/// \brief Helper function to write the AST cache of a type-checked program
+///
+/// \param[in] filePath path to the cache file
+/// \param[in] node program node
+/// \param[in] registry class registry of the program
+/// \return Status::Ok() is successful, an error message otherwise
+Status WriteAstCache(const std::string &filePath, ProgramNodePtr node,
+                     std::shared_ptr<ClassRegistry> registry) {
+  std::ofstream file(filePath, std::ios::binary);
+  if (!file) {
+    return GenericError("Error: AST cache cannot be created: " + filePath);
+  }
+  return AstCache::Write(*node, *registry, &file);
+}
+
+/// \brief Helper function to print the statistics of the compile cache to the
+/// standard error
+///
+/// \param[in] cache compile cache
+void PrintCacheStatistics(const CompileCache &cache) {
+  CompileCacheStatistics statistics;
+  auto status = cache.statistics(&statistics);
+  if (!status.isOk()) {
+    std::cerr << status.getErrorMessage() << std::endl;
+    return;
+  }
+
+  const uint64_t lookups = statistics.hits + statistics.misses;
+  const double hitRate =
+      lookups > 0 ? 100.0 * statistics.hits / lookups : 0.0;
+  std::cerr << "Compile cache: " << statistics.hits << " hits, "
+            << statistics.misses << " misses (" << hitRate
+            << "% hit rate), " << statistics.entries << " entries, "
+            << statistics.bytes << " bytes" << std::endl;
+}
+
 } // namespace
 
 int main(int argc, char *argv[]) {
-  /// Program expects exactly one argument
-  if (argc != 2) {
-    std::cerr << "Error: program takes exactly one parameter (filename)"
+  /// Program expects at least one file name
+  Options options;
+  auto optionsStatus = ParseOptions(argc, argv, &options);
+  if (!optionsStatus.isOk()) {
+    std::cerr << optionsStatus.getErrorMessage() << std::endl;
+    return INVALID_OPTIONS;
+  }
+
+  /// Create loggers
+  auto loggers = std::make_shared<LoggerCollection>();
+  loggers->registerLogger("default", CreateStdoutLogger());
+
+  /// Skip the frontend and the type-check if the program is cached
+  if (!options.fromAstCache.empty()) {
+    auto status = DoCachedCompilation(options, loggers);
+    if (!status.isOk()) {
+      std::cerr << status.getErrorMessage() << std::endl;
+      return AST_CACHE_ERROR;
+    }
+    return 0;
+  }
+
+  /// Report the statistics of the compile cache only, if no file is given
+  if (options.fileNames.empty() && options.cacheStatistics &&
+      !options.cacheDirectory.empty()) {
+    PrintCacheStatistics(CompileCache(options.cacheDirectory));
+    return 0;
+  }
+
+  if (options.fileNames.empty()) {
+    std::cerr << "Error: program takes one or more parameters (filenames)"
               << std::endl;
     return INVALID_NUMBER_OF_PARAMETERS;
   }
 
-  /// Store filename into string variable. Ensure file exists
-  const std::string fileName = argv[1];
-  if (!std::experimental::filesystem::exists(fileName)) {
-    std::cerr << "Error: file not found" << std::endl;
-    return INPUT_FILE_DOES_NOT_EXIST;
+  /// Ensure files exist
+  const auto &fileNames = options.fileNames;
+  for (const auto &fileName : fileNames) {
+    if (!std::experimental::filesystem::exists(fileName)) {
+      std::cerr << "Error: file not found: " << fileName << std::endl;
+      return INPUT_FILE_DOES_NOT_EXIST;
+    }
   }
 
-  /// Create loggers
-  auto loggers = std::make_shared<LoggerCollection>();
-  loggers->registerLogger("default", CreateStdoutLogger());
+  /// Look up the generated code in the compile cache, if enabled. The cache
+  /// is bypassed when the AST cache is written, which requires a compilation,
+  /// and disabled when the compiler was built without a stamp
+  std::unique_ptr<CompileCache> cache;
+  std::string cacheKey;
+  if (!options.cacheDirectory.empty() &&
+      CompileCache::CompilerStamp().empty()) {
+    std::cerr << "Warning: compiler stamp not available, compile cache disabled"
+              << std::endl;
+  } else if (!options.cacheDirectory.empty()) {
+    cache = std::make_unique<CompileCache>(options.cacheDirectory);
+    auto status = cache->initialize();
+    if (status.isOk()) {
+      const std::vector<std::string> codegenOptions = {
+          options.streaming ? "--streaming" : ""};
+      status = CompileCache::MakeKey(fileNames, codegenOptions, &cacheKey);
+    }
+    if (!status.isOk()) {
+      std::cerr << status.getErrorMessage() << std::endl;
+      return COMPILE_CACHE_ERROR;
+    }
+
+    std::string code;
+    if (options.emitAstCache.empty() && cache->lookup(cacheKey, &code)) {
+      std::cout << code;
+      if (options.cacheStatistics) {
+        PrintCacheStatistics(*cache);
+      }
+      return 0;
+    }
+  }
 
-  /// Create scanner / parser and parse program
-  auto parser = Parser::MakeFromFile(fileName);
-  parser.registerLoggers(loggers);
-  auto programNode = parser.parse();
-  if (parser.lastErrorCode() != FrontEndErrorCode::NO_ERROR) {
+  /// Parse the files and merge their classes into a single program. Streaming
+  /// compilations parse the class signatures only
+  std::vector<ChunkedParser> parsers;
+  auto programNode = options.streaming
+                         ? ParseSignatures(options, loggers, &parsers)
+                         : ParseFiles(options, loggers);
+  if (!programNode) {
     std::cerr << "Error: parsing did not succeed" << std::endl;
     return PARSER_ERROR;
   }
 
-  /// Set the program file name and create the class registry
-  programNode->setFileName(fileName);
-  auto registry = std::make_shared<ClassRegistry>();
+  /// Set the program file name. The diagnostics of the semantic analysis
+  /// convert their locations with the source manager of the program
+  programNode->setFileName(fileNames.front());
+  loggers->setSourceManager(programNode->sourceManager());
 
-  /// Perform semantic analysis
-  auto semanticStatus = DoSemanticAnalysis(programNode, registry, loggers);
-  if (!semanticStatus.isOk()) {
-    std::cerr << "Error: semantic analysis failed" << std::endl;
-    return SEMANTIC_ANALYSIS_ERROR;
+  /// Create the class registry on top of the prelude of the built-in classes
+  auto prelude = Prelude::Get();
+  auto registry = prelude->makeClassRegistry();
+
+  /// The generated code is buffered when it is to be cached
+  std::ostringstream buffer;
+  std::ostream *ios = cache ? &buffer : &std::cout;
+
+  if (options.streaming) {
+    /// Compile the program one class at a time
+    auto status = DoStreamingCompilation(programNode, parsers, prelude,
+                                         registry, loggers, ios);
+    if (!status.isOk()) {
+      std::cerr << "Error: semantic analysis failed" << std::endl;
+      return SEMANTIC_ANALYSIS_ERROR;
+    }
+  } else {
+    /// Perform semantic analysis
+    auto semanticStatus = DoSemanticAnalysis(programNode, prelude, registry,
+                                             loggers, options.typeCheckThreads);
+    if (!semanticStatus.isOk()) {
+      std::cerr << "Error: semantic analysis failed" << std::endl;
+      return SEMANTIC_ANALYSIS_ERROR;
+    }
+
+    /// Cache the type-checked program if requested
+    if (!options.emitAstCache.empty()) {
+      auto status =
+          WriteAstCache(options.emitAstCache, programNode, registry);
+      if (!status.isOk()) {
+        std::cerr << status.getErrorMessage() << std::endl;
+        return AST_CACHE_ERROR;
+      }
+    }
+
+    /// Generate code
+    DoCodegen(programNode, registry, ios);
   }
 
-  /// Generate code
-  DoCodegen(programNode, registry);
+  /// Store the generated code in the compile cache. A failure to store it
+  /// does not affect the compilation
+  if (cache) {
+    const std::string code = buffer.str();
+    std::cout << code;
+    auto status = cache->store(cacheKey, code);
+    if (!status.isOk()) {
+      std::cerr << status.getErrorMessage() << std::endl;
+    }
+    if (options.cacheStatistics) {
+      PrintCacheStatistics(*cache);
+    }
+  }
   return 0;
 }
@@ -0,0 +1,219 @@
+#include <cool/core/logger.h>
+#include <cool/core/logger_collection.h>
+#include <cool/core/source_manager.h>
+#include <cool/core/thread_pool.h>
+#include <cool/frontend/chunked_parser.h>
+#include <cool/frontend/parser.h>
+#include <cool/ir/class.h>
+
+#include <cassert>
+#include <fstream>
+#include <future>
+#include <iterator>
+
+namespace cool {
+
+constexpr size_t ChunkedParser::DEFAULT_MIN_CHUNK_LENGTH;
+
+ChunkedParser::ChunkedParser(std::string text, const size_t minChunkLength)
+    : text_(std::move(text)) {
+  chunks_ = SplitAtClassBoundaries(text_.data(), text_.size(), minChunkLength);
+}
+
+ChunkedParser ChunkedParser::MakeFromFile(const std::string &filePath,
+                                          const size_t minChunkLength) {
+  std::ifstream file(filePath, std::ios::binary);
+  assert(file.is_open());
+  std::string text((std::istreambuf_iterator<char>(file)),
+                   std::istreambuf_iterator<char>());
+  ChunkedParser parser(std::move(text), minChunkLength);
+  parser.filePath_ = filePath;
+  return parser;
+}
+
+ChunkedParser ChunkedParser::MakeFromString(const std::string &inputString,
+                                            const size_t minChunkLength) {
+  return ChunkedParser(inputString, minChunkLength);
+}
+
+ProgramNodePtr ChunkedParser::parse(ThreadPool *pool) {
+  /// Cannot parse twice
+  if (parseComplete_) {
+    return nullptr;
+  }
+  parseComplete_ = true;
+
+  const uint32_t startOffset = registerText();
+
+  if (pool && chunks_.size() > 1) {
+    const size_t chunksCount = chunks_.size();
+    std::vector<ProgramNodePtr> programs(chunksCount);
+    std::vector<FrontEndErrorCode> errorCodes(chunksCount);
+
+    /// Each chunk logs to its own buffer
+    const auto severity =
+        loggers_ ? loggers_->severity() : LogMessageSeverity::FATAL;
+    std::vector<std::shared_ptr<BufferedLogger>> buffers;
+    for (size_t i = 0; i < chunksCount; ++i) {
+      buffers.push_back(std::make_shared<BufferedLogger>(severity));
+    }
+
+    /// Parse the chunks
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < chunksCount; ++i) {
+      results.push_back(pool->submit([&, i]() {
+        auto chunkLoggers = std::make_shared<LoggerCollection>();
+        chunkLoggers->registerLogger("buffer", buffers[i]);
+        programs[i] = parseChunk(chunks_[i], startOffset, chunkLoggers,
+                                 &errorCodes[i]);
+      }));
+    }
+
+    bool success = true;
+    for (size_t i = 0; i < chunksCount; ++i) {
+      results[i].get();
+      success &= programs[i] && errorCodes[i] == FrontEndErrorCode::NO_ERROR;
+    }
+
+    /// Replay the log messages in the order of the chunks and merge the
+    /// classes
+    if (success) {
+      for (size_t i = 0; loggers_ && i < chunksCount; ++i) {
+        buffers[i]->flush(loggers_.get());
+      }
+      return ProgramNode::MakeMergedProgramNode(programs);
+    }
+  }
+
+  /// Parse the whole text serially. Errors are reported as in a serial parse
+  return parseChunk(SourceChunk{0, text_.size(), 1}, startOffset, loggers_,
+                    &lastErrorCode_);
+}
+
+ProgramNodePtr ChunkedParser::parseSignatures() {
+  /// Cannot parse twice
+  if (parseComplete_) {
+    return nullptr;
+  }
+  parseComplete_ = true;
+  startOffset_ = registerText();
+
+  /// The chunks log to a single buffer
+  const auto severity =
+      loggers_ ? loggers_->severity() : LogMessageSeverity::FATAL;
+  auto buffer = std::make_shared<BufferedLogger>(severity);
+  auto chunkLoggers = std::make_shared<LoggerCollection>();
+  chunkLoggers->registerLogger("buffer", buffer);
+
+  /// Parse the chunks in order, keeping the class signatures only
+  auto classes = ProgramNode::BuiltInClasses();
+  bool success = true;
+  for (size_t i = 0; i < chunks_.size() && success; ++i) {
+    FrontEndErrorCode errorCode = FrontEndErrorCode::NO_ERROR;
+    auto program = parseChunk(chunks_[i], startOffset_, chunkLoggers,
+                              &errorCode);
+    success = program && errorCode == FrontEndErrorCode::NO_ERROR;
+    if (success) {
+      addSignatures(*program, i, &classes);
+    }
+  }
+
+  if (success) {
+    if (loggers_) {
+      buffer->flush(loggers_.get());
+    }
+  } else {
+    /// Parse the whole text serially. Errors are reported as in a serial
+    /// parse, and the whole text becomes a single chunk should it parse
+    classes = ProgramNode::BuiltInClasses();
+    classChunks_.clear();
+    chunks_.assign(1, SourceChunk{0, text_.size(), 1});
+    auto program =
+        parseChunk(chunks_.front(), startOffset_, loggers_, &lastErrorCode_);
+    if (!program || lastErrorCode_ != FrontEndErrorCode::NO_ERROR) {
+      return nullptr;
+    }
+    addSignatures(*program, 0, &classes);
+  }
+
+  auto program = ProgramNode::MakeProgramNode(std::move(classes));
+  program->setSourceManager(sourceManager_);
+  return program;
+}
+
+ProgramNodePtr ChunkedParser::parseClass(const Symbol &className,
+                                         ClassNode **classNode) const {
+  *classNode = nullptr;
+  auto it = classChunks_.find(className);
+  if (it == classChunks_.end()) {
+    return nullptr;
+  }
+
+  /// The chunk parsed before, hence it parses again
+  FrontEndErrorCode errorCode = FrontEndErrorCode::NO_ERROR;
+  auto program =
+      parseChunk(chunks_[it->second], startOffset_, nullptr, &errorCode);
+  assert(program && errorCode == FrontEndErrorCode::NO_ERROR);
+
+  for (const auto &node : program->classes()) {
+    if (!node->builtIn() && node->className() == className) {
+      *classNode = node.get();
+      break;
+    }
+  }
+  return program;
+}
+
+uint32_t ChunkedParser::registerText() {
+  /// Register the text once. Files are read again only if a location is
+  /// converted
+  if (!sourceManager_) {
+    sourceManager_ = std::make_shared<SourceManager>();
+  }
+  return filePath_.empty() ? sourceManager_->addText(text_)
+                           : sourceManager_->addFile(filePath_);
+}
+
+void ChunkedParser::addSignatures(const ProgramNode &program,
+                                  const size_t chunkIndex,
+                                  std::vector<ClassNodePtr> *classes) {
+  for (const auto &classNode : program.classes()) {
+    if (!classNode->builtIn()) {
+      classChunks_[classNode->className()] = chunkIndex;
+      classes->push_back(ClassNode::MakeSignatureNode(*classNode));
+    }
+  }
+}
+
+ProgramNodePtr
+ChunkedParser::parseChunk(const SourceChunk &chunk, const uint32_t startOffset,
+                          std::shared_ptr<LoggerCollection> loggers,
+                          FrontEndErrorCode *errorCode) const {
+  /// The chunk is copied into a buffer terminated by the sentinel bytes and
+  /// scanned in place
+  std::vector<char> buffer(text_.begin() + chunk.offset,
+                           text_.begin() + chunk.offset + chunk.length);
+  buffer.resize(chunk.length + ScannerState::SENTINEL_SIZE, '\0');
+
+  auto parser = Parser::MakeFromBuffer(buffer.data(), buffer.size());
+  parser.setSourceManager(sourceManager_);
+  parser.setStartOffset(startOffset + chunk.offset);
+  parser.registerLoggers(loggers);
+  parser.useFastScanner(useFastScanner_);
+  parser.useNodeArena(useNodeArena_);
+
+  auto program = parser.parse();
+  *errorCode = parser.lastErrorCode();
+  return program;
+}
+
+void ChunkedParser::registerLoggers(std::shared_ptr<LoggerCollection> loggers) {
+  loggers_ = loggers;
+}
+
+void ChunkedParser::setSourceManager(
+    std::shared_ptr<SourceManager> sourceManager) {
+  sourceManager_ = sourceManager;
+}
+
+} // namespace cool
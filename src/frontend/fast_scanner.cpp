@@ -0,0 +1,489 @@
+#include <cool/core/log_message.h>
+#include <cool/core/logger_collection.h>
+#include <cool/frontend/fast_scanner.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#if defined(__SSE2__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/// Helper functions shared with the Flex scanner, so that both scanners log
+/// the same messages
+void LogError(const cool::FrontEndErrorCode, const uint32_t,
+              const cool::ExtraState *, cool::LoggerCollection *);
+void LogToken(const YYLTYPE *, const int32_t, const cool::ExtraState *,
+              cool::LoggerCollection *);
+
+namespace cool {
+
+namespace {
+
+/// Maximum length of a string literal, as in the Flex scanner
+constexpr size_t MAX_STRING_LENGTH = 1024;
+
+/// Keyword and its token code. Keywords are case insensitive, except for the
+/// first character of the boolean literals, which must be lower case
+struct Keyword {
+  const char *text;
+  size_t length;
+  int token;
+  bool caseSensitiveStart;
+};
+
+constexpr Keyword KEYWORDS[] = {
+    {"case", 4, CASE_TOKEN, false},     {"class", 5, CLASS_TOKEN, false},
+    {"else", 4, ELSE_TOKEN, false},     {"esac", 4, ESAC_TOKEN, false},
+    {"false", 5, FALSE_TOKEN, true},    {"fi", 2, FI_TOKEN, false},
+    {"if", 2, IF_TOKEN, false},         {"in", 2, IN_TOKEN, false},
+    {"inherits", 8, INHERITS_TOKEN, false},
+    {"isvoid", 6, ISVOID_TOKEN, false}, {"let", 3, LET_TOKEN, false},
+    {"loop", 4, LOOP_TOKEN, false},     {"new", 3, NEW_TOKEN, false},
+    {"not", 3, NOT_TOKEN, false},       {"of", 2, OF_TOKEN, false},
+    {"pool", 4, POOL_TOKEN, false},     {"then", 4, THEN_TOKEN, false},
+    {"true", 4, TRUE_TOKEN, true},      {"while", 5, WHILE_TOKEN, false}};
+
+/// Set of characters, matched one at a time or in blocks
+template <char... Cs> struct CharSet;
+
+template <> struct CharSet<> {
+  static bool contains(const char) { return false; }
+#if defined(__SSE2__)
+  static __m128i match(const __m128i) { return _mm_setzero_si128(); }
+#endif
+#if defined(__AVX2__)
+  static __m256i match(const __m256i) { return _mm256_setzero_si256(); }
+#endif
+};
+
+template <char C, char... Cs> struct CharSet<C, Cs...> {
+  static bool contains(const char c) {
+    return c == C || CharSet<Cs...>::contains(c);
+  }
+#if defined(__SSE2__)
+  static __m128i match(const __m128i block) {
+    return _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(C)),
+                        CharSet<Cs...>::match(block));
+  }
+#endif
+#if defined(__AVX2__)
+  static __m256i match(const __m256i block) {
+    return _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(C)),
+                           CharSet<Cs...>::match(block));
+  }
+#endif
+};
+
+/// Number of characters checked one at a time before checking blocks
+constexpr size_t SCALAR_PROBE_LENGTH = 4;
+
+/// White spaces and newlines
+using BlankSet = CharSet<' ', '\n', '\t', '\r', '\f', '\v'>;
+
+/// Characters that end an in-line comment
+using InlineCommentSet = CharSet<'\n'>;
+
+/// Characters that need attention in the body of an out-of-line comment
+using CommentSet = CharSet<'(', '*'>;
+
+/// Characters that need attention in the body of a string literal
+using StringSet = CharSet<'"', '\\', '\n', '\0'>;
+
+/// \brief Helper function to find the first character of a range that belongs,
+/// or does not belong, to a set
+///
+/// \param[in] begin beginning of the range
+/// \param[in] end end of the range
+/// \return a pointer to the first such character, or end if none
+template <typename SetT, bool InSet>
+const char *FindFirst(const char *begin, const char *end) {
+  /// Short runs are common, such as a single space between two tokens, and
+  /// are found before loading a block
+  for (size_t i = 0; i < SCALAR_PROBE_LENGTH; ++i, ++begin) {
+    if (begin == end || SetT::contains(*begin) == InSet) {
+      return begin;
+    }
+  }
+
+#if defined(__AVX2__)
+  while (end - begin >= 32) {
+    const __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin));
+    uint32_t mask =
+        static_cast<uint32_t>(_mm256_movemask_epi8(SetT::match(block)));
+    mask = InSet ? mask : ~mask;
+    if (mask) {
+      return begin + __builtin_ctz(mask);
+    }
+    begin += 32;
+  }
+#endif
+#if defined(__SSE2__)
+  while (end - begin >= 16) {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+    uint32_t mask =
+        static_cast<uint32_t>(_mm_movemask_epi8(SetT::match(block)));
+    mask = InSet ? mask : ~mask & 0xFFFF;
+    if (mask) {
+      return begin + __builtin_ctz(mask);
+    }
+    begin += 16;
+  }
+#endif
+  while (begin < end && SetT::contains(*begin) != InSet) {
+    ++begin;
+  }
+  return begin;
+}
+
+bool IsLowerCase(const char c) { return c >= 'a' && c <= 'z'; }
+
+bool IsUpperCase(const char c) { return c >= 'A' && c <= 'Z'; }
+
+bool IsDigit(const char c) { return c >= '0' && c <= '9'; }
+
+bool IsIdentifierChar(const char c) {
+  return IsLowerCase(c) || IsUpperCase(c) || IsDigit(c) || c == '_';
+}
+
+/// \brief Helper function to check whether a character is a single character
+/// token
+///
+/// \param[in] c character
+/// \return true if the character is a token on its own
+bool IsSingleCharToken(const char c) {
+  switch (c) {
+  case '+':
+  case '-':
+  case '*':
+  case '/':
+  case '<':
+  case '=':
+  case '~':
+  case '(':
+  case ')':
+  case '{':
+  case '}':
+  case '@':
+  case '.':
+  case ':':
+  case ';':
+  case ',':
+    return true;
+  default:
+    return false;
+  }
+}
+
+/// \brief Helper function to match an identifier against the keywords
+///
+/// \param[in] text identifier text
+/// \param[in] length identifier length
+/// \return the keyword token code, or 0 if the identifier is not a keyword
+int MatchKeyword(const char *text, const size_t length) {
+  for (const auto &keyword : KEYWORDS) {
+    if (keyword.length != length ||
+        (keyword.caseSensitiveStart && text[0] != keyword.text[0])) {
+      continue;
+    }
+
+    /// Setting the 0x20 bit lower-cases letters, and never turns a digit or
+    /// an underscore into a letter
+    size_t i = 0;
+    while (i < length && (text[i] | 0x20) == keyword.text[i]) {
+      ++i;
+    }
+    if (i == length) {
+      return keyword.token;
+    }
+  }
+  return 0;
+}
+
+} // namespace
+
+FastScanner::FastScanner(const char *text, const size_t length,
+                         ExtraState *extraState)
+    : begin_(text), cursor_(text), end_(text + length),
+      extraState_(extraState) {}
+
+int FastScanner::lex(YYSTYPE *yylval, YYLTYPE *yylloc,
+                     LoggerCollection *logger) {
+  while (true) {
+    skipWhiteSpaces();
+    if (cursor_ == end_) {
+      return 0;
+    }
+
+    const char c = *cursor_;
+    const bool hasNext = cursor_ + 1 < end_;
+    const char next = hasNext ? cursor_[1] : '\0';
+
+    if (IsLowerCase(c) || IsUpperCase(c)) {
+      return lexIdentifier(yylval, yylloc, logger);
+    }
+    if (IsDigit(c)) {
+      return lexInteger(yylval, yylloc, logger);
+    }
+
+    /// Strings and comments
+    int token = 0;
+    switch (c) {
+    case '"':
+      extraState_->stringText.clear();
+      consume(yylloc, 1);
+      token = lexString(yylval, yylloc, logger);
+      if (token >= 0) {
+        return token;
+      }
+      continue;
+    case '-':
+      if (hasNext && next == '-') {
+        cursor_ += 2;
+        skipInlineComment();
+        continue;
+      }
+      break;
+    case '(':
+      if (hasNext && next == '*') {
+        cursor_ += 2;
+        extraState_->openComments = 1;
+        if (!skipComment(logger)) {
+          return 0;
+        }
+        continue;
+      }
+      break;
+    default:
+      break;
+    }
+
+    /// Two characters operators
+    if (hasNext) {
+      token = c == '<' && next == '-'   ? ASSIGN_TOKEN
+              : c == '<' && next == '=' ? LESS_EQUAL_TOKEN
+              : c == '=' && next == '>' ? CASE_OPERATOR_TOKEN
+                                        : 0;
+    }
+    if (token) {
+      consume(yylloc, 2);
+      if (LOG_DEBUG_ENABLED(logger)) {
+        LogToken(yylloc, token, extraState_, logger);
+      }
+      return token;
+    }
+
+    /// Single character tokens
+    if (IsSingleCharToken(c)) {
+      consume(yylloc, 1);
+      if (LOG_DEBUG_ENABLED(logger)) {
+        LogToken(yylloc, c, extraState_, logger);
+      }
+      return c;
+    }
+
+    /// All other characters are invalid
+    LogError(FrontEndErrorCode::LEXER_ERROR_INVALID_CHARACTER,
+             offset(cursor_), extraState_, logger);
+    extraState_->lastErrorCode =
+        FrontEndErrorCode::LEXER_ERROR_INVALID_CHARACTER;
+    ++cursor_;
+  }
+}
+
+void FastScanner::skipWhiteSpaces() {
+  cursor_ = FindFirst<BlankSet, false>(cursor_, end_);
+}
+
+void FastScanner::skipInlineComment() {
+  cursor_ = FindFirst<InlineCommentSet, true>(cursor_, end_);
+  if (cursor_ < end_) {
+    ++cursor_;
+  }
+}
+
+bool FastScanner::skipComment(LoggerCollection *logger) {
+  while (true) {
+    cursor_ = FindFirst<CommentSet, true>(cursor_, end_);
+    if (cursor_ == end_) {
+      LogError(FrontEndErrorCode::LEXER_ERROR_UNTERMINATED_COMMENT,
+               offset(end_), extraState_, logger);
+      extraState_->lastErrorCode =
+          FrontEndErrorCode::LEXER_ERROR_UNTERMINATED_COMMENT;
+      return false;
+    }
+
+    const char c = *cursor_;
+    const char next = cursor_ + 1 < end_ ? cursor_[1] : '\0';
+    if (c == '(' && next == '*') {
+      extraState_->openComments++;
+      cursor_ += 2;
+    } else if (c == '*' && next == ')') {
+      cursor_ += 2;
+      if (--extraState_->openComments == 0) {
+        return true;
+      }
+    } else {
+      ++cursor_;
+    }
+  }
+}
+
+int FastScanner::lexString(YYSTYPE *yylval, YYLTYPE *yylloc,
+                           LoggerCollection *logger) {
+  std::string &text = extraState_->stringText;
+  while (true) {
+    /// Copy the characters that need no attention in bulk
+    const char *next = FindFirst<StringSet, true>(cursor_, end_);
+    text.append(cursor_, next);
+    cursor_ = next;
+
+    if (cursor_ == end_) {
+      LogError(FrontEndErrorCode::LEXER_ERROR_UNTERMINATED_STRING,
+               offset(end_), extraState_, logger);
+      extraState_->lastErrorCode =
+          FrontEndErrorCode::LEXER_ERROR_UNTERMINATED_STRING;
+      return 0;
+    }
+
+    switch (*cursor_) {
+    case '"':
+      yylval->literalVal = extraState_->semanticValues.make(text);
+      if (yylval->literalVal->length() > MAX_STRING_LENGTH) {
+        LogError(FrontEndErrorCode::LEXER_ERROR_STRING_EXCEEDS_MAX_LENGTH,
+                 offset(cursor_), extraState_, logger);
+        extraState_->lastErrorCode =
+            FrontEndErrorCode::LEXER_ERROR_STRING_EXCEEDS_MAX_LENGTH;
+        ++cursor_;
+        return -1;
+      }
+      ++cursor_;
+      if (LOG_DEBUG_ENABLED(logger)) {
+        const auto location = extraState_->location(*yylloc);
+        logger->logMessage(LogMessage::MakeDebugMessage(
+            "line: %d, col: %d: STRING: %s", location.line, location.column,
+            *yylval->literalVal));
+      }
+      return STRING_TOKEN;
+    case '\n':
+      LogError(FrontEndErrorCode::LEXER_ERROR_STRING_CONTAINS_NEWLINE_CHARACTER,
+               offset(cursor_), extraState_, logger);
+      extraState_->lastErrorCode =
+          FrontEndErrorCode::LEXER_ERROR_STRING_CONTAINS_NEWLINE_CHARACTER;
+      ++cursor_;
+      return -1;
+    case '\0':
+      LogError(FrontEndErrorCode::LEXER_ERROR_STRING_CONTAINS_NULL_CHARACTER,
+               offset(cursor_), extraState_, logger);
+      extraState_->lastErrorCode =
+          FrontEndErrorCode::LEXER_ERROR_STRING_CONTAINS_NULL_CHARACTER;
+      ++cursor_;
+      return -1;
+    default:
+      break;
+    }
+
+    /// Escape sequence. A backslash that ends the input is a plain character
+    if (cursor_ + 1 == end_) {
+      text.push_back('\\');
+      ++cursor_;
+      continue;
+    }
+
+    const char escaped = cursor_[1];
+    cursor_ += 2;
+    switch (escaped) {
+    case '\n':
+    case 'n':
+      text.push_back('\n');
+      break;
+    case '0':
+      text.push_back('\0');
+      break;
+    case 'b':
+      text.push_back('\b');
+      break;
+    case 't':
+      text.push_back('\t');
+      break;
+    case 'f':
+      text.push_back('\f');
+      break;
+    default:
+      text.push_back(escaped);
+      break;
+    }
+  }
+}
+
+int FastScanner::lexIdentifier(YYSTYPE *yylval, YYLTYPE *yylloc,
+                               LoggerCollection *logger) {
+  const char *begin = cursor_;
+  const char *end = cursor_ + 1;
+  while (end < end_ && IsIdentifierChar(*end)) {
+    ++end;
+  }
+  const size_t length = end - begin;
+  consume(yylloc, length);
+
+  /// Keywords take precedence over identifiers of the same length
+  const int keyword = MatchKeyword(begin, length);
+  if (keyword) {
+    if (LOG_DEBUG_ENABLED(logger)) {
+      LogToken(yylloc, keyword, extraState_, logger);
+    }
+    return keyword;
+  }
+
+  yylval->symbolVal = Symbol(begin, length);
+  const bool isClassId = IsUpperCase(*begin);
+  if (LOG_DEBUG_ENABLED(logger)) {
+    const auto location = extraState_->location(*yylloc);
+    logger->logMessage(LogMessage::MakeDebugMessage(
+        isClassId ? "line: %d, col: %d: CLASS_ID: %s"
+                  : "line: %d, col: %d: OBJECT_ID: %s",
+        location.line, location.column, yylval->symbolVal));
+  }
+  return isClassId ? CLASS_ID_TOKEN : OBJECT_ID_TOKEN;
+}
+
+int FastScanner::lexInteger(YYSTYPE *yylval, YYLTYPE *yylloc,
+                            LoggerCollection *logger) {
+  const char *begin = cursor_;
+  const char *end = cursor_ + 1;
+  while (end < end_ && IsDigit(*end)) {
+    ++end;
+  }
+  const size_t length = end - begin;
+  consume(yylloc, length);
+
+  /// Literals that may overflow are converted as in the Flex scanner
+  static constexpr size_t MAX_SAFE_DIGITS = 9;
+  if (length <= MAX_SAFE_DIGITS) {
+    int32_t value = 0;
+    for (const char *digit = begin; digit < end; ++digit) {
+      value = value * 10 + (*digit - '0');
+    }
+    yylval->integerVal = value;
+  } else {
+    yylval->integerVal = atoi(std::string(begin, end).c_str());
+  }
+
+  if (LOG_DEBUG_ENABLED(logger)) {
+    const auto location = extraState_->location(*yylloc);
+    logger->logMessage(LogMessage::MakeDebugMessage(
+        "line: %d, col: %d: INTEGER_VAL: %d", location.line, location.column,
+        yylval->integerVal));
+  }
+  return INTEGER_TOKEN;
+}
+
+void FastScanner::consume(YYLTYPE *yylloc, const size_t length) {
+  *yylloc = offset(cursor_);
+  cursor_ += length;
+}
+
+} // namespace cool
@@ -1,5 +1,7 @@
 #include <cool/core/logger_collection.h>
 #include <cool/frontend/parser.h>
+#include <cool/ir/class.h>
+#include <cool/ir/node_arena.h>
 
 #include <iostream>
 
@@ -10,7 +12,12 @@ Parser::Parser(std::unique_ptr<ScannerState> state)
 
 Parser::Parser(Parser &&other) {
   this->state_ = std::move(other.state_);
+  this->sourceManager_ = std::move(other.sourceManager_);
+  this->startOffset_ = other.startOffset_;
+  this->hasStartOffset_ = other.hasStartOffset_;
   this->parseComplete_ = other.parseComplete_;
+  this->useNodeArena_ = other.useNodeArena_;
+  this->useFastScanner_ = other.useFastScanner_;
 }
 
 FrontEndErrorCode Parser::lastErrorCode() const {
@@ -23,15 +30,29 @@ ProgramNodePtr Parser::parse() {
     return nullptr;
   }
 
+  /// Register the input, unless it is a fragment of a registered text
+  if (!sourceManager_) {
+    sourceManager_ = std::make_shared<SourceManager>();
+  }
+  if (!hasStartOffset_) {
+    startOffset_ = state_->registerInput(sourceManager_.get());
+  }
+  state_->setSource(sourceManager_, startOffset_);
+
   /// Parse program
   parseComplete_ = true;
+  state_->useFastScanner(useFastScanner_);
   ProgramNodePtr parseResult;
-  auto status = yyparse(loggers_.get(), state_->scannerState(), &parseResult);
+  auto arena = useNodeArena_ ? std::make_shared<NodeArena>() : nullptr;
+  auto status =
+      yyparse(loggers_.get(), state_->scannerState(), &parseResult, arena);
+  state_->clearSemanticValues();
 
   /// Return nullptr if parsing failed, otherwise the parsed program node
   if (status != 0) {
     return nullptr;
   }
+  parseResult->setSourceManager(sourceManager_);
   return parseResult;
 }
 
@@ -39,11 +60,30 @@ void Parser::registerLoggers(std::shared_ptr<LoggerCollection> loggers) {
   loggers_ = loggers;
 }
 
+void Parser::setSourceManager(std::shared_ptr<SourceManager> sourceManager) {
+  sourceManager_ = sourceManager;
+}
+
+void Parser::setStartOffset(const uint32_t startOffset) {
+  startOffset_ = startOffset;
+  hasStartOffset_ = true;
+}
+
 Parser Parser::MakeFromFile(const std::string &filePath) {
   auto state = ScannerState::MakeFromFile(filePath);
   return Parser(std::move(state));
 }
 
+Parser Parser::MakeFromMappedFile(const std::string &filePath) {
+  auto state = ScannerState::MakeFromMappedFile(filePath);
+  return Parser(std::move(state));
+}
+
+Parser Parser::MakeFromBuffer(char *buffer, const size_t size) {
+  auto state = ScannerState::MakeFromBuffer(buffer, size);
+  return Parser(std::move(state));
+}
+
 Parser Parser::MakeFromString(const std::string &inputString) {
   auto state = ScannerState::MakeFromString(inputString);
   return Parser(std::move(state));
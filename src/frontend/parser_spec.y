@@ -8,14 +8,20 @@
 #include <cool/frontend/scanner_extra.h>
 #include <cool/ir/class.h>
 #include <cool/ir/expr.h>
+#include <cool/ir/node_arena.h>
 
+#include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 typedef struct cool::ExtraState* YY_EXTRA_TYPE;
 typedef void *yyscan_t;
+typedef uint32_t YYLTYPE;
 
-struct YYLTYPE;
+/// The location of a nonterminal is the location of its first symbol, or of
+/// the lookahead symbol if the nonterminal is empty
+#define YYLLOC_DEFAULT(Current, Rhs, N) (Current) = YYRHSLOC(Rhs, (N) ? 1 : 0)
 
 /// Helper function to extract the extra argument taken by the lexer
 YY_EXTRA_TYPE yyget_extra(yyscan_t);
@@ -24,11 +30,20 @@ YY_EXTRA_TYPE yyget_extra(yyscan_t);
 std::vector<cool::ClassNodePtr> InstallBuiltInClasses(std::vector<cool::ClassNodePtr> classes);
 
 /// Dummy error function prototype -- unused but required by Bison
-void yyerror (YYLTYPE*, cool::LoggerCollection*, yyscan_t, cool::ProgramNodePtr*, char const *);
+void yyerror (YYLTYPE*, cool::LoggerCollection*, yyscan_t, cool::ProgramNodePtr*, std::shared_ptr<cool::NodeArena>, char const *);
+
+/// Helper function to store a semantic value in the pool of the scanner
+template <typename T> T* Store(yyscan_t state, T value) {
+    return yyget_extra(state)->semanticValues.make(std::move(value));
+}
+
+/// Helper function to move a semantic value out of the pool of the scanner
+template <typename T> T Take(yyscan_t state, T* value) {
+    return yyget_extra(state)->semanticValues.take(value);
+}
 
 /// Actual error function
-void LogError(const cool::FrontEndErrorCode code, const uint32_t lloc, 
-            const uint32_t cloc, cool::LoggerCollection* logger);
+void LogError(const cool::FrontEndErrorCode code, const cool::SourceLocation& location, cool::LoggerCollection* logger);
 
 }
 
@@ -36,33 +51,53 @@ void LogError(const cool::FrontEndErrorCode code, const uint32_t lloc,
 
 /// Includes
 #include <cool/ir/fwd.h> 
+#include <cool/ir/symbol.h>
 
+#include <cstdint>
 #include <cstdlib>
 #include <memory>
 #include <string> 
+#include <type_traits>
 #include <vector>
 
-/// Parser return type
-struct YYSTYPE {
+/// Parser semantic value. Bison copies semantic values bitwise on every shift
+/// and reduction, so values that are not trivially copyable are stored in the
+/// semantic value pool of the scanner and referenced by pointer
+union YYSTYPE {
+    YYSTYPE() {}
+
     int32_t integerVal;
-    std::string literalVal;
-
-    cool::CaseBindingNodePtr caseBinding;
-    cool::ClassNodePtr classNode;
-    cool::ExprNodePtr exprNode;
-    cool::FormalNodePtr formalNode;
-    cool::LetBindingNodePtr letBinding;
-    cool::GenericAttributeNodePtr attributeNode;
-    cool::ProgramNodePtr programNode;
-
-    std::vector<cool::CaseBindingNodePtr> caseBindings;
-    std::vector<cool::ClassNodePtr> classNodes;
-    std::vector<cool::FormalNodePtr> formalNodes;
-    std::vector<cool::GenericAttributeNodePtr> attributeNodes;
-    std::vector<cool::ExprNodePtr> exprNodes;
-    std::vector<cool::LetBindingNodePtr> letBindings;
+    std::string* literalVal;
+    cool::Symbol symbolVal;
+
+    cool::CaseBindingNodePtr* caseBinding;
+    cool::ClassNodePtr* classNode;
+    cool::ExprNodePtr* exprNode;
+    cool::FormalNodePtr* formalNode;
+    cool::LetBindingNodePtr* letBinding;
+    cool::GenericAttributeNodePtr* attributeNode;
+
+    std::vector<cool::CaseBindingNodePtr>* caseBindings;
+    std::vector<cool::ClassNodePtr>* classNodes;
+    std::vector<cool::FormalNodePtr>* formalNodes;
+    std::vector<cool::GenericAttributeNodePtr>* attributeNodes;
+    std::vector<cool::ExprNodePtr>* exprNodes;
+    std::vector<cool::LetBindingNodePtr>* letBindings;
 };
 
+static_assert(std::is_trivially_copyable<YYSTYPE>::value,
+    "Parser semantic value must be trivially copyable");
+
+/// Allow the parser stack to be relocated when it grows
+#define YYSTYPE_IS_TRIVIAL 1
+
+/// Locations are byte offsets rather than the default location struct, so
+/// that in C++ Bison does not relocate the parser stacks. The stacks start at
+/// their maximum depth instead, which accepts the same nesting as growing
+/// them. Their pages are only touched as the parser goes deeper
+#define YYMAXDEPTH 10000
+#define YYINITDEPTH YYMAXDEPTH
+
 /// Lexer state type
 typedef void *yyscan_t;
 
@@ -88,8 +123,10 @@ extern int yylex(YYSTYPE *, YYLTYPE*, cool::LoggerCollection*, yyscan_t);
 %param { cool::LoggerCollection* logger}
 %param { yyscan_t state }
 %parse-param {cool::ProgramNodePtr* program}
+%parse-param {std::shared_ptr<cool::NodeArena> arena}
 
-%define api.value.type {struct YYSTYPE}
+%define api.value.type {union YYSTYPE}
+%define api.location.type {uint32_t}
 
 /* Nonterminals */
 %nterm <attributeNode> feature
@@ -107,11 +144,10 @@ extern int yylex(YYSTYPE *, YYLTYPE*, cool::LoggerCollection*, yyscan_t);
 %nterm <formalNodes> formalc
 %nterm <letBinding> letbinding
 %nterm <letBindings> letbindings 
-%nterm <programNode> program
 
 /* Terminals */
-%token <literalVal> CLASS_ID_TOKEN
-%token <literalVal> OBJECT_ID_TOKEN
+%token <symbolVal> CLASS_ID_TOKEN
+%token <symbolVal> OBJECT_ID_TOKEN
 %token <literalVal> STRING_TOKEN 
 %token <integerVal> INTEGER_TOKEN
 
@@ -165,374 +201,313 @@ extern int yylex(YYSTYPE *, YYLTYPE*, cool::LoggerCollection*, yyscan_t);
 
 /* Classes */
 program:  classes {
-    $1 = InstallBuiltInClasses(std::move($1));
-    $$ = cool::ProgramNode::MakeProgramNode(std::move($1)); *program = $$;
-  }
+        auto classes = InstallBuiltInClasses(Take(state, $1));
+        *program = cool::ProgramNode::MakeProgramNode(std::move(classes), arena);
+    }
 | %empty {
         std::vector<cool::ClassNodePtr> classes;
-        $$ = cool::ProgramNode::MakeProgramNode(std::move(classes)); *program = $$;
+        *program = cool::ProgramNode::MakeProgramNode(std::move(classes), arena);
     }
 ;       
 
 classes:  class_ ';' { 
-        $$ = std::vector<cool::ClassNodePtr>{$1}; 
+        $$ = Store(state, std::vector<cool::ClassNodePtr>{Take(state, $1)}); 
     }
 | error ';' {
-        $$ = std::vector<cool::ClassNodePtr>();
+        $$ = Store(state, std::vector<cool::ClassNodePtr>());
     }
 | classes class_ ';' { 
-        $$ = std::move($1); $$.push_back($2); 
+        $$ = $1; $$->push_back(Take(state, $2)); 
     }
 | classes error ';' {
         yyget_extra(state)->lastErrorCode = cool::FrontEndErrorCode::PARSER_ERROR_INVALID_CLASS;
         LogError(cool::FrontEndErrorCode::PARSER_ERROR_INVALID_CLASS, 
-            @2.first_line, @2.first_column, logger);
-        $$ = std::move($1); 
+            yyget_extra(state)->location(@2), logger);
+        $$ = $1; 
     }
 ; 
 
 class_: CLASS_TOKEN CLASS_ID_TOKEN '{' features '}' {
-        $$ = cool::ClassNode::MakeClassNode(
-            $2, "Object", $4, false, @1.first_line, @1.first_column
-        );
+        $$ = Store(state, cool::ClassNode::MakeClassNode(
+            $2, "Object", Take(state, $4), false, @1, arena.get()
+        ));
     }
 | CLASS_TOKEN CLASS_ID_TOKEN INHERITS_TOKEN CLASS_ID_TOKEN '{' features '}' {
-        $$ = cool::ClassNode::MakeClassNode(
-            $2, $4, $6, false, @1.first_line, @1.first_column
-        ); 
+        $$ = Store(state, cool::ClassNode::MakeClassNode(
+            $2, $4, Take(state, $6), false, @1, arena.get()
+        )); 
     }
 ;
 
 /* Class features */
 features: %empty { 
-        $$ = std::vector<cool::GenericAttributeNodePtr>(); 
+        $$ = Store(state, std::vector<cool::GenericAttributeNodePtr>()); 
     }
 | features feature ';' { 
-        $$ = std::move($1); $$.push_back($2); 
+        $$ = $1; $$->push_back(Take(state, $2)); 
     }
 | features error ';' {
         yyget_extra(state)->lastErrorCode = cool::FrontEndErrorCode::PARSER_ERROR_INVALID_FEATURE;
         LogError(cool::FrontEndErrorCode::PARSER_ERROR_INVALID_FEATURE,
-            @2.first_line, @2.first_column, logger);
-        $$ = std::move($1);
+            yyget_extra(state)->location(@2), logger);
+        $$ = $1;
     }
 ;
 
 feature: OBJECT_ID_TOKEN ':' CLASS_ID_TOKEN { 
-        $$ = cool::AttributeNode::MakeAttributeNode(
-            $1, $3, nullptr, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::GenericAttributeNodePtr>(state, cool::AttributeNode::MakeAttributeNode(
+            $1, $3, nullptr, @1, arena.get()
+        ));
     }
 | OBJECT_ID_TOKEN ':' CLASS_ID_TOKEN "<-" expr {
-        $$ = cool::AttributeNode::MakeAttributeNode(
-            $1, $3, $5, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::GenericAttributeNodePtr>(state, cool::AttributeNode::MakeAttributeNode(
+            $1, $3, Take(state, $5), @1, arena.get()
+        ));
     }
 | OBJECT_ID_TOKEN '(' formalc ')' ':' CLASS_ID_TOKEN '{' expr '}' {
-        $$ = cool::MethodNode::MakeMethodNode(
-            $1, $6, $3, $8, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::GenericAttributeNodePtr>(state, cool::MethodNode::MakeMethodNode(
+            $1, $6, Take(state, $3), Take(state, $8), @1, arena.get()
+        ));
     }
 ;
 
 /* Methods formal arguments */
 formalc : %empty { 
-        $$ = std::vector<cool::FormalNodePtr>(); 
+        $$ = Store(state, std::vector<cool::FormalNodePtr>()); 
     }
 | formall {
-        $$ = std::move($1);
+        $$ = $1;
     }
 ;
 
 formall : formal {
-        $$ = std::vector<cool::FormalNodePtr>{$1};
+        $$ = Store(state, std::vector<cool::FormalNodePtr>{Take(state, $1)});
     }
 | formall ',' formal {
-        $$ = std::move($1); $$.push_back($3);
+        $$ = $1; $$->push_back(Take(state, $3));
     }
 ;
 
 formal : OBJECT_ID_TOKEN ':' CLASS_ID_TOKEN {
-        $$ = cool::FormalNode::MakeFormalNode(
-            $1, $3, @1.first_line, @1.first_column
-        );
+        $$ = Store(state, cool::FormalNode::MakeFormalNode(
+            $1, $3, @1, arena.get()
+        ));
     }
 ;
 
 /* Expressions list, semi-column separated */
 exprs: expr ';' { 
-        $$ = std::vector<cool::ExprNodePtr>{$1}; 
+        $$ = Store(state, std::vector<cool::ExprNodePtr>{Take(state, $1)}); 
     }
 | error ';' { 
         yyget_extra(state)->lastErrorCode = cool::FrontEndErrorCode::PARSER_ERROR_INVALID_EXPRESSION;
         LogError(cool::FrontEndErrorCode::PARSER_ERROR_INVALID_EXPRESSION,
-            @1.first_line, @1.first_column, logger);
-        $$ = std::vector<cool::ExprNodePtr>(); 
+            yyget_extra(state)->location(@1), logger);
+        $$ = Store(state, std::vector<cool::ExprNodePtr>()); 
     }
 | exprs expr ';' { 
-        $$ = std::move($1); $$.push_back($2); 
+        $$ = $1; $$->push_back(Take(state, $2)); 
     }
 | exprs error ';' { 
         yyget_extra(state)->lastErrorCode = cool::FrontEndErrorCode::PARSER_ERROR_INVALID_EXPRESSION;
         LogError(cool::FrontEndErrorCode::PARSER_ERROR_INVALID_EXPRESSION,
-            @2.first_line, @2.first_column, logger);
-        $$ = std::move($1); 
+            yyget_extra(state)->location(@2), logger);
+        $$ = $1; 
     }
 ;
 
 /* Expressions list, comma separated */
 exprsc: '(' ')' {
-        $$ = std::vector<cool::ExprNodePtr>();
+        $$ = Store(state, std::vector<cool::ExprNodePtr>());
     }
 | '(' exprsl ')' {
-        $$ = std::move($2);
+        $$ = $2;
     }
 ;
 
 exprsl: expr {
-        $$ = std::vector<cool::ExprNodePtr>{$1};
+        $$ = Store(state, std::vector<cool::ExprNodePtr>{Take(state, $1)});
     }
 | exprsl ',' expr {
-        $$ = std::move($1); $$.push_back($3);
+        $$ = $1; $$->push_back(Take(state, $3));
     }
 ;
 
 /* Expressions */
 expr: OBJECT_ID_TOKEN "<-" expr { 
-        $$ = cool::AssignmentExprNode::MakeAssignmentExprNode(
-            $1, $3, @1.first_line, @1.first_column
-        ); 
+        $$ = Store<cool::ExprNodePtr>(state, cool::AssignmentExprNode::MakeAssignmentExprNode(
+            $1, Take(state, $3), @1, arena.get()
+        )); 
     }
 | expr '@' CLASS_ID_TOKEN '.' OBJECT_ID_TOKEN exprsc {
-        $$ = cool::StaticDispatchExprNode::MakeStaticDispatchExprNode(
-            $5, $3, $1, $6, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::StaticDispatchExprNode::MakeStaticDispatchExprNode(
+            $5, $3, Take(state, $1), Take(state, $6), @1, arena.get()
+        ));
     }
 | expr '.' OBJECT_ID_TOKEN exprsc {
-        $$ = cool::DispatchExprNode::MakeDispatchExprNode(
-            $3, $1, $4, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::DispatchExprNode::MakeDispatchExprNode(
+            $3, Take(state, $1), Take(state, $4), @1, arena.get()
+        ));
     }
 | OBJECT_ID_TOKEN exprsc {
-        $$ = cool::DispatchExprNode::MakeDispatchExprNode(
-            $1, nullptr, $2, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::DispatchExprNode::MakeDispatchExprNode(
+            $1, nullptr, Take(state, $2), @1, arena.get()
+        ));
     }
 | CASE_TOKEN expr OF_TOKEN casebindings ESAC_TOKEN {
-        $$ = cool::CaseExprNode::MakeCaseExprNode(
-            $4, $2, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::CaseExprNode::MakeCaseExprNode(
+            Take(state, $4), Take(state, $2), @1, arena.get()
+        ));
     }
 | IF_TOKEN expr THEN_TOKEN expr ELSE_TOKEN expr FI_TOKEN {
-        $$ = cool::IfExprNode::MakeIfExprNode(
-            $2, $4, $6, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::IfExprNode::MakeIfExprNode(
+            Take(state, $2), Take(state, $4), Take(state, $6), @1, arena.get()
+        ));
     }
 | ISVOID_TOKEN expr { 
-        $$ = cool::UnaryExprNode::MakeUnaryExprNode(
-            $2, cool::UnaryOpID::IsVoid, @1.first_line, @1.first_column
-        ); 
+        $$ = Store<cool::ExprNodePtr>(state, cool::UnaryExprNode::MakeUnaryExprNode(
+            Take(state, $2), cool::UnaryOpID::IsVoid, @1, arena.get()
+        )); 
     }
 | LET_TOKEN letbindings IN_TOKEN expr {
-        $$ = cool::LetExprNode::MakeLetExprNode(
-            std::move($2), $4, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::LetExprNode::MakeLetExprNode(
+            Take(state, $2), Take(state, $4), @1, arena.get()
+        ));
     }
 | NEW_TOKEN CLASS_ID_TOKEN { 
-        $$ = cool::NewExprNode::MakeNewExprNode(
-            $2, @1.first_line, @1.first_column
-        ); 
+        $$ = Store<cool::ExprNodePtr>(state, cool::NewExprNode::MakeNewExprNode(
+            $2, @1, arena.get()
+        )); 
     }
 | NOT_TOKEN expr {
-        $$ = cool::UnaryExprNode::MakeUnaryExprNode(
-            $2, cool::UnaryOpID::Not, @1.first_line, @1.first_column
-        ); 
+        $$ = Store<cool::ExprNodePtr>(state, cool::UnaryExprNode::MakeUnaryExprNode(
+            Take(state, $2), cool::UnaryOpID::Not, @1, arena.get()
+        )); 
     }
 | OBJECT_ID_TOKEN {
-        $$ = cool::IdExprNode::MakeIdExprNode(
-            $1, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::IdExprNode::MakeIdExprNode(
+            $1, @1, arena.get()
+        ));
     }
 | WHILE_TOKEN expr LOOP_TOKEN expr POOL_TOKEN {
-        $$ = cool::WhileExprNode::MakeWhileExprNode(
-            $2, $4, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::WhileExprNode::MakeWhileExprNode(
+            Take(state, $2), Take(state, $4), @1, arena.get()
+        ));
     }
 | '{' exprs '}' { 
-        $$ = cool::BlockExprNode::MakeBlockExprNode(
-            std::move($2), @1.first_line, @1.first_column
-        ); 
+        $$ = Store<cool::ExprNodePtr>(state, cool::BlockExprNode::MakeBlockExprNode(
+            Take(state, $2), @1, arena.get()
+        )); 
     }
 | '(' expr ')' { 
         $$ = $2; 
     }
 | expr '+' expr { 
-        $$ = cool::BinaryExprNode<cool::ArithmeticOpID>::MakeBinaryExprNode(
-            $1, $3, cool::ArithmeticOpID::Plus, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::BinaryExprNode<cool::ArithmeticOpID>::MakeBinaryExprNode(
+            Take(state, $1), Take(state, $3), cool::ArithmeticOpID::Plus, @1, arena.get()
+        ));
     }
 | expr '-' expr { 
-        $$ = cool::BinaryExprNode<cool::ArithmeticOpID>::MakeBinaryExprNode(
-            $1, $3, cool::ArithmeticOpID::Minus, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::BinaryExprNode<cool::ArithmeticOpID>::MakeBinaryExprNode(
+            Take(state, $1), Take(state, $3), cool::ArithmeticOpID::Minus, @1, arena.get()
+        ));
     }
 | expr '*' expr { 
-        $$ = cool::BinaryExprNode<cool::ArithmeticOpID>::MakeBinaryExprNode(
-            $1, $3, cool::ArithmeticOpID::Mult, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::BinaryExprNode<cool::ArithmeticOpID>::MakeBinaryExprNode(
+            Take(state, $1), Take(state, $3), cool::ArithmeticOpID::Mult, @1, arena.get()
+        ));
     }
 | expr '/' expr { 
-        $$ = cool::BinaryExprNode<cool::ArithmeticOpID>::MakeBinaryExprNode(
-            $1, $3, cool::ArithmeticOpID::Div, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::BinaryExprNode<cool::ArithmeticOpID>::MakeBinaryExprNode(
+            Take(state, $1), Take(state, $3), cool::ArithmeticOpID::Div, @1, arena.get()
+        ));
     }
 | expr '<' expr { 
-        $$ = cool::BinaryExprNode<cool::ComparisonOpID>::MakeBinaryExprNode(
-            $1, $3, cool::ComparisonOpID::LessThan, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::BinaryExprNode<cool::ComparisonOpID>::MakeBinaryExprNode(
+            Take(state, $1), Take(state, $3), cool::ComparisonOpID::LessThan, @1, arena.get()
+        ));
     }
 | expr "<=" expr { 
-        $$ = cool::BinaryExprNode<cool::ComparisonOpID>::MakeBinaryExprNode(
-            $1, $3, cool::ComparisonOpID::LessThanOrEqual, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::BinaryExprNode<cool::ComparisonOpID>::MakeBinaryExprNode(
+            Take(state, $1), Take(state, $3), cool::ComparisonOpID::LessThanOrEqual, @1, arena.get()
+        ));
     }
 | expr '=' expr { 
-        $$ = cool::BinaryExprNode<cool::ComparisonOpID>::MakeBinaryExprNode(
-            $1, $3, cool::ComparisonOpID::Equal, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::BinaryExprNode<cool::ComparisonOpID>::MakeBinaryExprNode(
+            Take(state, $1), Take(state, $3), cool::ComparisonOpID::Equal, @1, arena.get()
+        ));
     }
 | '~' expr { 
-        $$ = cool::UnaryExprNode::MakeUnaryExprNode(
-            $2, cool::UnaryOpID::Complement, @1.first_line, @1.first_column
-        ); 
+        $$ = Store<cool::ExprNodePtr>(state, cool::UnaryExprNode::MakeUnaryExprNode(
+            Take(state, $2), cool::UnaryOpID::Complement, @1, arena.get()
+        )); 
     }
 | FALSE_TOKEN {
-        $$ = cool::BooleanExprNode::MakeBooleanExprNode(
-            false, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::BooleanExprNode::MakeBooleanExprNode(
+            false, @1, arena.get()
+        ));
     }
 | INTEGER_TOKEN {
-        $$ = cool::LiteralExprNode<int32_t>::MakeLiteralExprNode(
-            $1, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::LiteralExprNode<int32_t>::MakeLiteralExprNode(
+            $1, @1, arena.get()
+        ));
     }
 | STRING_TOKEN {
-        $$ = cool::LiteralExprNode<std::string>::MakeLiteralExprNode(
-            $1, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::LiteralExprNode<std::string>::MakeLiteralExprNode(
+            Take(state, $1), @1, arena.get()
+        ));
     }
 | TRUE_TOKEN {
-        $$ = cool::BooleanExprNode::MakeBooleanExprNode(
-            true, @1.first_line, @1.first_column
-        );
+        $$ = Store<cool::ExprNodePtr>(state, cool::BooleanExprNode::MakeBooleanExprNode(
+            true, @1, arena.get()
+        ));
     }
 ;
 
 /* Case bindings list */
 casebindings: casebinding ';' {
-        $$ = std::vector<cool::CaseBindingNodePtr>{$1};
+        $$ = Store(state, std::vector<cool::CaseBindingNodePtr>{Take(state, $1)});
     }
 | casebindings casebinding ';' {
-        $$ = std::move($1); $$.push_back($2);
+        $$ = $1; $$->push_back(Take(state, $2));
     }
 ;
 
 /* Case bindings */
 casebinding: OBJECT_ID_TOKEN ':' CLASS_ID_TOKEN "=>" expr {
-        $$ = cool::CaseBindingNode::MakeCaseBindingNode(
-            $1, $3, $5, @1.first_line, @1.first_column
-        );
+        $$ = Store(state, cool::CaseBindingNode::MakeCaseBindingNode(
+            $1, $3, Take(state, $5), @1, arena.get()
+        ));
     }
 ;
 
 /* Let bindings list */
 letbindings: letbinding {
-        $$ = std::vector<cool::LetBindingNodePtr>{$1};
+        $$ = Store(state, std::vector<cool::LetBindingNodePtr>{Take(state, $1)});
     }
 | letbindings ',' letbinding {
-        $$ = std::move($1); $$.push_back($3);
+        $$ = $1; $$->push_back(Take(state, $3));
     }
 ;
 
 /* Let bindings */
 letbinding: OBJECT_ID_TOKEN ':' CLASS_ID_TOKEN {
-        $$ = cool::LetBindingNode::MakeLetBindingNode(
-            $1, $3, nullptr, @1.first_line, @1.first_column
-        );
+        $$ = Store(state, cool::LetBindingNode::MakeLetBindingNode(
+            $1, $3, nullptr, @1, arena.get()
+        ));
     }
 | OBJECT_ID_TOKEN ':' CLASS_ID_TOKEN "<-" expr {
-        $$ = cool::LetBindingNode::MakeLetBindingNode(
-            $1, $3, $5, @1.first_line, @1.first_column
-        );
+        $$ = Store(state, cool::LetBindingNode::MakeLetBindingNode(
+            $1, $3, Take(state, $5), @1, arena.get()
+        ));
     }
 ;
 
 %%
 
 std::vector<cool::ClassNodePtr> InstallBuiltInClasses(std::vector<cool::ClassNodePtr> classes) {
-    std::vector<cool::ClassNodePtr> targetClasses;
-
-    /// Install Object class
-    {
-        std::vector<cool::FormalNodePtr> emptyArgs;
-        std::vector<cool::GenericAttributeNodePtr> attrs;
-        attrs.push_back(cool::MethodNode::MakeMethodNode("abort", "Object", emptyArgs, nullptr, 0, 0));
-        attrs.push_back(cool::MethodNode::MakeMethodNode("copy", "SELF_TYPE", emptyArgs, nullptr, 0, 0));
-        attrs.push_back(cool::MethodNode::MakeMethodNode("type_name", "String", emptyArgs, nullptr, 0, 0));
-        targetClasses.push_back(cool::ClassNode::MakeClassNode("Object", "", attrs, true, 0, 0));
-    }
-
-    /// Install Int and Bool classes
-    {
-        std::vector<cool::GenericAttributeNodePtr> emptyAttrs;
-        targetClasses.push_back(cool::ClassNode::MakeClassNode("Int", "Object", emptyAttrs, true, 0, 0));
-        targetClasses.push_back(cool::ClassNode::MakeClassNode("Bool", "Object", emptyAttrs, true, 0, 0));
-    }
-
-    /// Install IO class
-    {
-        std::vector<cool::FormalNodePtr> args;
-        std::vector<cool::GenericAttributeNodePtr> attrs;
-
-        /// Methods with no arguments first
-        attrs.push_back(cool::MethodNode::MakeMethodNode("in_string", "String", args, nullptr, 0, 0));
-        attrs.push_back(cool::MethodNode::MakeMethodNode("in_int", "Int", args, nullptr, 0, 0));
-
-        /// Remaining methods
-        args.push_back(cool::FormalNode::MakeFormalNode("x", "String", 0, 0));
-        attrs.push_back(cool::MethodNode::MakeMethodNode("out_string", "SELF_TYPE", args, nullptr, 0, 0));
-
-        args.pop_back();
-        args.push_back(cool::FormalNode::MakeFormalNode("x", "Int", 0, 0));
-        attrs.push_back(cool::MethodNode::MakeMethodNode("out_int", "SELF_TYPE", args, nullptr, 0, 0));
-
-        /// Install class
-        targetClasses.push_back(cool::ClassNode::MakeClassNode("IO", "Object", attrs, true, 0, 0));
-    }
-
-    /// Install String class
-    {
-        std::vector<cool::FormalNodePtr> args;
-        std::vector<cool::GenericAttributeNodePtr> attrs;
-
-        /// Length argument
-        attrs.push_back(cool::AttributeNode::MakeAttributeNode("len", "Int", nullptr, 0, 0));
-
-        /// Method with no arguments first
-        attrs.push_back(cool::MethodNode::MakeMethodNode("length", "Int", args, nullptr, 0, 0));
-
-        /// Remaining methods
-        args.push_back(cool::FormalNode::MakeFormalNode("s", "String", 0, 0));
-        attrs.push_back(cool::MethodNode::MakeMethodNode("concat", "String", args, nullptr, 0, 0));
-
-        args.pop_back();
-        args.push_back(cool::FormalNode::MakeFormalNode("i", "Int", 0, 0));
-        args.push_back(cool::FormalNode::MakeFormalNode("l", "Int", 0, 0));
-        attrs.push_back(cool::MethodNode::MakeMethodNode("substr", "String", args, nullptr, 0, 0));
-
-        /// Install class
-        targetClasses.push_back(cool::ClassNode::MakeClassNode("String", "Object", attrs, true, 0, 0));
-    }
+    /// The built-in classes are built once and shared by all programs
+    std::vector<cool::ClassNodePtr> targetClasses = cool::ProgramNode::BuiltInClasses();
 
     /// Copy parsed classes
     for (auto classNode: classes) {
@@ -542,7 +517,7 @@ std::vector<cool::ClassNodePtr> InstallBuiltInClasses(std::vector<cool::ClassNod
     return targetClasses;
 }
 
-void LogError(const cool::FrontEndErrorCode code, const uint32_t lloc, const uint32_t cloc, cool::LoggerCollection* logger) {
+void LogError(const cool::FrontEndErrorCode code, const cool::SourceLocation& location, cool::LoggerCollection* logger) {
     
     static std::unordered_map<cool::FrontEndErrorCode, std::string> sErrorToString = {
         {cool::FrontEndErrorCode::PARSER_ERROR_INVALID_CLASS, "invalid class definition"},
@@ -550,8 +525,8 @@ void LogError(const cool::FrontEndErrorCode code, const uint32_t lloc, const uin
         {cool::FrontEndErrorCode::PARSER_ERROR_INVALID_EXPRESSION, "invalid expression definition"}
     };
 
-    /// Do nothing if logger is not registered
-    if (!logger) {
+    /// Do nothing if error messages are not recorded
+    if (!LOG_ENABLED(logger, ERROR)) {
         return;
     }
 
@@ -560,7 +535,7 @@ void LogError(const cool::FrontEndErrorCode code, const uint32_t lloc, const uin
 
     /// Log error message
     logger->logMessage(cool::LogMessage::MakeErrorMessage("line: %d, col: %d: Error: %s", 
-        lloc, cloc, sErrorToString[code]));
+        location.line, location.column, sErrorToString[code]));
 }
 
-void yyerror (YYLTYPE* yylloc, cool::LoggerCollection*, yyscan_t state, cool::ProgramNodePtr*, char const *) { }
+void yyerror (YYLTYPE* yylloc, cool::LoggerCollection*, yyscan_t state, cool::ProgramNodePtr*, std::shared_ptr<cool::NodeArena>, char const *) { }
@@ -1,7 +1,14 @@
+#include <cool/frontend/fast_scanner.h>
 #include <cool/frontend/scanner_state.h>
 
 #include <cassert>
 #include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace {
 static constexpr uint32_t MAX_BUFFER_SIZE = 2048;
@@ -15,11 +22,14 @@ extern YY_BUFFER_STATE yy_create_buffer(FILE *, int, yyscan_t);
 extern void yy_delete_buffer(YY_BUFFER_STATE, yyscan_t);
 extern int yylex_destroy(yyscan_t);
 extern int yylex_init_extra(cool::ExtraState *, yyscan_t *);
+extern YY_BUFFER_STATE yy_scan_buffer(char *, size_t, yyscan_t);
 extern YY_BUFFER_STATE yy_scan_string(const char *, yyscan_t);
 extern void yy_switch_to_buffer(YY_BUFFER_STATE, yyscan_t);
 
 namespace cool {
 
+constexpr size_t ScannerState::SENTINEL_SIZE;
+
 /// RAII class to store the buffer of a FLEX scanner
 class Buffer {
 
@@ -32,6 +42,18 @@ public:
   /// \return the buffer
   yy_buffer_state *buffer() const { return buffer_; }
 
+  /// \brief Return the input text, for the hand-written scanner
+  ///
+  /// \param[out] length length of the input text
+  /// \return the input text
+  virtual const char *text(size_t *length) = 0;
+
+  /// \brief Register the input text with a source manager
+  ///
+  /// \param[in] sourceManager source manager
+  /// \return the location of the first character of the input text
+  virtual uint32_t registerText(SourceManager *sourceManager) = 0;
+
 protected:
   Buffer(yyscan_t state) : state_(state) {}
 
@@ -47,8 +69,63 @@ public:
   FileBuffer(yyscan_t state, const std::string &filePath);
   ~FileBuffer() override;
 
+  const char *text(size_t *length) override;
+
+  uint32_t registerText(SourceManager *sourceManager) override {
+    return sourceManager->addFile(filePath_);
+  }
+
 private:
   FILE *file_ = nullptr;
+  std::string filePath_;
+  std::string text_;
+};
+
+/// Specialization of buffer class for memory-mapped files. The mapping is
+/// private, so that the scanner can write into it without modifying the file
+class MappedFileBuffer : public Buffer {
+
+public:
+  MappedFileBuffer() = delete;
+  MappedFileBuffer(yyscan_t state, const std::string &filePath);
+  ~MappedFileBuffer() override;
+
+  const char *text(size_t *length) override {
+    *length = size_ - ScannerState::SENTINEL_SIZE;
+    return static_cast<const char *>(memory_);
+  }
+
+  uint32_t registerText(SourceManager *sourceManager) override {
+    return sourceManager->addFile(filePath_);
+  }
+
+private:
+  std::string filePath_;
+  void *memory_ = nullptr;
+  size_t size_ = 0;
+};
+
+/// Specialization of buffer class for buffers owned by the client code
+class ExternalBuffer : public Buffer {
+
+public:
+  ExternalBuffer() = delete;
+  ExternalBuffer(yyscan_t state, char *buffer, const size_t size);
+  ~ExternalBuffer() override = default;
+
+  const char *text(size_t *length) override {
+    *length = size_ - ScannerState::SENTINEL_SIZE;
+    return text_;
+  }
+
+  uint32_t registerText(SourceManager *sourceManager) override {
+    return sourceManager->addText(
+        std::string(text_, size_ - ScannerState::SENTINEL_SIZE));
+  }
+
+private:
+  const char *text_ = nullptr;
+  size_t size_ = 0;
 };
 
 /// Specialization of buffer class for string objects
@@ -59,6 +136,16 @@ public:
   StringBuffer(yyscan_t state, const std::string &inputString);
   ~StringBuffer() override = default;
 
+  /// The Flex scanner stops at the first null character of the string
+  const char *text(size_t *length) override {
+    *length = std::strlen(string_.c_str());
+    return string_.data();
+  }
+
+  uint32_t registerText(SourceManager *sourceManager) override {
+    return sourceManager->addText(string_.c_str());
+  }
+
 private:
   std::string string_;
 };
@@ -70,7 +157,7 @@ Buffer::~Buffer() {
 }
 
 FileBuffer::FileBuffer(yyscan_t state, const std::string &filePath)
-    : Buffer(state) {
+    : Buffer(state), filePath_(filePath) {
   /// Open file stream
   file_ = fopen(filePath.c_str(), "r");
   assert(file_);
@@ -87,6 +174,69 @@ FileBuffer::~FileBuffer() {
   }
 }
 
+const char *FileBuffer::text(size_t *length) {
+  /// The file is read on demand, since the Flex scanner reads it in blocks
+  if (text_.empty()) {
+    char block[MAX_BUFFER_SIZE];
+    size_t count = 0;
+    while ((count = fread(block, 1, sizeof(block), file_)) > 0) {
+      text_.append(block, count);
+    }
+  }
+  *length = text_.size();
+  return text_.data();
+}
+
+MappedFileBuffer::MappedFileBuffer(yyscan_t state, const std::string &filePath)
+    : Buffer(state), filePath_(filePath) {
+  /// Open file and get its size
+  const int fd = open(filePath.c_str(), O_RDONLY);
+  assert(fd >= 0);
+
+  struct stat fileStat;
+  auto status = fstat(fd, &fileStat);
+  assert(status == 0);
+
+  /// Reserve zero-filled memory for the file content and the sentinel bytes
+  const size_t fileSize = fileStat.st_size;
+  size_ = fileSize + ScannerState::SENTINEL_SIZE;
+  memory_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  assert(memory_ != MAP_FAILED);
+
+  /// Map the file over the reserved memory. The bytes past the end of the file
+  /// are zero, whether they belong to the last page of the file or not
+  if (fileSize > 0) {
+    void *file = mmap(memory_, fileSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_FIXED, fd, 0);
+    assert(file == memory_);
+  }
+  close(fd);
+
+  /// Scan the mapped file in place
+  buffer_ = yy_scan_buffer(static_cast<char *>(memory_), size_, state_);
+  assert(buffer_);
+  yy_switch_to_buffer(buffer_, state_);
+}
+
+MappedFileBuffer::~MappedFileBuffer() {
+  if (buffer_) {
+    yy_delete_buffer(buffer_, state_);
+    buffer_ = nullptr;
+  }
+  if (memory_) {
+    munmap(memory_, size_);
+  }
+}
+
+ExternalBuffer::ExternalBuffer(yyscan_t state, char *buffer, const size_t size)
+    : Buffer(state), text_(buffer), size_(size) {
+  assert(size >= ScannerState::SENTINEL_SIZE);
+  buffer_ = yy_scan_buffer(buffer, size, state_);
+  assert(buffer_);
+  yy_switch_to_buffer(buffer_, state_);
+}
+
 StringBuffer::StringBuffer(yyscan_t state, const std::string &inputString)
     : Buffer(state), string_(inputString) {
   buffer_ = yy_scan_string(string_.c_str(), state_);
@@ -100,6 +250,7 @@ ScannerState::ScannerState() : state_(nullptr), buffer_(nullptr) {
 }
 
 ScannerState::~ScannerState() {
+  fastScanner_.reset();
   buffer_.reset();
   if (state_ != nullptr) {
     auto status = yylex_destroy(state_);
@@ -115,6 +266,22 @@ ScannerState::MakeFromFile(const std::string &inputPath) {
   return state;
 }
 
+std::unique_ptr<ScannerState>
+ScannerState::MakeFromMappedFile(const std::string &filePath) {
+  auto state = std::unique_ptr<ScannerState>(new ScannerState{});
+  state->buffer_ =
+      std::unique_ptr<Buffer>(new MappedFileBuffer(state->state_, filePath));
+  return state;
+}
+
+std::unique_ptr<ScannerState> ScannerState::MakeFromBuffer(char *buffer,
+                                                           const size_t size) {
+  auto state = std::unique_ptr<ScannerState>(new ScannerState{});
+  state->buffer_ =
+      std::unique_ptr<Buffer>(new ExternalBuffer(state->state_, buffer, size));
+  return state;
+}
+
 std::unique_ptr<ScannerState>
 ScannerState::MakeFromString(const std::string &inputString) {
   auto state = std::unique_ptr<ScannerState>(new ScannerState{});
@@ -131,4 +298,28 @@ void ScannerState::resetErrorCode() {
   extraState_.lastErrorCode = FrontEndErrorCode::NO_ERROR;
 }
 
+uint32_t ScannerState::registerInput(SourceManager *sourceManager) const {
+  return buffer_->registerText(sourceManager);
+}
+
+void ScannerState::setSource(std::shared_ptr<const SourceManager> sourceManager,
+                             const uint32_t startOffset) {
+  sourceManager_ = std::move(sourceManager);
+  extraState_.sourceManager = sourceManager_.get();
+  extraState_.startOffset = startOffset;
+}
+
+void ScannerState::useFastScanner(const bool enabled) {
+  if (enabled && !fastScanner_) {
+    size_t length = 0;
+    const char *text = buffer_->text(&length);
+    fastScanner_.reset(new FastScanner(text, length, &extraState_));
+  } else if (!enabled) {
+    fastScanner_.reset();
+  }
+  extraState_.fastScanner = fastScanner_.get();
+}
+
+void ScannerState::clearSemanticValues() { extraState_.semanticValues.clear(); }
+
 } // namespace cool
@@ -0,0 +1,138 @@
+#include <cool/frontend/source_splitter.h>
+
+namespace cool {
+
+namespace {
+
+/// Scanner states the splitter needs to track
+enum class SplitterState { CODE, INLINE_COMMENT, COMMENT, STRING };
+
+/// \brief Helper function to check whether a character is a white space
+///
+/// \param[in] c character
+/// \return true if the character is a white space other than a newline
+bool IsWhiteSpace(const char c) {
+  return c == ' ' || c == '\f' || c == '\r' || c == '\t' || c == '\v';
+}
+
+} // namespace
+
+std::vector<SourceChunk> SplitAtClassBoundaries(const char *text,
+                                                const size_t length,
+                                                const size_t minChunkLength) {
+  const std::vector<SourceChunk> wholeText = {SourceChunk{0, length, 1}};
+  std::vector<SourceChunk> chunks;
+
+  SplitterState state = SplitterState::CODE;
+  uint32_t openComments = 0;
+  int32_t openBraces = 0;
+  uint32_t line = 1;
+
+  /// A class definition has been terminated and no token has been seen since
+  bool classTerminated = false;
+
+  /// Start of the line following a class definition, where a chunk can end
+  bool hasBoundary = false;
+  SourceChunk boundary;
+
+  SourceChunk chunk;
+  for (size_t i = 0; i < length; ++i) {
+    const char c = text[i];
+    const char next = i + 1 < length ? text[i + 1] : '\0';
+
+    /// A newline outside of comments and strings is a candidate boundary
+    if (c == '\n' && (state == SplitterState::CODE ||
+                      state == SplitterState::INLINE_COMMENT)) {
+      line++;
+      state = SplitterState::CODE;
+      if (classTerminated && !hasBoundary) {
+        hasBoundary = true;
+        boundary.offset = i + 1;
+        boundary.line = line;
+      }
+      continue;
+    }
+
+    switch (state) {
+    case SplitterState::INLINE_COMMENT:
+      break;
+    case SplitterState::COMMENT:
+      if (c == '\n') {
+        line++;
+      } else if (c == '(' && next == '*') {
+        openComments++;
+        i++;
+      } else if (c == '*' && next == ')') {
+        openComments--;
+        i++;
+        if (openComments == 0) {
+          state = SplitterState::CODE;
+        }
+      }
+      break;
+    case SplitterState::STRING:
+      if (c == '\\' && i + 1 < length) {
+        line += next == '\n' ? 1 : 0;
+        i++;
+      } else if (c == '"') {
+        state = SplitterState::CODE;
+      } else if (c == '\n' || c == '\0') {
+        return wholeText;
+      }
+      break;
+    case SplitterState::CODE:
+      if (IsWhiteSpace(c)) {
+        break;
+      }
+      if (c == '-' && next == '-') {
+        state = SplitterState::INLINE_COMMENT;
+        i++;
+        break;
+      }
+      if (c == '(' && next == '*') {
+        state = SplitterState::COMMENT;
+        openComments = 1;
+        i++;
+        break;
+      }
+
+      /// First token after a class definition: close the current chunk if it
+      /// is long enough
+      if (hasBoundary && boundary.offset - chunk.offset >= minChunkLength) {
+        chunk.length = boundary.offset - chunk.offset;
+        chunks.push_back(chunk);
+        chunk = boundary;
+      }
+      hasBoundary = false;
+      classTerminated = false;
+
+      if (c == '"') {
+        state = SplitterState::STRING;
+      } else if (c == '<' && next == '-') {
+        /// Assignment operator, which must not be mistaken for a comment
+        i++;
+      } else if (c == '{') {
+        openBraces++;
+      } else if (c == '}') {
+        if (--openBraces < 0) {
+          return wholeText;
+        }
+      } else if (c == ';' && openBraces == 0) {
+        classTerminated = true;
+      }
+      break;
+    }
+  }
+
+  /// Unterminated comments, strings and classes are reported by the parser
+  if (state == SplitterState::COMMENT || state == SplitterState::STRING ||
+      openBraces != 0) {
+    return wholeText;
+  }
+
+  chunk.length = length - chunk.offset;
+  chunks.push_back(chunk);
+  return chunks;
+}
+
+} // namespace cool
@@ -0,0 +1,861 @@
+#include <cool/core/class_registry.h>
+#include <cool/core/source_manager.h>
+#include <cool/ir/ast_cache.h>
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+#include <cool/ir/node_arena.h>
+#include <cool/ir/static_visitor.h>
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cool {
+
+constexpr uint32_t AstCache::VERSION;
+
+namespace {
+
+/// Magic number at the beginning of a cache, "CAST" in little-endian order
+constexpr uint32_t MAGIC = 0x54534143;
+
+/// Flags of a node record
+constexpr uint8_t HAS_EXPR = 0x1;
+constexpr uint8_t IS_SELF = 0x2;
+constexpr uint8_t TRUE_VALUE = 0x4;
+
+/// Header of the cache
+struct CacheHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t symbolsCount;
+  uint32_t literalsCount;
+  uint32_t sourcesCount;
+  uint32_t classNamesCount;
+  uint32_t classesCount;
+  uint32_t fileName;
+};
+
+/// Header of a node record. The type ID is only meaningful for expressions
+struct NodeHeader {
+  uint8_t kind;
+  uint8_t flags;
+  uint16_t reserved;
+  uint32_t loc;
+  int32_t typeID;
+};
+
+static_assert(sizeof(CacheHeader) % sizeof(uint32_t) == 0,
+              "Cache header must be made of 32-bit words");
+static_assert(sizeof(NodeHeader) == 3 * sizeof(uint32_t),
+              "Node header must be made of 32-bit words");
+
+/// \brief Helper function to append the bytes of a value to a buffer
+///
+/// \param[in] value value to append
+/// \param[out] buffer output buffer
+template <typename T> void AppendValue(const T &value, std::string *buffer) {
+  buffer->append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/// \brief Helper function to append a string to a buffer, preceded by its
+/// length and padded to a 32-bit word
+///
+/// \param[in] value string to append
+/// \param[out] buffer output buffer
+void AppendString(const std::string &value, std::string *buffer) {
+  AppendValue(static_cast<uint32_t>(value.length()), buffer);
+  buffer->append(value);
+  buffer->append((sizeof(uint32_t) - value.length() % sizeof(uint32_t)) %
+                     sizeof(uint32_t),
+                 '\0');
+}
+
+/// Class that serializes the nodes of a program in preorder. Identifiers and
+/// string literals are collected in tables as they are encountered
+class Writer : public StaticVisitor<Writer, void> {
+
+public:
+  /// Program, class and attributes nodes
+  void apply(ProgramNode *node) {
+    for (const auto &classNode : node->classes()) {
+      if (!classNode->builtIn()) {
+        dispatch(classNode.get());
+      }
+    }
+  }
+
+  void apply(ClassNode *node) {
+    writeHeader(node, 0);
+    writeSymbol(node->className());
+    writeSymbol(node->parentClassName());
+    writeWord(node->attributes().size());
+    writeWord(node->methods().size());
+    for (const auto &attributeNode : node->attributes()) {
+      dispatch(attributeNode.get());
+    }
+    for (const auto &methodNode : node->methods()) {
+      dispatch(methodNode.get());
+    }
+  }
+
+  void apply(AttributeNode *node) {
+    writeHeader(node, node->initExpr() ? HAS_EXPR : 0);
+    writeSymbol(node->id());
+    writeSymbol(node->typeName());
+    writeOptional(node->initExpr());
+  }
+
+  void apply(MethodNode *node) {
+    writeHeader(node, node->body() ? HAS_EXPR : 0);
+    writeSymbol(node->id());
+    writeSymbol(node->returnTypeName());
+    writeChildren(node->arguments());
+    writeOptional(node->body());
+  }
+
+  void apply(FormalNode *node) {
+    writeHeader(node, 0);
+    writeSymbol(node->id());
+    writeSymbol(node->typeName());
+  }
+
+  /// Expressions nodes
+  void apply(AssignmentExprNode *node) {
+    writeHeader(node, 0);
+    writeSymbol(node->id());
+    dispatch(node->rhsExpr());
+  }
+
+  template <typename OperatorT> void apply(BinaryExprNode<OperatorT> *node) {
+    writeHeader(node, 0);
+    writeWord(static_cast<uint32_t>(node->opID()));
+    dispatch(node->lhsExpr());
+    dispatch(node->rhsExpr());
+  }
+
+  void apply(BlockExprNode *node) {
+    writeHeader(node, 0);
+    writeChildren(node->exprs());
+  }
+
+  void apply(BooleanExprNode *node) {
+    writeHeader(node, node->value() ? TRUE_VALUE : 0);
+  }
+
+  void apply(CaseBindingNode *node) {
+    writeHeader(node, 0);
+    writeSymbol(node->id());
+    writeSymbol(node->typeName());
+    dispatch(node->expr());
+  }
+
+  void apply(CaseExprNode *node) {
+    writeHeader(node, 0);
+    dispatch(node->expr());
+    writeChildren(node->cases());
+  }
+
+  void apply(DispatchExprNode *node) {
+    writeHeader(node, node->hasExpr() ? HAS_EXPR : 0);
+    writeSymbol(node->methodName());
+    writeOptional(node->expr());
+    writeChildren(node->params());
+  }
+
+  void apply(IdExprNode *node) {
+    writeHeader(node, 0);
+    writeSymbol(node->id());
+  }
+
+  void apply(IfExprNode *node) {
+    writeHeader(node, 0);
+    dispatch(node->ifExpr());
+    dispatch(node->thenExpr());
+    dispatch(node->elseExpr());
+  }
+
+  void apply(LetBindingNode *node) {
+    writeHeader(node, node->hasExpr() ? HAS_EXPR : 0);
+    writeSymbol(node->id());
+    writeSymbol(node->typeName());
+    writeOptional(node->expr());
+  }
+
+  void apply(LetExprNode *node) {
+    writeHeader(node, 0);
+    writeChildren(node->bindings());
+    dispatch(node->expr());
+  }
+
+  void apply(LiteralExprNode<int32_t> *node) {
+    writeHeader(node, 0);
+    writeWord(static_cast<uint32_t>(node->value()));
+  }
+
+  void apply(LiteralExprNode<std::string> *node) {
+    writeHeader(node, 0);
+    writeWord(literalIndex(node->value()));
+  }
+
+  void apply(NewExprNode *node) {
+    writeHeader(node, 0);
+    writeSymbol(node->typeName());
+  }
+
+  void apply(StaticDispatchExprNode *node) {
+    writeHeader(node, 0);
+    writeSymbol(node->methodName());
+    writeSymbol(node->callerClass());
+    dispatch(node->expr());
+    writeChildren(node->params());
+  }
+
+  void apply(UnaryExprNode *node) {
+    writeHeader(node, 0);
+    writeWord(static_cast<uint32_t>(node->opID()));
+    dispatch(node->expr());
+  }
+
+  void apply(WhileExprNode *node) {
+    writeHeader(node, 0);
+    dispatch(node->loopCond());
+    dispatch(node->loopBody());
+  }
+
+  /// \brief Return the index of a symbol in the symbols table, adding the
+  /// symbol to the table if needed
+  ///
+  /// \param[in] symbol symbol
+  /// \return the index of the symbol
+  uint32_t symbolIndex(const Symbol &symbol) {
+    auto it = symbolIndices_.find(symbol);
+    if (it != symbolIndices_.end()) {
+      return it->second;
+    }
+    symbolIndices_.insert({symbol, symbols_.size()});
+    symbols_.push_back(symbol);
+    return symbols_.size() - 1;
+  }
+
+  /// \brief Return the index of a string literal in the literals table,
+  /// adding the literal to the table if needed
+  ///
+  /// \param[in] literal string literal
+  /// \return the index of the string literal
+  uint32_t literalIndex(const std::string &literal) {
+    auto it = literalIndices_.find(literal);
+    if (it != literalIndices_.end()) {
+      return it->second;
+    }
+    literalIndices_.insert({literal, literals_.size()});
+    literals_.push_back(literal);
+    return literals_.size() - 1;
+  }
+
+  const std::string &nodes() const { return nodes_; }
+  const std::vector<Symbol> &symbols() const { return symbols_; }
+  const std::vector<std::string> &literals() const { return literals_; }
+
+private:
+  void writeWord(const uint32_t value) { AppendValue(value, &nodes_); }
+
+  void writeSymbol(const Symbol &symbol) { writeWord(symbolIndex(symbol)); }
+
+  void writeHeader(Node *node, const uint8_t flags) {
+    NodeHeader header{static_cast<uint8_t>(node->kind()), flags, 0,
+                      node->loc(), 0};
+    AppendValue(header, &nodes_);
+  }
+
+  void writeHeader(ExprNode *node, const uint8_t flags) {
+    const auto &type = node->type();
+    NodeHeader header{static_cast<uint8_t>(node->kind()),
+                      static_cast<uint8_t>(flags | (type.isSelf ? IS_SELF : 0)),
+                      0, node->loc(), type.typeID};
+    AppendValue(header, &nodes_);
+  }
+
+  void writeOptional(Node *node) {
+    if (node) {
+      dispatch(node);
+    }
+  }
+
+  template <typename NodePtrT>
+  void writeChildren(const std::vector<NodePtrT> &nodes) {
+    writeWord(nodes.size());
+    for (const auto &node : nodes) {
+      dispatch(node.get());
+    }
+  }
+
+  std::string nodes_;
+  std::vector<Symbol> symbols_;
+  std::unordered_map<Symbol, uint32_t> symbolIndices_;
+  std::vector<std::string> literals_;
+  std::unordered_map<std::string, uint32_t> literalIndices_;
+};
+
+/// Class that loads the nodes of a program from a cache. Reads past the end of
+/// the cache, as well as invalid node kinds and indices, put the reader in an
+/// error state, after which all the reads return zero and no node is created
+class Reader {
+
+public:
+  Reader(const char *data, const size_t length, NodeArena *arena)
+      : cursor_(data), end_(data + length), arena_(arena) {}
+
+  /// \brief Check whether all the reads so far were valid
+  ///
+  /// \return true if all the reads were valid, false otherwise
+  bool ok() const { return ok_; }
+
+  /// \brief Check whether the whole cache was read
+  ///
+  /// \return true if the whole cache was read, false otherwise
+  bool atEnd() const { return cursor_ == end_; }
+
+  /// \brief Read a 32-bit word
+  ///
+  /// \return the word, zero in case of error
+  uint32_t readWord() {
+    uint32_t value = 0;
+    readValue(&value);
+    return value;
+  }
+
+  /// \brief Read a string preceded by its length and padded to a 32-bit word
+  ///
+  /// \param[out] length string length
+  /// \return a pointer to the first character of the string, nullptr in case
+  /// of error
+  const char *readString(uint32_t *length) {
+    *length = readWord();
+    const size_t paddedLength =
+        (*length + sizeof(uint32_t) - 1) / sizeof(uint32_t) * sizeof(uint32_t);
+    if (!ok_ || paddedLength > static_cast<size_t>(end_ - cursor_)) {
+      ok_ = false;
+      return nullptr;
+    }
+    const char *value = cursor_;
+    cursor_ += paddedLength;
+    return value;
+  }
+
+  /// \brief Set the number of class IDs, which bounds the expression types
+  ///
+  /// \param[in] classIDsCount number of class IDs
+  void setClassIDsCount(const uint32_t classIDsCount) {
+    classIDsCount_ = classIDsCount;
+  }
+
+  /// \brief Read the symbols and the string literals tables
+  ///
+  /// \param[in] symbolsCount number of symbols
+  /// \param[in] literalsCount number of string literals
+  void readTables(const uint32_t symbolsCount, const uint32_t literalsCount) {
+    for (uint32_t i = 0; i < symbolsCount && ok_; ++i) {
+      uint32_t length = 0;
+      const char *value = readString(&length);
+      symbols_.push_back(ok_ ? Symbol(value, length) : Symbol());
+    }
+
+    for (uint32_t i = 0; i < literalsCount && ok_; ++i) {
+      uint32_t length = 0;
+      const char *value = readString(&length);
+      literals_.push_back(ok_ ? std::string(value, length) : std::string());
+    }
+  }
+
+  /// \brief Read the index of a symbol and return the symbol
+  ///
+  /// \return the symbol, the empty symbol in case of error
+  Symbol readSymbol() {
+    const uint32_t index = readWord();
+    if (index >= symbols_.size()) {
+      ok_ = false;
+      return Symbol();
+    }
+    return symbols_[index];
+  }
+
+  /// \brief Read the index of a string literal and return the literal
+  ///
+  /// \return the string literal, the empty string in case of error
+  const std::string &readLiteral() { return literal(readWord()); }
+
+  /// \brief Return a string literal given its index
+  ///
+  /// \param[in] index index of the string literal
+  /// \return the string literal, the empty string in case of error
+  const std::string &literal(const uint32_t index) {
+    static const std::string emptyLiteral;
+    if (index >= literals_.size()) {
+      ok_ = false;
+      return emptyLiteral;
+    }
+    return literals_[index];
+  }
+
+  /// \brief Read a class node
+  ///
+  /// \return a shared pointer to the class node, nullptr in case of error
+  ClassNodePtr readClass() {
+    NodeHeader header;
+    if (!readHeader(NodeKind::Class, &header)) {
+      return nullptr;
+    }
+
+    const Symbol className = readSymbol();
+    const Symbol parentClassName = readSymbol();
+    const uint32_t attributesCount = readCount();
+    const uint32_t methodsCount = readCount();
+
+    std::vector<GenericAttributeNodePtr> attributes;
+    for (uint32_t i = 0; i < attributesCount && ok_; ++i) {
+      attributes.push_back(readAttribute());
+    }
+    for (uint32_t i = 0; i < methodsCount && ok_; ++i) {
+      attributes.push_back(readMethod());
+    }
+
+    if (!ok_) {
+      return nullptr;
+    }
+    return ClassNode::MakeClassNode(className, parentClassName, attributes,
+                                    false, header.loc, arena_);
+  }
+
+private:
+  template <typename T> void readValue(T *value) {
+    if (!ok_ || sizeof(T) > static_cast<size_t>(end_ - cursor_)) {
+      ok_ = false;
+      return;
+    }
+    memcpy(value, cursor_, sizeof(T));
+    cursor_ += sizeof(T);
+  }
+
+  /// Read a count of nodes. Each node takes at least a header, so that counts
+  /// that exceed the remaining length are invalid
+  uint32_t readCount() {
+    const uint32_t count = readWord();
+    if (count > static_cast<size_t>(end_ - cursor_) / sizeof(NodeHeader)) {
+      ok_ = false;
+      return 0;
+    }
+    return count;
+  }
+
+  bool readHeader(NodeHeader *header) {
+    readValue(header);
+    return ok_;
+  }
+
+  bool readHeader(const NodeKind kind, NodeHeader *header) {
+    if (readHeader(header) && header->kind != static_cast<uint8_t>(kind)) {
+      ok_ = false;
+    }
+    return ok_;
+  }
+
+  GenericAttributeNodePtr readAttribute() {
+    NodeHeader header;
+    if (!readHeader(NodeKind::Attribute, &header)) {
+      return nullptr;
+    }
+
+    const Symbol id = readSymbol();
+    const Symbol typeName = readSymbol();
+    auto initExpr = readOptional(header);
+    return AttributeNode::MakeAttributeNode(id, typeName, initExpr, header.loc,
+                                            arena_);
+  }
+
+  GenericAttributeNodePtr readMethod() {
+    NodeHeader header;
+    if (!readHeader(NodeKind::Method, &header)) {
+      return nullptr;
+    }
+
+    const Symbol id = readSymbol();
+    const Symbol returnTypeName = readSymbol();
+    std::vector<FormalNodePtr> arguments;
+    const uint32_t argumentsCount = readCount();
+    for (uint32_t i = 0; i < argumentsCount && ok_; ++i) {
+      arguments.push_back(readFormal());
+    }
+    auto body = readOptional(header);
+    return MethodNode::MakeMethodNode(id, returnTypeName, std::move(arguments),
+                                      body, header.loc, arena_);
+  }
+
+  FormalNodePtr readFormal() {
+    NodeHeader header;
+    if (!readHeader(NodeKind::Formal, &header)) {
+      return nullptr;
+    }
+
+    const Symbol id = readSymbol();
+    const Symbol typeName = readSymbol();
+    return FormalNode::MakeFormalNode(id, typeName, header.loc, arena_);
+  }
+
+  CaseBindingNodePtr readCaseBinding() {
+    NodeHeader header;
+    if (!readHeader(NodeKind::CaseBinding, &header)) {
+      return nullptr;
+    }
+
+    const Symbol id = readSymbol();
+    const Symbol typeName = readSymbol();
+    auto expr = readExpr();
+    return CaseBindingNode::MakeCaseBindingNode(id, typeName, expr, header.loc,
+                                                arena_);
+  }
+
+  LetBindingNodePtr readLetBinding() {
+    NodeHeader header;
+    if (!readHeader(NodeKind::LetBinding, &header)) {
+      return nullptr;
+    }
+
+    const Symbol id = readSymbol();
+    const Symbol typeName = readSymbol();
+    auto expr = readOptional(header);
+    return LetBindingNode::MakeLetBindingNode(id, typeName, expr, header.loc,
+                                              arena_);
+  }
+
+  ExprNodePtr readOptional(const NodeHeader &header) {
+    return (header.flags & HAS_EXPR) ? readExpr() : nullptr;
+  }
+
+  std::vector<ExprNodePtr> readExprs() {
+    std::vector<ExprNodePtr> exprs;
+    const uint32_t count = readCount();
+    for (uint32_t i = 0; i < count && ok_; ++i) {
+      exprs.push_back(readExpr());
+    }
+    return exprs;
+  }
+
+  ExprNodePtr readExpr() {
+    NodeHeader header;
+    if (!readHeader(&header)) {
+      return nullptr;
+    }
+
+    /// Expression types index the class tables during code generation
+    if (header.typeID < 0 ||
+        static_cast<uint32_t>(header.typeID) >= classIDsCount_) {
+      ok_ = false;
+      return nullptr;
+    }
+
+    ExprNodePtr node = nullptr;
+    const uint32_t loc = header.loc;
+    switch (static_cast<NodeKind>(header.kind)) {
+    case NodeKind::AssignmentExpr: {
+      const Symbol id = readSymbol();
+      auto rhsExpr = readExpr();
+      node = AssignmentExprNode::MakeAssignmentExprNode(id, rhsExpr, loc,
+                                                        arena_);
+      break;
+    }
+    case NodeKind::ArithmeticExpr: {
+      const uint32_t opID = readWord();
+      auto lhsExpr = readExpr();
+      auto rhsExpr = readExpr();
+      ok_ &= opID <= static_cast<uint32_t>(ArithmeticOpID::Div);
+      node = BinaryExprNode<ArithmeticOpID>::MakeBinaryExprNode(
+          lhsExpr, rhsExpr, static_cast<ArithmeticOpID>(opID), loc, arena_);
+      break;
+    }
+    case NodeKind::ComparisonExpr: {
+      const uint32_t opID = readWord();
+      auto lhsExpr = readExpr();
+      auto rhsExpr = readExpr();
+      ok_ &= opID <= static_cast<uint32_t>(ComparisonOpID::Equal);
+      node = BinaryExprNode<ComparisonOpID>::MakeBinaryExprNode(
+          lhsExpr, rhsExpr, static_cast<ComparisonOpID>(opID), loc, arena_);
+      break;
+    }
+    case NodeKind::BlockExpr: {
+      auto exprs = readExprs();
+      node = BlockExprNode::MakeBlockExprNode(std::move(exprs), loc, arena_);
+      break;
+    }
+    case NodeKind::BooleanExpr: {
+      const bool value = header.flags & TRUE_VALUE;
+      node = BooleanExprNode::MakeBooleanExprNode(value, loc, arena_);
+      break;
+    }
+    case NodeKind::CaseExpr: {
+      auto expr = readExpr();
+      std::vector<CaseBindingNodePtr> cases;
+      const uint32_t count = readCount();
+      for (uint32_t i = 0; i < count && ok_; ++i) {
+        cases.push_back(readCaseBinding());
+      }
+      node = CaseExprNode::MakeCaseExprNode(std::move(cases), expr, loc,
+                                            arena_);
+      break;
+    }
+    case NodeKind::DispatchExpr: {
+      const Symbol methodName = readSymbol();
+      auto expr = readOptional(header);
+      auto params = readExprs();
+      node = DispatchExprNode::MakeDispatchExprNode(
+          methodName, expr, std::move(params), loc, arena_);
+      break;
+    }
+    case NodeKind::IdExpr: {
+      const Symbol id = readSymbol();
+      node = IdExprNode::MakeIdExprNode(id, loc, arena_);
+      break;
+    }
+    case NodeKind::IfExpr: {
+      auto ifExpr = readExpr();
+      auto thenExpr = readExpr();
+      auto elseExpr = readExpr();
+      node = IfExprNode::MakeIfExprNode(ifExpr, thenExpr, elseExpr, loc,
+                                        arena_);
+      break;
+    }
+    case NodeKind::LetExpr: {
+      std::vector<LetBindingNodePtr> bindings;
+      const uint32_t count = readCount();
+      for (uint32_t i = 0; i < count && ok_; ++i) {
+        bindings.push_back(readLetBinding());
+      }
+      auto expr = readExpr();
+      node = LetExprNode::MakeLetExprNode(std::move(bindings), expr, loc,
+                                          arena_);
+      break;
+    }
+    case NodeKind::IntLiteralExpr: {
+      const int32_t value = static_cast<int32_t>(readWord());
+      node = LiteralExprNode<int32_t>::MakeLiteralExprNode(value, loc, arena_);
+      break;
+    }
+    case NodeKind::StringLiteralExpr: {
+      const std::string &value = readLiteral();
+      node = LiteralExprNode<std::string>::MakeLiteralExprNode(value, loc,
+                                                               arena_);
+      break;
+    }
+    case NodeKind::NewExpr: {
+      const Symbol typeName = readSymbol();
+      node = NewExprNode::MakeNewExprNode(typeName, loc, arena_);
+      break;
+    }
+    case NodeKind::StaticDispatchExpr: {
+      const Symbol methodName = readSymbol();
+      const Symbol callerClass = readSymbol();
+      auto expr = readExpr();
+      auto params = readExprs();
+      node = StaticDispatchExprNode::MakeStaticDispatchExprNode(
+          methodName, callerClass, expr, std::move(params), loc, arena_);
+      break;
+    }
+    case NodeKind::UnaryExpr: {
+      const uint32_t opID = readWord();
+      auto expr = readExpr();
+      ok_ &= opID <= static_cast<uint32_t>(UnaryOpID::Complement);
+      node = UnaryExprNode::MakeUnaryExprNode(
+          expr, static_cast<UnaryOpID>(opID), loc, arena_);
+      break;
+    }
+    case NodeKind::WhileExpr: {
+      auto loopCond = readExpr();
+      auto loopBody = readExpr();
+      node = WhileExprNode::MakeWhileExprNode(loopCond, loopBody, loc, arena_);
+      break;
+    }
+    default:
+      ok_ = false;
+      return nullptr;
+    }
+
+    node->setType(ExprType{header.typeID, (header.flags & IS_SELF) != 0});
+    return node;
+  }
+
+  const char *cursor_;
+  const char *end_;
+  NodeArena *arena_;
+  uint32_t classIDsCount_ = 0;
+  bool ok_ = true;
+
+  std::vector<Symbol> symbols_;
+  std::vector<std::string> literals_;
+};
+
+} // namespace
+
+Status AstCache::Write(const ProgramNode &program,
+                       const ClassRegistry &registry, std::ostream *ios) {
+  /// Serialize the nodes and collect the identifiers and the string literals
+  Writer writer;
+  writer.dispatch(const_cast<ProgramNode *>(&program));
+
+  /// Class names, in the order of their IDs
+  std::string classNames;
+  const size_t classNamesCount = registry.size();
+  for (size_t i = 0; i < classNamesCount; ++i) {
+    const auto classID = static_cast<IdentifierType>(i);
+    if (!registry.hasClass(classID)) {
+      return GenericError("Error: class registry has undefined classes");
+    }
+    AppendValue(writer.symbolIndex(registry.className(classID)), &classNames);
+  }
+
+  /// Line starts of the program texts
+  std::string sources;
+  std::vector<SourceLines> lines;
+  if (program.sourceManager()) {
+    lines = program.sourceManager()->lines();
+  }
+  for (const auto &sourceLines : lines) {
+    AppendValue(sourceLines.length, &sources);
+    AppendValue(static_cast<uint32_t>(sourceLines.lineStarts.size()),
+                &sources);
+    for (auto lineStart : sourceLines.lineStarts) {
+      AppendValue(lineStart, &sources);
+    }
+  }
+
+  /// Assemble the header
+  const uint32_t fileName = writer.literalIndex(program.fileName());
+  size_t classesCount = 0;
+  for (const auto &classNode : program.classes()) {
+    classesCount += classNode->builtIn() ? 0 : 1;
+  }
+
+  CacheHeader header{MAGIC,
+                     VERSION,
+                     static_cast<uint32_t>(writer.symbols().size()),
+                     static_cast<uint32_t>(writer.literals().size()),
+                     static_cast<uint32_t>(lines.size()),
+                     static_cast<uint32_t>(classNamesCount),
+                     static_cast<uint32_t>(classesCount),
+                     fileName};
+
+  /// Write the header, the tables and the nodes
+  std::string tables;
+  AppendValue(header, &tables);
+  for (const auto &symbol : writer.symbols()) {
+    AppendString(symbol.str(), &tables);
+  }
+  for (const auto &literal : writer.literals()) {
+    AppendString(literal, &tables);
+  }
+
+  ios->write(tables.data(), tables.size());
+  ios->write(sources.data(), sources.size());
+  ios->write(classNames.data(), classNames.size());
+  ios->write(writer.nodes().data(), writer.nodes().size());
+  if (!ios->good()) {
+    return GenericError("Error: AST cache could not be written");
+  }
+  return Status::Ok();
+}
+
+ProgramNodePtr AstCache::Read(const char *data, const size_t length,
+                              std::vector<Symbol> *classNames) {
+  auto arena = std::make_shared<NodeArena>();
+  Reader reader(data, length, arena.get());
+
+  /// Check the header
+  CacheHeader header;
+  if (length < sizeof(CacheHeader)) {
+    return nullptr;
+  }
+  memcpy(&header, data, sizeof(CacheHeader));
+  if (header.magic != MAGIC || header.version != VERSION) {
+    return nullptr;
+  }
+  for (size_t i = 0; i < sizeof(CacheHeader) / sizeof(uint32_t); ++i) {
+    reader.readWord();
+  }
+
+  /// Read the identifiers and the string literals
+  reader.readTables(header.symbolsCount, header.literalsCount);
+
+  /// Read the line starts of the program texts
+  auto sourceManager = std::make_shared<SourceManager>();
+  for (uint32_t i = 0; i < header.sourcesCount && reader.ok(); ++i) {
+    SourceLines sourceLines;
+    sourceLines.length = reader.readWord();
+    const uint32_t linesCount = reader.readWord();
+    for (uint32_t j = 0; j < linesCount && reader.ok(); ++j) {
+      sourceLines.lineStarts.push_back(reader.readWord());
+    }
+
+    /// Line starts must be sorted and within the text
+    const auto &lineStarts = sourceLines.lineStarts;
+    if (!reader.ok() || lineStarts.empty() || lineStarts.front() != 0 ||
+        !std::is_sorted(lineStarts.begin(), lineStarts.end()) ||
+        lineStarts.back() > sourceLines.length) {
+      return nullptr;
+    }
+    sourceManager->addLines(std::move(sourceLines));
+  }
+
+  /// Read the class names
+  reader.setClassIDsCount(header.classNamesCount);
+  classNames->clear();
+  for (uint32_t i = 0; i < header.classNamesCount && reader.ok(); ++i) {
+    classNames->push_back(reader.readSymbol());
+  }
+
+  /// Read the classes
+  auto classes = ProgramNode::BuiltInClasses();
+  for (uint32_t i = 0; i < header.classesCount && reader.ok(); ++i) {
+    classes.push_back(reader.readClass());
+  }
+  const std::string fileName = reader.literal(header.fileName);
+
+  if (!reader.ok() || !reader.atEnd()) {
+    return nullptr;
+  }
+
+  auto program = ProgramNode::MakeProgramNode(std::move(classes), arena);
+  program->setFileName(fileName);
+  program->setSourceManager(sourceManager);
+  return program;
+}
+
+ProgramNodePtr AstCache::ReadFile(const std::string &filePath,
+                                  std::vector<Symbol> *classNames) {
+  const int fd = open(filePath.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+    close(fd);
+    return nullptr;
+  }
+
+  const size_t length = fileStat.st_size;
+  void *data = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return nullptr;
+  }
+
+  auto program = Read(static_cast<const char *>(data), length, classNames);
+  munmap(data, length);
+  return program;
+}
+
+} // namespace cool
@@ -1,8 +1,10 @@
 #include <cool/analysis/pass.h>
 #include <cool/ir/class.h>
 #include <cool/ir/expr.h>
+#include <cool/ir/node_arena.h>
 
 #include <algorithm>
+#include <cassert>
 #include <queue>
 #include <string>
 #include <unordered_map>
@@ -10,19 +12,137 @@
 namespace cool {
 
 /// ProgramNode
-ProgramNode::ProgramNode(std::vector<ClassNodePtr> classes)
-    : ParentNode(0, 0), classes_(std::move(classes)) {}
+ProgramNode::ProgramNode(std::vector<ClassNodePtr> classes,
+                         std::vector<std::shared_ptr<NodeArena>> arenas)
+    : ParentNode(0), arenas_(std::move(arenas)),
+      classes_(std::move(classes)) {}
 
-ProgramNodePtr ProgramNode::MakeProgramNode(std::vector<ClassNodePtr> classes) {
-  return ProgramNodePtr(new ProgramNode(std::move(classes)));
+ProgramNodePtr
+ProgramNode::MakeProgramNode(std::vector<ClassNodePtr> classes,
+                             std::shared_ptr<NodeArena> arena) {
+  std::vector<std::shared_ptr<NodeArena>> arenas;
+  if (arena) {
+    arenas.push_back(std::move(arena));
+  }
+  return ProgramNodePtr(new ProgramNode(std::move(classes), std::move(arenas)));
+}
+
+ProgramNodePtr ProgramNode::MakeMergedProgramNode(
+    const std::vector<ProgramNodePtr> &programs) {
+  assert(!programs.empty());
+  std::vector<ClassNodePtr> classes = BuiltInClasses();
+  std::vector<std::shared_ptr<NodeArena>> arenas;
+
+  /// Built-in classes are installed once, even if no program has them
+  for (const auto &programNode : programs) {
+    for (const auto &classNode : programNode->classes()) {
+      if (!classNode->builtIn()) {
+        classes.push_back(classNode);
+      }
+    }
+    arenas.insert(arenas.end(), programNode->arenas_.begin(),
+                  programNode->arenas_.end());
+  }
+
+  auto program =
+      ProgramNodePtr(new ProgramNode(std::move(classes), std::move(arenas)));
+  program->setFileName(programs.front()->fileName());
+  program->setSourceManager(programs.front()->sourceManager());
+  return program;
+}
+
+const std::vector<ClassNodePtr> &ProgramNode::BuiltInClasses() {
+  static const std::vector<ClassNodePtr> builtInClasses = []() {
+    std::vector<ClassNodePtr> classes;
+
+    /// Install Object class
+    {
+      std::vector<FormalNodePtr> emptyArgs;
+      std::vector<GenericAttributeNodePtr> attrs;
+      attrs.push_back(MethodNode::MakeMethodNode("abort", "Object", emptyArgs,
+                                                 nullptr, 0));
+      attrs.push_back(MethodNode::MakeMethodNode("copy", "SELF_TYPE", emptyArgs,
+                                                 nullptr, 0));
+      attrs.push_back(MethodNode::MakeMethodNode("type_name", "String",
+                                                 emptyArgs, nullptr, 0));
+      classes.push_back(ClassNode::MakeClassNode("Object", "", attrs, true, 0));
+    }
+
+    /// Install Int and Bool classes
+    {
+      std::vector<GenericAttributeNodePtr> emptyAttrs;
+      classes.push_back(
+          ClassNode::MakeClassNode("Int", "Object", emptyAttrs, true, 0));
+      classes.push_back(
+          ClassNode::MakeClassNode("Bool", "Object", emptyAttrs, true, 0));
+    }
+
+    /// Install IO class
+    {
+      std::vector<FormalNodePtr> args;
+      std::vector<GenericAttributeNodePtr> attrs;
+
+      /// Methods with no arguments first
+      attrs.push_back(
+          MethodNode::MakeMethodNode("in_string", "String", args, nullptr, 0));
+      attrs.push_back(
+          MethodNode::MakeMethodNode("in_int", "Int", args, nullptr, 0));
+
+      /// Remaining methods
+      args.push_back(FormalNode::MakeFormalNode("x", "String", 0));
+      attrs.push_back(MethodNode::MakeMethodNode("out_string", "SELF_TYPE",
+                                                 args, nullptr, 0));
+
+      args.pop_back();
+      args.push_back(FormalNode::MakeFormalNode("x", "Int", 0));
+      attrs.push_back(MethodNode::MakeMethodNode("out_int", "SELF_TYPE", args,
+                                                 nullptr, 0));
+
+      /// Install class
+      classes.push_back(
+          ClassNode::MakeClassNode("IO", "Object", attrs, true, 0));
+    }
+
+    /// Install String class
+    {
+      std::vector<FormalNodePtr> args;
+      std::vector<GenericAttributeNodePtr> attrs;
+
+      /// Length argument
+      attrs.push_back(
+          AttributeNode::MakeAttributeNode("len", "Int", nullptr, 0));
+
+      /// Method with no arguments first
+      attrs.push_back(
+          MethodNode::MakeMethodNode("length", "Int", args, nullptr, 0));
+
+      /// Remaining methods
+      args.push_back(FormalNode::MakeFormalNode("s", "String", 0));
+      attrs.push_back(
+          MethodNode::MakeMethodNode("concat", "String", args, nullptr, 0));
+
+      args.pop_back();
+      args.push_back(FormalNode::MakeFormalNode("i", "Int", 0));
+      args.push_back(FormalNode::MakeFormalNode("l", "Int", 0));
+      attrs.push_back(
+          MethodNode::MakeMethodNode("substr", "String", args, nullptr, 0));
+
+      /// Install class
+      classes.push_back(
+          ClassNode::MakeClassNode("String", "Object", attrs, true, 0));
+    }
+
+    return classes;
+  }();
+  return builtInClasses;
 }
 
 Status ProgramNode::sortClasses() {
   std::unordered_map<ClassNodePtr, uint32_t> classOrder;
-  std::unordered_map<std::string, std::vector<ClassNodePtr>> edges;
+  std::unordered_map<Symbol, std::vector<ClassNodePtr>> edges;
 
   /// Construct adjacency list representation of class tree
-  for (auto classNode : classes_) {
+  for (const auto &classNode : classes_) {
     if (classNode->hasParentClass()) {
       classOrder[classNode] += 1;
       edges[classNode->parentClassName()].push_back(classNode);
@@ -31,7 +151,7 @@ Status ProgramNode::sortClasses() {
 
   /// Initialize nodes with no parent
   std::queue<ClassNodePtr> frontier;
-  for (auto classNode : classes_) {
+  for (const auto &classNode : classes_) {
     if (!classOrder.count(classNode)) {
       frontier.push(classNode);
     }
@@ -45,7 +165,7 @@ Status ProgramNode::sortClasses() {
 
     sortedClasses.push_back(rootClass);
     if (edges.count(rootClass->className())) {
-      for (auto childClass : edges[rootClass->className()]) {
+      for (const auto &childClass : edges[rootClass->className()]) {
         classOrder[childClass] -= 1;
         if (classOrder[childClass] == 0) {
           frontier.push(childClass);
@@ -65,23 +185,22 @@ Status ProgramNode::sortClasses() {
 }
 
 /// ClassNode
-ClassNode::ClassNode(const std::string &className,
-                     const std::string &parentClassName,
+ClassNode::ClassNode(const Symbol &className, const Symbol &parentClassName,
                      std::vector<AttributeNodePtr> attributes,
                      std::vector<MethodNodePtr> methods, const bool builtIn,
-                     const uint32_t lloc, const uint32_t cloc)
-    : ParentNode(lloc, cloc), builtIn_(builtIn), className_(className),
+                     const uint32_t loc)
+    : ParentNode(loc), builtIn_(builtIn), className_(className),
       parentClassName_(parentClassName), attributes_(std::move(attributes)),
       methods_(std::move(methods)) {}
 
 ClassNodePtr ClassNode::MakeClassNode(
-    const std::string &className, const std::string &parentClassName,
+    const Symbol &className, const Symbol &parentClassName,
     std::vector<GenericAttributeNodePtr> genericAttributes, const bool builtIn,
-    const uint32_t lloc, const uint32_t cloc) {
+    const uint32_t loc, NodeArena *arena) {
   /// Separate class methods from class attributes
   std::vector<AttributeNodePtr> attributes;
   std::vector<MethodNodePtr> methods;
-  for (auto genericAttribute : genericAttributes) {
+  for (const auto &genericAttribute : genericAttributes) {
     if (std::dynamic_pointer_cast<AttributeNode>(genericAttribute)) {
       attributes.push_back(
           std::dynamic_pointer_cast<AttributeNode>(genericAttribute));
@@ -92,53 +211,85 @@ ClassNodePtr ClassNode::MakeClassNode(
   }
 
   /// Construct the class node
-  return ClassNodePtr(new ClassNode(className, parentClassName,
+  return NodeArena::Make<ClassNode>(arena, className, parentClassName,
                                     std::move(attributes), std::move(methods),
-                                    builtIn, lloc, cloc));
+                                    builtIn, loc);
+}
+
+ClassNodePtr ClassNode::MakeSignatureNode(const ClassNode &node) {
+  std::vector<GenericAttributeNodePtr> genericAttributes;
+  for (const auto &attributeNode : node.attributes()) {
+    genericAttributes.push_back(AttributeNode::MakeAttributeNode(
+        attributeNode->id(), attributeNode->typeName(), nullptr,
+        attributeNode->loc()));
+  }
+
+  for (const auto &methodNode : node.methods()) {
+    std::vector<FormalNodePtr> arguments;
+    for (const auto &argument : methodNode->arguments()) {
+      arguments.push_back(FormalNode::MakeFormalNode(
+          argument->id(), argument->typeName(), argument->loc()));
+    }
+    genericAttributes.push_back(MethodNode::MakeMethodNode(
+        methodNode->id(), methodNode->returnTypeName(), std::move(arguments),
+        nullptr, methodNode->loc()));
+  }
+
+  return MakeClassNode(node.className(), node.parentClassName(),
+                       std::move(genericAttributes), node.builtIn(),
+                       node.loc());
+}
+
+void ClassNode::releaseExprs() {
+  assert(!builtIn_);
+  for (const auto &attributeNode : attributes_) {
+    attributeNode->releaseInitExpr();
+  }
+
+  for (const auto &methodNode : methods_) {
+    methodNode->releaseBody();
+  }
 }
 
 /// AttributeNode
-AttributeNode::AttributeNode(const std::string &id, const std::string &typeName,
-                             ExprNodePtr initExpr, const uint32_t lloc,
-                             const uint32_t cloc)
-    : ParentNode(lloc, cloc), id_(id), typeName_(typeName),
+AttributeNode::AttributeNode(const Symbol &id, const Symbol &typeName,
+                             ExprNodePtr initExpr, const uint32_t loc)
+    : ParentNode(loc), id_(id), typeName_(typeName),
       initExpr_(initExpr) {}
 
-AttributeNodePtr AttributeNode::MakeAttributeNode(const std::string &id,
-                                                  const std::string &typeName,
+AttributeNodePtr AttributeNode::MakeAttributeNode(const Symbol &id,
+                                                  const Symbol &typeName,
                                                   ExprNodePtr initExpr,
-                                                  const uint32_t lloc,
-                                                  const uint32_t cloc) {
-  return AttributeNodePtr(
-      new AttributeNode(id, typeName, initExpr, lloc, cloc));
+                                                  const uint32_t loc,
+                                                  NodeArena *arena) {
+  return NodeArena::Make<AttributeNode>(arena, id, typeName, initExpr, loc);
 }
 
 /// MethodNode
-MethodNode::MethodNode(const std::string &id, const std::string &returnTypeName,
+MethodNode::MethodNode(const Symbol &id, const Symbol &returnTypeName,
                        std::vector<FormalNodePtr> arguments, ExprNodePtr body,
-                       const uint32_t lloc, const uint32_t cloc)
-    : ParentNode(lloc, cloc), id_(id), returnTypeName_(returnTypeName),
+                       const uint32_t loc)
+    : ParentNode(loc), id_(id), returnTypeName_(returnTypeName),
       arguments_(std::move(arguments)), body_(body) {}
 
-MethodNodePtr MethodNode::MakeMethodNode(const std::string &id,
-                                         const std::string &returnTypeName,
+MethodNodePtr MethodNode::MakeMethodNode(const Symbol &id,
+                                         const Symbol &returnTypeName,
                                          std::vector<FormalNodePtr> arguments,
-                                         ExprNodePtr body, const uint32_t lloc,
-                                         const uint32_t cloc) {
-  return MethodNodePtr(new MethodNode(id, returnTypeName, std::move(arguments),
-                                      body, lloc, cloc));
+                                         ExprNodePtr body, const uint32_t loc,
+                                         NodeArena *arena) {
+  return NodeArena::Make<MethodNode>(arena, id, returnTypeName,
+                                     std::move(arguments), body, loc);
 }
 
 /// FormalNode
-FormalNode::FormalNode(const std::string &id, const std::string &typeName,
-                       const uint32_t lloc, const uint32_t cloc)
-    : ParentNode(lloc, cloc), id_(id), typeName_(typeName) {}
-
-FormalNodePtr FormalNode::MakeFormalNode(const std::string &id,
-                                         const std::string &typeName,
-                                         const uint32_t lloc,
-                                         const uint32_t cloc) {
-  return FormalNodePtr(new FormalNode(id, typeName, lloc, cloc));
+FormalNode::FormalNode(const Symbol &id, const Symbol &typeName,
+                       const uint32_t loc)
+    : ParentNode(loc), id_(id), typeName_(typeName) {}
+
+FormalNodePtr FormalNode::MakeFormalNode(const Symbol &id,
+                                         const Symbol &typeName,
+                                         const uint32_t loc, NodeArena *arena) {
+  return NodeArena::Make<FormalNode>(arena, id, typeName, loc);
 }
 
 } // namespace cool
@@ -0,0 +1,46 @@
+#include <cool/ir/node_arena.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace cool {
+
+constexpr size_t NodeArena::BLOCK_SIZE;
+
+NodeArena::~NodeArena() {
+  /// Destroy nodes in reverse order of creation. Memory is released with the
+  /// blocks
+  for (auto it = nodes_.rbegin(); it != nodes_.rend(); ++it) {
+    (*it)->~Node();
+  }
+}
+
+void *NodeArena::allocate(const size_t size, const size_t alignment) {
+  assert((alignment & (alignment - 1)) == 0);
+
+  /// Align the current pointer
+  const auto address = reinterpret_cast<uintptr_t>(current_);
+  const auto padding = (alignment - address % alignment) % alignment;
+
+  /// Reserve a new block if the current one is too small. Nodes larger than
+  /// a block get a block of their own
+  if (current_ == nullptr ||
+      static_cast<size_t>(end_ - current_) < padding + size) {
+    const size_t blockSize = std::max(BLOCK_SIZE, size + alignment);
+    blocks_.emplace_back(new char[blockSize]);
+    bytesReserved_ += blockSize;
+
+    current_ = blocks_.back().get();
+    end_ = current_ + blockSize;
+    return allocate(size, alignment);
+  }
+
+  /// Bump the current pointer
+  void *memory = current_ + padding;
+  current_ += padding + size;
+  bytesUsed_ += size;
+  return memory;
+}
+
+} // namespace cool
@@ -0,0 +1,128 @@
+#include <cool/ir/symbol.h>
+
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace cool {
+
+/// Class that implements the global identifier interner. Identifiers are
+/// stored in a deque so that entries never move, and indexed by an
+/// open-addressing hash table of pointers to the entries
+class SymbolInterner {
+
+public:
+  using Entry = Symbol::Entry;
+
+  /// Return the global interner
+  ///
+  /// \return a reference to the global interner
+  static SymbolInterner &Get() {
+    static SymbolInterner interner;
+    return interner;
+  }
+
+  /// Find the entry for an identifier, creating it if needed
+  ///
+  /// \param[in] name pointer to the first character of the identifier
+  /// \param[in] length identifier length
+  /// \return a pointer to the interned entry
+  const Entry *intern(const char *name, const size_t length) {
+    const size_t hash = Hash(name, length);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t mask = buckets_.size() - 1;
+    size_t bucket = hash & mask;
+    while (buckets_[bucket]) {
+      const auto *entry = buckets_[bucket];
+      if (entry->hash == hash && entry->name.length() == length &&
+          std::memcmp(entry->name.data(), name, length) == 0) {
+        return entry;
+      }
+      bucket = (bucket + 1) & mask;
+    }
+
+    /// Identifier not found, create a new entry
+    const uint32_t id = entries_.size();
+    entries_.push_back(Entry{std::string(name, length), id, hash});
+    buckets_[bucket] = &entries_.back();
+    if (2 * entries_.size() > buckets_.size()) {
+      grow();
+    }
+    return &entries_.back();
+  }
+
+  /// Return the entry for the empty identifier
+  ///
+  /// \return a pointer to the entry for the empty identifier
+  const Entry *empty() const { return empty_; }
+
+  /// Return the number of interned identifiers
+  ///
+  /// \return the number of interned identifiers
+  size_t size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+private:
+  SymbolInterner() : buckets_(INITIAL_BUCKETS, nullptr) {
+    empty_ = intern("", 0);
+  }
+
+  /// FNV-1a hash of an identifier
+  ///
+  /// \param[in] name pointer to the first character of the identifier
+  /// \param[in] length identifier length
+  /// \return the identifier hash
+  static size_t Hash(const char *name, const size_t length) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; ++i) {
+      hash ^= static_cast<unsigned char>(name[i]);
+      hash *= 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+  }
+
+  /// Double the number of buckets and reinsert the entries
+  void grow() {
+    std::vector<const Entry *> buckets(2 * buckets_.size(), nullptr);
+    const size_t mask = buckets.size() - 1;
+    for (const auto &entry : entries_) {
+      size_t bucket = entry.hash & mask;
+      while (buckets[bucket]) {
+        bucket = (bucket + 1) & mask;
+      }
+      buckets[bucket] = &entry;
+    }
+    buckets_.swap(buckets);
+  }
+
+  static constexpr size_t INITIAL_BUCKETS = 1024;
+
+  std::mutex mutex_;
+  std::deque<Entry> entries_;
+  std::vector<const Entry *> buckets_;
+  const Entry *empty_;
+};
+
+Symbol::Symbol() : entry_(SymbolInterner::Get().empty()) {}
+
+Symbol::Symbol(const std::string &name)
+    : entry_(SymbolInterner::Get().intern(name.data(), name.length())) {}
+
+Symbol::Symbol(const char *name)
+    : entry_(SymbolInterner::Get().intern(name, std::strlen(name))) {}
+
+Symbol::Symbol(const char *name, const size_t length)
+    : entry_(SymbolInterner::Get().intern(name, length)) {}
+
+size_t Symbol::InternedCount() { return SymbolInterner::Get().size(); }
+
+const WellKnownSymbols &WellKnownSymbols::Get() {
+  static const WellKnownSymbols symbols;
+  return symbols;
+}
+
+} // namespace cool
@@ -0,0 +1,167 @@
+#include <cool/analysis/analysis_session.h>
+#include <cool/core/class_registry.h>
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace cool {
+
+namespace {
+
+/// Parameters of a version of the test program
+struct Version {
+  int32_t value = 1;
+  std::string valueType = "Int";
+  std::string parentC = "Object";
+  bool typeError = false;
+  uint32_t loc = 0;
+};
+
+/// \brief Helper function to create a version of the program:
+///
+/// class A { value() : <valueType> { <value> }; };
+/// class B inherits IO { greet() : Object { out_string("hi") }; };
+/// class C inherits <parentC> {};
+/// class Main { a : A <- new A; main() : Object { a.value() }; };
+///
+/// B passes an integer to out_string if a type error is requested. All nodes
+/// are located at the given location
+///
+/// \param[in] version parameters of the version
+/// \return a shared pointer to the program node
+ProgramNodePtr MakeProgram(const Version &version) {
+  const uint32_t loc = version.loc;
+  std::vector<FormalNodePtr> noArgs;
+
+  std::vector<GenericAttributeNodePtr> attributesA;
+  attributesA.push_back(MethodNode::MakeMethodNode(
+      "value", version.valueType, noArgs,
+      LiteralExprNode<int32_t>::MakeLiteralExprNode(version.value, loc), loc));
+
+  ExprNodePtr greeting =
+      LiteralExprNode<std::string>::MakeLiteralExprNode("hi", loc);
+  if (version.typeError) {
+    greeting = LiteralExprNode<int32_t>::MakeLiteralExprNode(1, loc);
+  }
+  std::vector<GenericAttributeNodePtr> attributesB;
+  attributesB.push_back(MethodNode::MakeMethodNode(
+      "greet", "Object", noArgs,
+      DispatchExprNode::MakeDispatchExprNode("out_string", nullptr,
+                                             {greeting}, loc),
+      loc));
+
+  std::vector<GenericAttributeNodePtr> attributesMain;
+  attributesMain.push_back(AttributeNode::MakeAttributeNode(
+      "a", "A", NewExprNode::MakeNewExprNode("A", loc), loc));
+  attributesMain.push_back(MethodNode::MakeMethodNode(
+      "main", "Object", noArgs,
+      DispatchExprNode::MakeDispatchExprNode(
+          "value", IdExprNode::MakeIdExprNode("a", loc), {}, loc),
+      loc));
+
+  auto classes = ProgramNode::BuiltInClasses();
+  classes.push_back(
+      ClassNode::MakeClassNode("A", "Object", attributesA, false, loc));
+  classes.push_back(
+      ClassNode::MakeClassNode("B", "IO", attributesB, false, loc));
+  classes.push_back(
+      ClassNode::MakeClassNode("C", version.parentC, {}, false, loc));
+  classes.push_back(
+      ClassNode::MakeClassNode("Main", "Object", attributesMain, false, loc));
+  return ProgramNode::MakeProgramNode(classes);
+}
+
+/// \brief Helper function to return the body of the main method
+///
+/// \param[in] program program node
+/// \return a pointer to the body of the main method
+ExprNode *MainBody(const ProgramNode &program) {
+  for (const auto &classNode : program.classes()) {
+    if (classNode->className() == "Main") {
+      return classNode->methods().back()->body();
+    }
+  }
+  return nullptr;
+}
+
+/// \brief Helper function to return the names of the classes type-checked by
+/// the last analysis, sorted
+///
+/// \param[in] session analysis session
+/// \return the sorted class names
+std::vector<std::string> CheckedClasses(const AnalysisSession &session) {
+  std::vector<std::string> classNames;
+  for (const auto &className : session.checkedClasses()) {
+    classNames.push_back(className.str());
+  }
+  std::sort(classNames.begin(), classNames.end());
+  return classNames;
+}
+
+} // namespace
+
+TEST(AnalysisSession, ReanalyzesChangedClasses) {
+  AnalysisSession session(nullptr);
+  Version version;
+
+  /// All classes are type-checked the first time
+  ASSERT_TRUE(session.analyze(MakeProgram(version)).isOk());
+  ASSERT_EQ(CheckedClasses(session),
+            std::vector<std::string>({"A", "B", "C", "Main"}));
+
+  /// Unchanged classes are not type-checked again, even if their locations
+  /// moved, and their expression types are restored
+  version.loc = 10;
+  auto program = MakeProgram(version);
+  ASSERT_TRUE(session.analyze(program).isOk());
+  ASSERT_TRUE(session.checkedClasses().empty());
+  ASSERT_EQ(MainBody(*program)->type().typeID,
+            session.classRegistry()->typeID("Int"));
+
+  /// A changed body only affects its class
+  version.value = 2;
+  ASSERT_TRUE(session.analyze(MakeProgram(version)).isOk());
+  ASSERT_EQ(CheckedClasses(session), std::vector<std::string>({"A"}));
+
+  /// A changed signature affects the classes that dispatch to it
+  version.valueType = "Object";
+  program = MakeProgram(version);
+  ASSERT_TRUE(session.analyze(program).isOk());
+  ASSERT_EQ(CheckedClasses(session),
+            std::vector<std::string>({"A", "Main"}));
+  ASSERT_EQ(MainBody(*program)->type().typeID,
+            session.classRegistry()->typeID("Object"));
+
+  /// A changed hierarchy affects all classes
+  version.parentC = "A";
+  ASSERT_TRUE(session.analyze(MakeProgram(version)).isOk());
+  ASSERT_EQ(session.checkedClasses().size(), 4);
+}
+
+TEST(AnalysisSession, ReanalyzesClassesWithErrors) {
+  AnalysisSession session(nullptr);
+  Version version;
+  version.typeError = true;
+
+  /// Classes that did not type-check are type-checked again
+  ASSERT_FALSE(session.analyze(MakeProgram(version)).isOk());
+  ASSERT_FALSE(session.analyze(MakeProgram(version)).isOk());
+  ASSERT_EQ(CheckedClasses(session), std::vector<std::string>({"B"}));
+
+  version.typeError = false;
+  ASSERT_TRUE(session.analyze(MakeProgram(version)).isOk());
+  ASSERT_EQ(CheckedClasses(session), std::vector<std::string>({"B"}));
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
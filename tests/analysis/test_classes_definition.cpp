@@ -40,8 +40,7 @@ StringLogger *GetLogger(AnalysisContext *context) {
 ClassNodePtr MakeEmptyClass(const std::string &className,
                             const std::string &parentName) {
   std::vector<GenericAttributeNodePtr> attributes;
-  return ClassNode::MakeClassNode(className, parentName, attributes, false, 0,
-                                  0);
+  return ClassNode::MakeClassNode(className, parentName, attributes, false, 0);
 }
 
 } // namespace
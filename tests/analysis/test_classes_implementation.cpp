@@ -52,12 +52,11 @@ ClassNodePtr MakeClassWithAttributes(
   std::vector<GenericAttributeNodePtr> attributes;
   for (auto &attributeInfo : attributesInfo) {
     attributes.push_back(AttributeNode::MakeAttributeNode(
-        attributeInfo.first, attributeInfo.second, nullptr, 0, 0));
+        attributeInfo.first, attributeInfo.second, nullptr, 0));
   }
 
   /// Create and return the class
-  return ClassNode::MakeClassNode(className, parentName, attributes, false, 0,
-                                  0);
+  return ClassNode::MakeClassNode(className, parentName, attributes, false, 0);
 }
 
 /// Helper function to create a shared pointer to a class with methods
@@ -77,15 +76,15 @@ MakeClassWithMethods(const std::string &className,
   for (size_t i = 0; i < methodsInfo.size(); ++i) {
     std::vector<FormalNodePtr> args;
     for (auto &arg : methodsInfo[i].second) {
-      args.push_back(FormalNode::MakeFormalNode(arg.first, arg.second, 0, 0));
+      args.push_back(FormalNode::MakeFormalNode(arg.first, arg.second, 0));
     }
 
     methods.push_back(MethodNode::MakeMethodNode(
-        methodsInfo[i].first, methodsReturnTypes[i], args, nullptr, 0, 0));
+        methodsInfo[i].first, methodsReturnTypes[i], args, nullptr, 0));
   }
 
   /// Create and return the class
-  return ClassNode::MakeClassNode(className, parentName, methods, false, 0, 0);
+  return ClassNode::MakeClassNode(className, parentName, methods, false, 0);
 }
 
 } // namespace
@@ -0,0 +1,218 @@
+#include <cool/analysis/analysis_context.h>
+#include <cool/analysis/classes_definition.h>
+#include <cool/analysis/classes_implementation.h>
+#include <cool/analysis/name_resolution.h>
+#include <cool/analysis/prelude.h>
+#include <cool/analysis/type_check.h>
+#include <cool/core/class_layout.h>
+#include <cool/core/class_registry.h>
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace cool {
+
+namespace {
+
+/// \brief Helper function to create the test program:
+///
+/// class A {
+///   x : Int <- 1;
+///   y : Int <- let t : Int <- x in t;
+///   get(n : Int) : Int { { x; n; } };
+/// };
+/// class B inherits A {
+///   z : Int;
+///   get(n : Int) : Int {
+///     let u : Int <- n, v : Int <- u in
+///       case self of
+///         s : B => z <- s@A.get(v);
+///         o : Object => let x : Int <- x in x;
+///       esac
+///   };
+/// };
+/// class Main { main() : Object { (new B).get(1) }; };
+///
+/// \return a shared pointer to the program node
+ProgramNodePtr MakeProgram() {
+  auto id = [](const Symbol &name) {
+    return IdExprNode::MakeIdExprNode(name, 0);
+  };
+  auto one = []() {
+    return LiteralExprNode<int32_t>::MakeLiteralExprNode(1, 0);
+  };
+  std::vector<FormalNodePtr> arguments = {
+      FormalNode::MakeFormalNode("n", "Int", 0)};
+
+  std::vector<GenericAttributeNodePtr> attributesA;
+  attributesA.push_back(AttributeNode::MakeAttributeNode("x", "Int", one(), 0));
+  attributesA.push_back(AttributeNode::MakeAttributeNode(
+      "y", "Int",
+      LetExprNode::MakeLetExprNode(
+          {LetBindingNode::MakeLetBindingNode("t", "Int", id("x"), 0)},
+          id("t"), 0),
+      0));
+  attributesA.push_back(MethodNode::MakeMethodNode(
+      "get", "Int", arguments,
+      BlockExprNode::MakeBlockExprNode({id("x"), id("n")}, 0), 0));
+
+  auto staticDispatch = StaticDispatchExprNode::MakeStaticDispatchExprNode(
+      "get", "A", id("s"), {id("v")}, 0);
+  auto shadowingLet = LetExprNode::MakeLetExprNode(
+      {LetBindingNode::MakeLetBindingNode("x", "Int", id("x"), 0)}, id("x"),
+      0);
+  auto caseExpr = CaseExprNode::MakeCaseExprNode(
+      {CaseBindingNode::MakeCaseBindingNode(
+           "s", "B",
+           AssignmentExprNode::MakeAssignmentExprNode("z", staticDispatch, 0),
+           0),
+       CaseBindingNode::MakeCaseBindingNode("o", "Object", shadowingLet, 0)},
+      id("self"), 0);
+
+  std::vector<GenericAttributeNodePtr> attributesB;
+  attributesB.push_back(
+      AttributeNode::MakeAttributeNode("z", "Int", nullptr, 0));
+  attributesB.push_back(MethodNode::MakeMethodNode(
+      "get", "Int", arguments,
+      LetExprNode::MakeLetExprNode(
+          {LetBindingNode::MakeLetBindingNode("u", "Int", id("n"), 0),
+           LetBindingNode::MakeLetBindingNode("v", "Int", id("u"), 0)},
+          caseExpr, 0),
+      0));
+
+  std::vector<GenericAttributeNodePtr> attributesMain;
+  attributesMain.push_back(MethodNode::MakeMethodNode(
+      "main", "Object", {},
+      DispatchExprNode::MakeDispatchExprNode(
+          "get", NewExprNode::MakeNewExprNode("B", 0), {one()}, 0),
+      0));
+
+  auto classes = ProgramNode::BuiltInClasses();
+  classes.push_back(
+      ClassNode::MakeClassNode("A", "Object", attributesA, false, 0));
+  classes.push_back(
+      ClassNode::MakeClassNode("B", "A", attributesB, false, 0));
+  classes.push_back(
+      ClassNode::MakeClassNode("Main", "Object", attributesMain, false, 0));
+  return ProgramNode::MakeProgramNode(classes);
+}
+
+/// \brief Helper function to check a binding
+///
+/// \param[in] binding binding to check
+/// \param[in] kind expected storage kind
+/// \param[in] index expected index
+void ExpectBinding(const Binding &binding, const BindingKind kind,
+                   const int32_t index) {
+  EXPECT_EQ(binding.kind, kind);
+  EXPECT_EQ(binding.index, index);
+}
+
+} // namespace
+
+TEST(NameResolution, AnnotatesNodes) {
+  auto prelude = Prelude::Get();
+  auto registry = prelude->makeClassRegistry();
+  auto context = prelude->makeAnalysisContext(registry, nullptr);
+  auto program = MakeProgram();
+
+  ClassesDefinitionPass definitionPass;
+  ClassesImplementationPass implementationPass;
+  TypeCheckPass typeCheckPass;
+  NameResolutionPass resolutionPass;
+  for (Pass *pass : {static_cast<Pass *>(&definitionPass),
+                     static_cast<Pass *>(&implementationPass),
+                     static_cast<Pass *>(&typeCheckPass),
+                     static_cast<Pass *>(&resolutionPass)}) {
+    ASSERT_TRUE(program->visitNode(context.get(), pass).isOk());
+  }
+
+  const auto *layout = registry->classLayout();
+  const auto typeA = registry->typeID("A");
+  const auto typeB = registry->typeID("B");
+  const int32_t x = layout->attributesBegin(typeA);
+  const int32_t y = x + 1;
+  const int32_t z = layout->attributesBegin(typeB);
+  ASSERT_EQ(z, x + 2);
+
+  /// Attributes and let variables of attribute initializers
+  auto classA = registry->classNode(typeA);
+  ASSERT_EQ(classA->attributes()[0]->position(), x);
+  ASSERT_EQ(classA->attributes()[1]->position(), y);
+
+  auto letY = static_cast<LetExprNode *>(classA->attributes()[1]->initExpr());
+  auto bindingT = letY->bindings()[0].get();
+  ExpectBinding(bindingT->binding(), BindingKind::Local, 0);
+  ExpectBinding(static_cast<IdExprNode *>(bindingT->expr())->binding(),
+                BindingKind::Attribute, x);
+  ExpectBinding(static_cast<IdExprNode *>(letY->expr())->binding(),
+                BindingKind::Local, 0);
+
+  /// Method arguments
+  auto blockA = static_cast<BlockExprNode *>(classA->methods()[0]->body());
+  ExpectBinding(static_cast<IdExprNode *>(blockA->exprs()[0].get())->binding(),
+                BindingKind::Attribute, x);
+  ExpectBinding(static_cast<IdExprNode *>(blockA->exprs()[1].get())->binding(),
+                BindingKind::Argument, 1);
+
+  /// Let and case variables are numbered within their method
+  auto classB = registry->classNode(typeB);
+  ASSERT_EQ(classB->attributes()[0]->position(), z);
+
+  auto letB = static_cast<LetExprNode *>(classB->methods()[0]->body());
+  auto bindingU = letB->bindings()[0].get();
+  auto bindingV = letB->bindings()[1].get();
+  ExpectBinding(bindingU->binding(), BindingKind::Local, 0);
+  ExpectBinding(static_cast<IdExprNode *>(bindingU->expr())->binding(),
+                BindingKind::Argument, 1);
+  ExpectBinding(bindingV->binding(), BindingKind::Local, 1);
+  ExpectBinding(static_cast<IdExprNode *>(bindingV->expr())->binding(),
+                BindingKind::Local, 0);
+
+  auto caseExpr = static_cast<CaseExprNode *>(letB->expr());
+  ExpectBinding(static_cast<IdExprNode *>(caseExpr->expr())->binding(),
+                BindingKind::Self, 0);
+
+  auto caseS = caseExpr->cases()[0].get();
+  ExpectBinding(caseS->binding(), BindingKind::Local, 2);
+  auto assignment = static_cast<AssignmentExprNode *>(caseS->expr());
+  ExpectBinding(assignment->binding(), BindingKind::Attribute, z);
+
+  auto staticDispatch =
+      static_cast<StaticDispatchExprNode *>(assignment->rhsExpr());
+  ASSERT_EQ(staticDispatch->slot(), layout->slot(typeA, "get"));
+  ExpectBinding(static_cast<IdExprNode *>(staticDispatch->expr())->binding(),
+                BindingKind::Local, 2);
+  ExpectBinding(
+      static_cast<IdExprNode *>(staticDispatch->params()[0].get())->binding(),
+      BindingKind::Local, 1);
+
+  /// A let variable shadows an attribute in its body only
+  auto caseO = caseExpr->cases()[1].get();
+  ExpectBinding(caseO->binding(), BindingKind::Local, 3);
+  auto shadowingLet = static_cast<LetExprNode *>(caseO->expr());
+  auto bindingX = shadowingLet->bindings()[0].get();
+  ExpectBinding(bindingX->binding(), BindingKind::Local, 4);
+  ExpectBinding(static_cast<IdExprNode *>(bindingX->expr())->binding(),
+                BindingKind::Attribute, x);
+  ExpectBinding(static_cast<IdExprNode *>(shadowingLet->expr())->binding(),
+                BindingKind::Local, 4);
+
+  /// Dynamic dispatches use the slot of the receiver type
+  auto classMain = registry->classNode("Main");
+  auto dispatch =
+      static_cast<DispatchExprNode *>(classMain->methods()[0]->body());
+  ASSERT_GE(dispatch->slot(), 0);
+  ASSERT_EQ(dispatch->slot(), layout->slot(typeB, "get"));
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
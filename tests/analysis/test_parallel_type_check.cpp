@@ -0,0 +1,150 @@
+#include <cool/analysis/analysis_context.h>
+#include <cool/analysis/classes_definition.h>
+#include <cool/analysis/classes_implementation.h>
+#include <cool/analysis/parallel_type_check.h>
+#include <cool/analysis/prelude.h>
+#include <cool/analysis/type_check.h>
+#include <cool/core/class_registry.h>
+#include <cool/core/logger_collection.h>
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+
+#include <utils/test_utils.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace cool {
+
+namespace {
+
+/// Number of user-defined classes in the test program
+constexpr size_t CLASSES_COUNT = 64;
+
+/// \brief Helper function to create the test program. Class Ci inherits from
+/// Object every fifth class, and from class Ci-1 otherwise:
+///
+/// class Ci inherits <parent> {
+///   m(x : Int) : Int { x + i };
+///   pick() : Object { if true then new Ci else new Cj fi };
+///   badi() : Int { x };      -- every fourth class, x is not defined
+///   wrongi() : String { i }; -- every sixth class, wrong return type
+/// };
+///
+/// \return a shared pointer to the program node
+ProgramNodePtr MakeProgram() {
+  auto classes = ProgramNode::BuiltInClasses();
+  for (size_t i = 0; i < CLASSES_COUNT; ++i) {
+    const uint32_t loc = 10 * i;
+    const auto className = "C" + std::to_string(i);
+    const auto parentName =
+        i % 5 == 0 ? std::string("Object") : "C" + std::to_string(i - 1);
+    const auto otherName = "C" + std::to_string(i * 7 % CLASSES_COUNT);
+
+    std::vector<GenericAttributeNodePtr> methods;
+    methods.push_back(MethodNode::MakeMethodNode(
+        "m", "Int", {FormalNode::MakeFormalNode("x", "Int", loc)},
+        BinaryExprNode<ArithmeticOpID>::MakeBinaryExprNode(
+            IdExprNode::MakeIdExprNode("x", loc),
+            LiteralExprNode<int32_t>::MakeLiteralExprNode(i, loc),
+            ArithmeticOpID::Plus, loc),
+        loc));
+    methods.push_back(MethodNode::MakeMethodNode(
+        "pick", "Object", {},
+        IfExprNode::MakeIfExprNode(
+            BooleanExprNode::MakeBooleanExprNode(true, loc),
+            NewExprNode::MakeNewExprNode(className, loc),
+            NewExprNode::MakeNewExprNode(otherName, loc), loc),
+        loc));
+    if (i % 4 == 1) {
+      methods.push_back(MethodNode::MakeMethodNode(
+          "bad" + std::to_string(i), "Int", {},
+          IdExprNode::MakeIdExprNode("x", loc), loc));
+    }
+    if (i % 6 == 2) {
+      methods.push_back(MethodNode::MakeMethodNode(
+          "wrong" + std::to_string(i), "String", {},
+          LiteralExprNode<int32_t>::MakeLiteralExprNode(i, loc), loc));
+    }
+    classes.push_back(
+        ClassNode::MakeClassNode(className, parentName, methods, false, loc));
+  }
+
+  std::vector<GenericAttributeNodePtr> methodsMain;
+  methodsMain.push_back(MethodNode::MakeMethodNode(
+      "main", "Object", {},
+      LiteralExprNode<int32_t>::MakeLiteralExprNode(0, 0), 0));
+  classes.push_back(
+      ClassNode::MakeClassNode("Main", "Object", methodsMain, false, 0));
+  return ProgramNode::MakeProgramNode(classes);
+}
+
+/// Results of the type-check of the test program
+struct Results {
+  bool isOk = false;
+  std::vector<std::string> messages;
+  std::vector<std::string> pickTypes;
+};
+
+/// \brief Helper function to analyze the test program
+///
+/// \param[in] typeCheckPass type-check pass
+/// \return the results of the type-check
+Results Analyze(Pass *typeCheckPass) {
+  auto program = MakeProgram();
+  auto logger = std::make_shared<LoggerCollection>();
+  auto stringLogger = std::make_shared<StringLogger>();
+  logger->registerLogger("StringLogger", stringLogger);
+
+  auto prelude = Prelude::Get();
+  auto registry = prelude->makeClassRegistry();
+  auto context = prelude->makeAnalysisContext(registry, logger);
+
+  ClassesDefinitionPass definitionPass;
+  ClassesImplementationPass implementationPass;
+  EXPECT_TRUE(definitionPass.visit(context.get(), program.get()).isOk());
+  EXPECT_TRUE(implementationPass.visit(context.get(), program.get()).isOk());
+
+  Results results;
+  results.isOk = typeCheckPass->visit(context.get(), program.get()).isOk();
+  for (size_t i = 0; i < stringLogger->loggedMessageCount(); ++i) {
+    results.messages.push_back(stringLogger->loggedMessage(i).message());
+  }
+  for (const auto &classNode : program->classes()) {
+    if (!classNode->builtIn() && classNode->className() != "Main") {
+      const auto type = classNode->methods()[1]->body()->type();
+      results.pickTypes.push_back(registry->typeName(type));
+    }
+  }
+  return results;
+}
+
+} // namespace
+
+TEST(ParallelTypeCheck, MatchesSerialTypeCheck) {
+  TypeCheckPass typeCheckPass;
+  const auto expected = Analyze(&typeCheckPass);
+  ASSERT_FALSE(expected.isOk);
+
+  /// Method arguments are not visible from the other methods, so that every
+  /// badi and wrongi method is reported
+  ASSERT_EQ(expected.messages.size(), 16 + 11);
+
+  for (size_t threadsCount : {1, 2, 4, 8}) {
+    ParallelTypeCheckPass parallelTypeCheckPass(threadsCount);
+    const auto results = Analyze(&parallelTypeCheckPass);
+    ASSERT_EQ(results.isOk, expected.isOk);
+    ASSERT_EQ(results.messages, expected.messages);
+    ASSERT_EQ(results.pickTypes, expected.pickTypes);
+  }
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
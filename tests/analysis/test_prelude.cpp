@@ -0,0 +1,149 @@
+#include <cool/analysis/analysis_context.h>
+#include <cool/analysis/classes_definition.h>
+#include <cool/analysis/classes_implementation.h>
+#include <cool/analysis/prelude.h>
+#include <cool/analysis/type_check.h>
+#include <cool/core/logger_collection.h>
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+
+#include <utils/test_utils.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace cool;
+
+namespace {
+
+/// Logger name
+const std::string LOGGER_NAME = "StringLogger";
+
+/// Helper function to create a logger collection with a string logger
+std::shared_ptr<LoggerCollection> MakeLogger() {
+  auto logger = std::make_shared<LoggerCollection>();
+  logger->registerLogger(LOGGER_NAME, std::make_shared<StringLogger>());
+  return logger;
+}
+
+/// Helper function to create a program made of the built-in classes and of a
+/// Main class that inherits from IO
+///
+/// \return a shared pointer to the program node
+ProgramNodePtr MakeProgram() {
+  std::vector<FormalNodePtr> args;
+  std::vector<GenericAttributeNodePtr> attributes;
+  attributes.push_back(MethodNode::MakeMethodNode(
+      "main", "Object", args, IdExprNode::MakeIdExprNode("self", 0), 0));
+
+  auto classes = ProgramNode::BuiltInClasses();
+  classes.push_back(
+      ClassNode::MakeClassNode("Main", "IO", attributes, false, 0));
+  return ProgramNode::MakeProgramNode(classes);
+}
+
+/// Helper function to run the semantic analysis passes
+///
+/// \param[in] context analysis context
+/// \param[in] program program node
+/// \return Status::Ok() if all the passes succeed, an error otherwise
+Status Analyze(AnalysisContext *context, ProgramNode *program) {
+  std::vector<std::shared_ptr<Pass>> passes = {
+      std::make_shared<ClassesDefinitionPass>(),
+      std::make_shared<ClassesImplementationPass>(),
+      std::make_shared<TypeCheckPass>()};
+  for (auto pass : passes) {
+    auto status = program->visitNode(context, pass.get());
+    if (!status.isOk()) {
+      return status;
+    }
+  }
+  return Status::Ok();
+}
+
+} // namespace
+
+TEST(Prelude, BuiltInClassesAreShared) {
+  /// Built-in classes are built once
+  const auto &classes = ProgramNode::BuiltInClasses();
+  ASSERT_EQ(classes.size(), 5);
+  ASSERT_EQ(classes.front().get(), ProgramNode::BuiltInClasses().front().get());
+  ASSERT_EQ(Prelude::Get(), Prelude::Get());
+
+  /// Each registry contains the built-in classes with the same IDs
+  auto prelude = Prelude::Get();
+  auto firstRegistry = prelude->makeClassRegistry();
+  auto secondRegistry = prelude->makeClassRegistry();
+  ASSERT_NE(firstRegistry, secondRegistry);
+  ASSERT_EQ(firstRegistry->size(), classes.size());
+  for (const auto &classNode : classes) {
+    const auto &className = classNode->className();
+    ASSERT_TRUE(firstRegistry->hasClass(className));
+    ASSERT_EQ(firstRegistry->typeID(className),
+              secondRegistry->typeID(className));
+    ASSERT_EQ(firstRegistry->classNode(className), classNode.get());
+  }
+  ASSERT_FALSE(firstRegistry->isFrozen());
+}
+
+TEST(Prelude, ProgramsAreLayeredOnPrelude) {
+  auto prelude = Prelude::Get();
+
+  /// Analyze two programs on top of the prelude
+  auto firstRegistry = prelude->makeClassRegistry();
+  auto firstContext = prelude->makeAnalysisContext(firstRegistry, MakeLogger());
+  auto firstProgram = MakeProgram();
+  ASSERT_TRUE(Analyze(firstContext.get(), firstProgram.get()).isOk());
+
+  auto secondRegistry = prelude->makeClassRegistry();
+  auto secondContext =
+      prelude->makeAnalysisContext(secondRegistry, MakeLogger());
+  auto secondProgram = MakeProgram();
+  ASSERT_TRUE(Analyze(secondContext.get(), secondProgram.get()).isOk());
+
+  /// Programs share the tables of the built-in classes, not those of their
+  /// own classes
+  const auto ioID = firstRegistry->typeID("IO");
+  ASSERT_EQ(firstContext->methodTable(ioID), secondContext->methodTable(ioID));
+  ASSERT_EQ(firstContext->symbolTable(ioID), secondContext->symbolTable(ioID));
+  ASSERT_NE(firstContext->methodTable("Main"),
+            secondContext->methodTable("Main"));
+
+  /// Methods of the built-in classes are inherited
+  auto *methodTable = firstContext->methodTable("Main");
+  ASSERT_TRUE(methodTable->findKeyInTable("out_string"));
+  ASSERT_TRUE(methodTable->findKeyInTable("abort"));
+  ASSERT_TRUE(methodTable->findKeyInTable("main"));
+  ASSERT_FALSE(firstContext->methodTable(ioID)->findKeyInTable("main"));
+  ASSERT_TRUE(firstRegistry->isFrozen());
+}
+
+TEST(Prelude, BuiltInClassCannotBeRedefined) {
+  auto prelude = Prelude::Get();
+  auto registry = prelude->makeClassRegistry();
+  auto context = prelude->makeAnalysisContext(registry, MakeLogger());
+
+  /// Program redefines the Int class
+  std::vector<GenericAttributeNodePtr> attributes;
+  auto classes = ProgramNode::BuiltInClasses();
+  classes.push_back(
+      ClassNode::MakeClassNode("Int", "Object", attributes, false, 0));
+  classes.push_back(
+      ClassNode::MakeClassNode("Main", "Object", attributes, false, 0));
+  auto program = ProgramNode::MakeProgramNode(classes);
+
+  auto status = Analyze(context.get(), program.get());
+  ASSERT_FALSE(status.isOk());
+
+  auto *logger =
+      dynamic_cast<StringLogger *>(context->logger()->logger(LOGGER_NAME));
+  ASSERT_EQ(logger->loggedMessageCount(), 1);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
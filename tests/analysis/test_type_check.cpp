@@ -40,15 +40,15 @@ MakeClassWithMethods(const std::string &className,
   for (size_t i = 0; i < methodsInfo.size(); ++i) {
     std::vector<FormalNodePtr> args;
     for (auto &arg : methodsInfo[i].second) {
-      args.push_back(FormalNode::MakeFormalNode(arg.first, arg.second, 0, 0));
+      args.push_back(FormalNode::MakeFormalNode(arg.first, arg.second, 0));
     }
 
     methods.push_back(MethodNode::MakeMethodNode(
-        methodsInfo[i].first, methodsReturnTypes[i], args, nullptr, 0, 0));
+        methodsInfo[i].first, methodsReturnTypes[i], args, nullptr, 0));
   }
 
   /// Create and return the class
-  return ClassNode::MakeClassNode(className, parentName, methods, false, 0, 0);
+  return ClassNode::MakeClassNode(className, parentName, methods, false, 0);
 }
 
 /// Helper function to initialize a context for type checking
@@ -63,7 +63,7 @@ std::unique_ptr<AnalysisContext> MakeContextWithDefaultClasses() {
   /// Add object class to context
   std::vector<GenericAttributeNodePtr> attributes;
   context->classRegistry()->addClass(
-      ClassNode::MakeClassNode("Object", "", attributes, false, 0, 0));
+      ClassNode::MakeClassNode("Object", "", attributes, false, 0));
   context->setCurrentClassName("Object");
   context->initializeTables();
 
@@ -73,7 +73,7 @@ std::unique_ptr<AnalysisContext> MakeContextWithDefaultClasses() {
       {"Int", "Object"}, {"Bool", "Object"}, {"String", "Object"}};
   for (auto &[className, parentClassName] : classes) {
     context->classRegistry()->addClass(ClassNode::MakeClassNode(
-        className, parentClassName, attributes, false, 0, 0));
+        className, parentClassName, attributes, false, 0));
     context->setCurrentClassName(className);
     context->initializeTables();
   }
@@ -127,21 +127,21 @@ TEST(TypeCheckTests, AssignmentExprNodeTests) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create nodes and register symbols
-  auto nodeA = IdExprNode::MakeIdExprNode("a", 0, 0);
+  auto nodeA = IdExprNode::MakeIdExprNode("a", 0);
   context->symbolTable()->addElement("a", registry->toType("A"));
 
-  auto nodeB = IdExprNode::MakeIdExprNode("b", 0, 0);
+  auto nodeB = IdExprNode::MakeIdExprNode("b", 0);
   context->symbolTable()->addElement("b", registry->toType("B"));
 
-  auto nodeD = IdExprNode::MakeIdExprNode("d", 0, 0);
+  auto nodeD = IdExprNode::MakeIdExprNode("d", 0);
   context->symbolTable()->addElement("d", registry->toType("D"));
 
-  auto nodeSelf = IdExprNode::MakeIdExprNode("self", 0, 0);
+  auto nodeSelf = IdExprNode::MakeIdExprNode("self", 0);
   context->symbolTable()->addElement("self", registry->toSelfType("A"));
 
   /// Successfull assignment to same-type variable
   {
-    auto node = AssignmentExprNode::MakeAssignmentExprNode("a", nodeA, 0, 0);
+    auto node = AssignmentExprNode::MakeAssignmentExprNode("a", nodeA, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("A"));
@@ -149,7 +149,7 @@ TEST(TypeCheckTests, AssignmentExprNodeTests) {
 
   /// Successfull assignment to variable of derived type
   {
-    auto node = AssignmentExprNode::MakeAssignmentExprNode("a", nodeB, 0, 0);
+    auto node = AssignmentExprNode::MakeAssignmentExprNode("a", nodeB, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("B"));
@@ -157,7 +157,7 @@ TEST(TypeCheckTests, AssignmentExprNodeTests) {
 
   /// Assignment to an undefined variable
   {
-    auto node = AssignmentExprNode::MakeAssignmentExprNode("c", nodeA, 0, 0);
+    auto node = AssignmentExprNode::MakeAssignmentExprNode("c", nodeA, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_FALSE(status.isOk());
 
@@ -171,7 +171,7 @@ TEST(TypeCheckTests, AssignmentExprNodeTests) {
 
   /// Assignment to self
   {
-    auto node = AssignmentExprNode::MakeAssignmentExprNode("self", nodeA, 0, 0);
+    auto node = AssignmentExprNode::MakeAssignmentExprNode("self", nodeA, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_FALSE(status.isOk());
 
@@ -185,7 +185,7 @@ TEST(TypeCheckTests, AssignmentExprNodeTests) {
 
   /// Invalid type of right hand side expression
   {
-    auto node = AssignmentExprNode::MakeAssignmentExprNode("a", nodeD, 0, 0);
+    auto node = AssignmentExprNode::MakeAssignmentExprNode("a", nodeD, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_FALSE(status.isOk());
 
@@ -210,19 +210,19 @@ TEST(TypeCheckTests, BinaryExprNodeArithmeticOpsTests) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create nodes and register symbols
-  auto nodeA = IdExprNode::MakeIdExprNode("a", 0, 0);
+  auto nodeA = IdExprNode::MakeIdExprNode("a", 0);
   context->symbolTable()->addElement("a", registry->toType("Int"));
 
-  auto nodeB = IdExprNode::MakeIdExprNode("b", 0, 0);
+  auto nodeB = IdExprNode::MakeIdExprNode("b", 0);
   context->symbolTable()->addElement("b", registry->toType("Int"));
 
-  auto nodeC = IdExprNode::MakeIdExprNode("c", 0, 0);
+  auto nodeC = IdExprNode::MakeIdExprNode("c", 0);
   context->symbolTable()->addElement("c", registry->toSelfType("A"));
 
   /// Successfull arithmetic expression
   {
     auto node = BinaryExprNode<ArithmeticOpID>::MakeBinaryExprNode(
-        nodeA, nodeB, ArithmeticOpID::Plus, 0, 0);
+        nodeA, nodeB, ArithmeticOpID::Plus, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("Int"));
@@ -231,7 +231,7 @@ TEST(TypeCheckTests, BinaryExprNodeArithmeticOpsTests) {
   /// Left hand side is not an integer expression
   {
     auto node = BinaryExprNode<ArithmeticOpID>::MakeBinaryExprNode(
-        nodeC, nodeB, ArithmeticOpID::Plus, 0, 0);
+        nodeC, nodeB, ArithmeticOpID::Plus, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_FALSE(status.isOk());
 
@@ -247,7 +247,7 @@ TEST(TypeCheckTests, BinaryExprNodeArithmeticOpsTests) {
   /// Right hand side is not an integer expression
   {
     auto node = BinaryExprNode<ArithmeticOpID>::MakeBinaryExprNode(
-        nodeA, nodeC, ArithmeticOpID::Plus, 0, 0);
+        nodeA, nodeC, ArithmeticOpID::Plus, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_FALSE(status.isOk());
 
@@ -271,19 +271,19 @@ TEST(TypeCheckTests, BinaryExprNodeComparisonOpsTests) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create nodes and register symbols
-  auto nodeI = IdExprNode::MakeIdExprNode("int", 0, 0);
+  auto nodeI = IdExprNode::MakeIdExprNode("int", 0);
   context->symbolTable()->addElement("int", registry->toType("Int"));
 
-  auto nodeA = IdExprNode::MakeIdExprNode("a", 0, 0);
+  auto nodeA = IdExprNode::MakeIdExprNode("a", 0);
   context->symbolTable()->addElement("a", registry->toSelfType("A"));
 
-  auto nodeB = IdExprNode::MakeIdExprNode("b", 0, 0);
+  auto nodeB = IdExprNode::MakeIdExprNode("b", 0);
   context->symbolTable()->addElement("b", registry->toSelfType("B"));
 
   /// Successfull comparison expression between integers
   {
     auto node = BinaryExprNode<ComparisonOpID>::MakeBinaryExprNode(
-        nodeI, nodeI, ComparisonOpID::Equal, 0, 0);
+        nodeI, nodeI, ComparisonOpID::Equal, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("Bool"));
@@ -292,7 +292,7 @@ TEST(TypeCheckTests, BinaryExprNodeComparisonOpsTests) {
   /// Successfull comparison expression between non-integers
   {
     auto node = BinaryExprNode<ComparisonOpID>::MakeBinaryExprNode(
-        nodeA, nodeA, ComparisonOpID::Equal, 0, 0);
+        nodeA, nodeA, ComparisonOpID::Equal, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("Bool"));
@@ -301,7 +301,7 @@ TEST(TypeCheckTests, BinaryExprNodeComparisonOpsTests) {
   /// Successfull comparison expression between non-integers of different types
   {
     auto node = BinaryExprNode<ComparisonOpID>::MakeBinaryExprNode(
-        nodeA, nodeB, ComparisonOpID::Equal, 0, 0);
+        nodeA, nodeB, ComparisonOpID::Equal, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("Bool"));
@@ -310,7 +310,7 @@ TEST(TypeCheckTests, BinaryExprNodeComparisonOpsTests) {
   /// Left hand side and right hand side must be of same type
   {
     auto node = BinaryExprNode<ComparisonOpID>::MakeBinaryExprNode(
-        nodeI, nodeA, ComparisonOpID::Equal, 0, 0);
+        nodeI, nodeA, ComparisonOpID::Equal, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_FALSE(status.isOk());
 
@@ -335,21 +335,21 @@ TEST(TypeCheckTests, BlockExprNodeTests) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create nodes and register symbols
-  auto nodeA = IdExprNode::MakeIdExprNode("a", 0, 0);
-  auto nodeB = IdExprNode::MakeIdExprNode("b", 0, 0);
+  auto nodeA = IdExprNode::MakeIdExprNode("a", 0);
+  auto nodeB = IdExprNode::MakeIdExprNode("b", 0);
   context->symbolTable()->addElement("a", registry->toType("A"));
   context->symbolTable()->addElement("b", registry->toType("B"));
 
   /// Type of block expression is type of last expression
   {
-    auto node = BlockExprNode::MakeBlockExprNode({nodeA, nodeB}, 0, 0);
+    auto node = BlockExprNode::MakeBlockExprNode({nodeA, nodeB}, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("B"));
   }
 
   {
-    auto node = BlockExprNode::MakeBlockExprNode({nodeB, nodeA}, 0, 0);
+    auto node = BlockExprNode::MakeBlockExprNode({nodeB, nodeA}, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("A"));
@@ -367,7 +367,7 @@ TEST(TypeCheckTests, BooleanExprNodeTests) {
 
   /// Type-check true expression
   {
-    auto node = BooleanExprNode::MakeBooleanExprNode(true, 0, 0);
+    auto node = BooleanExprNode::MakeBooleanExprNode(true, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("Bool"));
@@ -375,7 +375,7 @@ TEST(TypeCheckTests, BooleanExprNodeTests) {
 
   /// Type-check false expression
   {
-    auto node = BooleanExprNode::MakeBooleanExprNode(false, 0, 0);
+    auto node = BooleanExprNode::MakeBooleanExprNode(false, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("Bool"));
@@ -392,25 +392,25 @@ TEST(TypeCheckTests, CaseExprNodeTests) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create nodes to be used in type-checking
-  auto nodeA0 = IdExprNode::MakeIdExprNode("a0", 0, 0);
-  auto nodeB0 = IdExprNode::MakeIdExprNode("b0", 0, 0);
-  auto nodeD0 = IdExprNode::MakeIdExprNode("d0", 0, 0);
+  auto nodeA0 = IdExprNode::MakeIdExprNode("a0", 0);
+  auto nodeB0 = IdExprNode::MakeIdExprNode("b0", 0);
+  auto nodeD0 = IdExprNode::MakeIdExprNode("d0", 0);
   context->symbolTable()->addElement("a0", registry->toType("A"));
   context->symbolTable()->addElement("b0", registry->toType("B"));
   context->symbolTable()->addElement("d0", registry->toType("D"));
 
   /// Create case node bindings
-  auto nodeA = IdExprNode::MakeIdExprNode("a", 0, 0);
-  auto nodeB = IdExprNode::MakeIdExprNode("b", 0, 0);
-  auto nodeD = IdExprNode::MakeIdExprNode("d", 0, 0);
-  auto bindingA = CaseBindingNode::MakeCaseBindingNode("a", "A", nodeA, 0, 0);
-  auto bindingB = CaseBindingNode::MakeCaseBindingNode("b", "B", nodeB, 0, 0);
-  auto bindingD = CaseBindingNode::MakeCaseBindingNode("d", "A", nodeD, 0, 0);
+  auto nodeA = IdExprNode::MakeIdExprNode("a", 0);
+  auto nodeB = IdExprNode::MakeIdExprNode("b", 0);
+  auto nodeD = IdExprNode::MakeIdExprNode("d", 0);
+  auto bindingA = CaseBindingNode::MakeCaseBindingNode("a", "A", nodeA, 0);
+  auto bindingB = CaseBindingNode::MakeCaseBindingNode("b", "B", nodeB, 0);
+  auto bindingD = CaseBindingNode::MakeCaseBindingNode("d", "A", nodeD, 0);
 
   /// Type-check expression in which return type is equal to node type
   {
     auto node =
-        CaseExprNode::MakeCaseExprNode({bindingA, bindingB}, nodeA0, 0, 0);
+        CaseExprNode::MakeCaseExprNode({bindingA, bindingB}, nodeA0, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), nodeA0->type());
@@ -419,7 +419,7 @@ TEST(TypeCheckTests, CaseExprNodeTests) {
   /// Type-check expression in which return type is a subtype of node type
   {
     auto node =
-        CaseExprNode::MakeCaseExprNode({bindingA, bindingB}, nodeB0, 0, 0);
+        CaseExprNode::MakeCaseExprNode({bindingA, bindingB}, nodeB0, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), nodeA0->type());
@@ -429,7 +429,7 @@ TEST(TypeCheckTests, CaseExprNodeTests) {
   {
     auto *logger = GetLogger(context.get());
     auto node =
-        CaseExprNode::MakeCaseExprNode({bindingA, bindingD}, nodeA0, 0, 0);
+        CaseExprNode::MakeCaseExprNode({bindingA, bindingD}, nodeA0, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_FALSE(status.isOk());
     ASSERT_EQ(logger->loggedMessageCount(), 1);
@@ -450,19 +450,19 @@ TEST(TypeCheckTests, DispatchExprNode) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create caller node and register symbol
-  auto nodeC = IdExprNode::MakeIdExprNode("z", 0, 0);
+  auto nodeC = IdExprNode::MakeIdExprNode("z", 0);
   context->symbolTable()->addElement("z", registry->toType("Z"));
 
   /// Create parameter nodes and register symbol
-  auto nodeP1 = IdExprNode::MakeIdExprNode("p1", 0, 0);
-  auto nodeP2 = IdExprNode::MakeIdExprNode("p2", 0, 0);
+  auto nodeP1 = IdExprNode::MakeIdExprNode("p1", 0);
+  auto nodeP2 = IdExprNode::MakeIdExprNode("p2", 0);
   context->symbolTable()->addElement("p1", registry->toType("B"));
   context->symbolTable()->addElement("p2", registry->toType("D"));
 
   /// Valid dispatch expression with SELF_TYPE return type
   {
     auto nodeM = DispatchExprNode::MakeDispatchExprNode("methodA", nodeC,
-                                                        {nodeP1}, 0, 0);
+                                                        {nodeP1}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(nodeM->type(), nodeC->type());
@@ -473,7 +473,7 @@ TEST(TypeCheckTests, DispatchExprNode) {
   {
     context->setCurrentClassName("Z");
     auto nodeM = DispatchExprNode::MakeDispatchExprNode("methodA", nullptr,
-                                                        {nodeP1}, 0, 0);
+                                                        {nodeP1}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_TRUE(status.isOk());
     ExprType expectedType{.typeID = nodeC->type().typeID, .isSelf = true};
@@ -484,7 +484,7 @@ TEST(TypeCheckTests, DispatchExprNode) {
   /// Valid dispatch expression with return type other than SELF_TYPE
   {
     auto nodeM = DispatchExprNode::MakeDispatchExprNode("methodB", nodeC,
-                                                        {nodeP2}, 0, 0);
+                                                        {nodeP2}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(nodeM->type(), nodeP1->type());
@@ -494,7 +494,7 @@ TEST(TypeCheckTests, DispatchExprNode) {
   {
     auto *logger = GetLogger(context.get());
     auto nodeM = DispatchExprNode::MakeDispatchExprNode("methodC", nullptr,
-                                                        {nodeP1}, 0, 0);
+                                                        {nodeP1}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_FALSE(status.isOk());
     ASSERT_EQ(logger->loggedMessageCount(), 1);
@@ -508,7 +508,7 @@ TEST(TypeCheckTests, DispatchExprNode) {
   {
     auto *logger = GetLogger(context.get());
     auto nodeM = DispatchExprNode::MakeDispatchExprNode("methodC", nodeC,
-                                                        {nodeP1}, 0, 0);
+                                                        {nodeP1}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_FALSE(status.isOk());
     ASSERT_EQ(logger->loggedMessageCount(), 1);
@@ -522,7 +522,7 @@ TEST(TypeCheckTests, DispatchExprNode) {
   {
     auto *logger = GetLogger(context.get());
     auto nodeM = DispatchExprNode::MakeDispatchExprNode("methodC", nullptr,
-                                                        {nodeP1}, 0, 0);
+                                                        {nodeP1}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_FALSE(status.isOk());
     ASSERT_EQ(logger->loggedMessageCount(), 1);
@@ -536,7 +536,7 @@ TEST(TypeCheckTests, DispatchExprNode) {
   {
     auto *logger = GetLogger(context.get());
     auto nodeM = DispatchExprNode::MakeDispatchExprNode("methodA", nodeC,
-                                                        {nodeP1, nodeP2}, 0, 0);
+                                                        {nodeP1, nodeP2}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_FALSE(status.isOk());
     ASSERT_EQ(logger->loggedMessageCount(), 1);
@@ -551,7 +551,7 @@ TEST(TypeCheckTests, DispatchExprNode) {
     auto *logger = GetLogger(context.get());
     context->setCurrentClassName("Z");
     auto nodeM = DispatchExprNode::MakeDispatchExprNode("methodA", nullptr,
-                                                        {nodeP1, nodeP2}, 0, 0);
+                                                        {nodeP1, nodeP2}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_FALSE(status.isOk());
     ASSERT_EQ(logger->loggedMessageCount(), 1);
@@ -566,7 +566,7 @@ TEST(TypeCheckTests, DispatchExprNode) {
   {
     auto *logger = GetLogger(context.get());
     auto nodeM = DispatchExprNode::MakeDispatchExprNode("methodA", nodeC,
-                                                        {nodeP2}, 0, 0);
+                                                        {nodeP2}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_FALSE(status.isOk());
     ASSERT_EQ(logger->loggedMessageCount(), 1);
@@ -581,7 +581,7 @@ TEST(TypeCheckTests, DispatchExprNode) {
     context->setCurrentClassName("Z");
     auto *logger = GetLogger(context.get());
     auto nodeM = DispatchExprNode::MakeDispatchExprNode("methodA", nodeC,
-                                                        {nodeP2}, 0, 0);
+                                                        {nodeP2}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_FALSE(status.isOk());
     ASSERT_EQ(logger->loggedMessageCount(), 1);
@@ -603,11 +603,11 @@ TEST(TypeCheckTests, IdExprNodeTests) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create node and register symbol with dummy type
-  auto nodeA = IdExprNode::MakeIdExprNode("a", 0, 0);
+  auto nodeA = IdExprNode::MakeIdExprNode("a", 0);
   context->symbolTable()->addElement("a", registry->toType("A"));
 
   /// Create second node without registering symbol
-  auto nodeB = IdExprNode::MakeIdExprNode("b", 0, 0);
+  auto nodeB = IdExprNode::MakeIdExprNode("b", 0);
 
   /// Type-check of first node will succeed
   {
@@ -638,18 +638,18 @@ TEST(TypeCheckTests, IfExprNodeTests) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create nodes for basic types
-  auto nodeB = IdExprNode::MakeIdExprNode("bool", 0, 0);
+  auto nodeB = IdExprNode::MakeIdExprNode("bool", 0);
   context->symbolTable()->addElement("bool", classRegistry->toType("Bool"));
 
-  auto nodeI = IdExprNode::MakeIdExprNode("int", 0, 0);
+  auto nodeI = IdExprNode::MakeIdExprNode("int", 0);
   context->symbolTable()->addElement("int", classRegistry->toType("Int"));
 
-  auto nodeS = IdExprNode::MakeIdExprNode("string", 0, 0);
+  auto nodeS = IdExprNode::MakeIdExprNode("string", 0);
   context->symbolTable()->addElement("string", classRegistry->toType("String"));
 
   /// Valid if expression. Expression type should be object
   {
-    auto node = IfExprNode::MakeIfExprNode(nodeB, nodeI, nodeS, 0, 0);
+    auto node = IfExprNode::MakeIfExprNode(nodeB, nodeI, nodeS, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), classRegistry->toType("Object"));
@@ -657,7 +657,7 @@ TEST(TypeCheckTests, IfExprNodeTests) {
 
   /// Valid if expression. Expression type should be String
   {
-    auto node = IfExprNode::MakeIfExprNode(nodeB, nodeS, nodeS, 0, 0);
+    auto node = IfExprNode::MakeIfExprNode(nodeB, nodeS, nodeS, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), classRegistry->toType("String"));
@@ -665,7 +665,7 @@ TEST(TypeCheckTests, IfExprNodeTests) {
 
   /// Valid if expression. Expression type should be Int
   {
-    auto node = IfExprNode::MakeIfExprNode(nodeB, nodeI, nodeI, 0, 0);
+    auto node = IfExprNode::MakeIfExprNode(nodeB, nodeI, nodeI, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), classRegistry->toType("Int"));
@@ -673,7 +673,7 @@ TEST(TypeCheckTests, IfExprNodeTests) {
 
   /// If condition is not of type Bool
   {
-    auto node = IfExprNode::MakeIfExprNode(nodeS, nodeI, nodeI, 0, 0);
+    auto node = IfExprNode::MakeIfExprNode(nodeS, nodeI, nodeI, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_FALSE(status.isOk());
 
@@ -696,11 +696,11 @@ TEST(TypeCheckTests, IsVoidExprNodeTests) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create nodes for basic types
-  auto nodeA = IdExprNode::MakeIdExprNode("a", 0, 0);
+  auto nodeA = IdExprNode::MakeIdExprNode("a", 0);
   context->symbolTable()->addElement("a", registry->toType("A"));
 
   /// The type of an IsVoid expression is always Bool
-  auto node = UnaryExprNode::MakeUnaryExprNode(nodeA, UnaryOpID::IsVoid, 0, 0);
+  auto node = UnaryExprNode::MakeUnaryExprNode(nodeA, UnaryOpID::IsVoid, 0);
   auto status = typeCheckPass->visit(context.get(), node.get());
   ASSERT_TRUE(status.isOk());
   ASSERT_EQ(node->type(), registry->toType("Bool"));
@@ -716,21 +716,21 @@ TEST(TypeCheckTests, LetExprNodeTests) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create nodes and register symbols
-  auto nodeA = IdExprNode::MakeIdExprNode("x1", 0, 0);
-  auto nodeB = IdExprNode::MakeIdExprNode("x2", 0, 0);
-  auto nodeC = IdExprNode::MakeIdExprNode("x3", 0, 0);
+  auto nodeA = IdExprNode::MakeIdExprNode("x1", 0);
+  auto nodeB = IdExprNode::MakeIdExprNode("x2", 0);
+  auto nodeC = IdExprNode::MakeIdExprNode("x3", 0);
   context->symbolTable()->addElement("x1", registry->toType("Int"));
 
   auto nodeS1 = BinaryExprNode<ArithmeticOpID>::MakeBinaryExprNode(
-      nodeA, nodeB, ArithmeticOpID::Plus, 0, 0);
+      nodeA, nodeB, ArithmeticOpID::Plus, 0);
   auto nodeS2 = BinaryExprNode<ArithmeticOpID>::MakeBinaryExprNode(
-      nodeB, nodeC, ArithmeticOpID::Plus, 0, 0);
+      nodeB, nodeC, ArithmeticOpID::Plus, 0);
 
   /// Missing ID in binary expression defined in binding
   {
     auto letBindingNode =
-        LetBindingNode::MakeLetBindingNode("x2", "Int", nodeA, 0, 0);
-    auto letNode = LetExprNode::MakeLetExprNode({letBindingNode}, nodeS1, 0, 0);
+        LetBindingNode::MakeLetBindingNode("x2", "Int", nodeA, 0);
+    auto letNode = LetExprNode::MakeLetExprNode({letBindingNode}, nodeS1, 0);
     auto status = typeCheckPass->visit(context.get(), letNode.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(letNode->type(), registry->toType("Int"));
@@ -739,11 +739,11 @@ TEST(TypeCheckTests, LetExprNodeTests) {
   /// Missing IDs in binary expression defined in bindings
   {
     auto letBindingNodeA =
-        LetBindingNode::MakeLetBindingNode("x2", "Int", nodeA, 0, 0);
+        LetBindingNode::MakeLetBindingNode("x2", "Int", nodeA, 0);
     auto letBindingNodeB =
-        LetBindingNode::MakeLetBindingNode("x3", "Int", nodeA, 0, 0);
+        LetBindingNode::MakeLetBindingNode("x3", "Int", nodeA, 0);
     auto letNode = LetExprNode::MakeLetExprNode(
-        {letBindingNodeA, letBindingNodeB}, nodeS2, 0, 0);
+        {letBindingNodeA, letBindingNodeB}, nodeS2, 0);
     auto status = typeCheckPass->visit(context.get(), letNode.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(letNode->type(), registry->toType("Int"));
@@ -752,11 +752,11 @@ TEST(TypeCheckTests, LetExprNodeTests) {
   /// ID in second binding defined in first binding
   {
     auto letBindingNodeA =
-        LetBindingNode::MakeLetBindingNode("x3", "Int", nodeA, 0, 0);
+        LetBindingNode::MakeLetBindingNode("x3", "Int", nodeA, 0);
     auto letBindingNodeB =
-        LetBindingNode::MakeLetBindingNode("x2", "Int", nodeC, 0, 0);
+        LetBindingNode::MakeLetBindingNode("x2", "Int", nodeC, 0);
     auto letNode = LetExprNode::MakeLetExprNode(
-        {letBindingNodeA, letBindingNodeB}, nodeS1, 0, 0);
+        {letBindingNodeA, letBindingNodeB}, nodeS1, 0);
     auto status = typeCheckPass->visit(context.get(), letNode.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(letNode->type(), registry->toType("Int"));
@@ -765,11 +765,11 @@ TEST(TypeCheckTests, LetExprNodeTests) {
   /// Incorrect bindings order
   {
     auto letBindingNodeA =
-        LetBindingNode::MakeLetBindingNode("x3", "Int", nodeA, 0, 0);
+        LetBindingNode::MakeLetBindingNode("x3", "Int", nodeA, 0);
     auto letBindingNodeB =
-        LetBindingNode::MakeLetBindingNode("x2", "Int", nodeC, 0, 0);
+        LetBindingNode::MakeLetBindingNode("x2", "Int", nodeC, 0);
     auto letNode = LetExprNode::MakeLetExprNode(
-        {letBindingNodeB, letBindingNodeA}, nodeS1, 0, 0);
+        {letBindingNodeB, letBindingNodeA}, nodeS1, 0);
     auto status = typeCheckPass->visit(context.get(), letNode.get());
     ASSERT_FALSE(status.isOk());
 
@@ -785,8 +785,8 @@ TEST(TypeCheckTests, LetExprNodeTests) {
   /// ID in binary expression not defined
   {
     auto letBindingNode =
-        LetBindingNode::MakeLetBindingNode("x3", "Int", nodeA, 0, 0);
-    auto letNode = LetExprNode::MakeLetExprNode({letBindingNode}, nodeS1, 0, 0);
+        LetBindingNode::MakeLetBindingNode("x3", "Int", nodeA, 0);
+    auto letNode = LetExprNode::MakeLetExprNode({letBindingNode}, nodeS1, 0);
     auto status = typeCheckPass->visit(context.get(), letNode.get());
 
     /// Check error message
@@ -810,7 +810,7 @@ TEST(TypeCheckTests, LiteralExprNodeTests) {
 
   /// Integer constant tests
   {
-    auto node = LiteralExprNode<int32_t>::MakeLiteralExprNode(0, 0, 0);
+    auto node = LiteralExprNode<int32_t>::MakeLiteralExprNode(0, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("Int"));
@@ -818,7 +818,7 @@ TEST(TypeCheckTests, LiteralExprNodeTests) {
 
   /// String constant tests
   {
-    auto node = LiteralExprNode<std::string>::MakeLiteralExprNode("", 0, 0);
+    auto node = LiteralExprNode<std::string>::MakeLiteralExprNode("", 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("String"));
@@ -836,7 +836,7 @@ TEST(TypeCheckTests, NewExprNodeTests) {
 
   /// Type exists
   {
-    auto node = NewExprNode::MakeNewExprNode("A", 0, 0);
+    auto node = NewExprNode::MakeNewExprNode("A", 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("A"));
@@ -844,7 +844,7 @@ TEST(TypeCheckTests, NewExprNodeTests) {
 
   /// Type is SELF_TYPE
   {
-    auto node = NewExprNode::MakeNewExprNode("SELF_TYPE", 0, 0);
+    auto node = NewExprNode::MakeNewExprNode("SELF_TYPE", 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toSelfType("A"));
@@ -852,7 +852,7 @@ TEST(TypeCheckTests, NewExprNodeTests) {
 
   /// Type is not defined
   {
-    auto node = NewExprNode::MakeNewExprNode("C", 0, 0);
+    auto node = NewExprNode::MakeNewExprNode("C", 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_FALSE(status.isOk());
 
@@ -876,12 +876,12 @@ TEST(TypeCheckTests, StaticDispatchExprNode) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create caller node and register symbol
-  auto nodeC = IdExprNode::MakeIdExprNode("x", 0, 0);
+  auto nodeC = IdExprNode::MakeIdExprNode("x", 0);
   context->symbolTable()->addElement("x", registry->toType("X"));
 
   /// Create parameter nodes and register symbol
-  auto nodeP1 = IdExprNode::MakeIdExprNode("p1", 0, 0);
-  auto nodeP2 = IdExprNode::MakeIdExprNode("p2", 0, 0);
+  auto nodeP1 = IdExprNode::MakeIdExprNode("p1", 0);
+  auto nodeP2 = IdExprNode::MakeIdExprNode("p2", 0);
   context->symbolTable()->addElement("p1", registry->toType("B"));
   context->symbolTable()->addElement("p2", registry->toType("D"));
 
@@ -889,7 +889,7 @@ TEST(TypeCheckTests, StaticDispatchExprNode) {
   /// used is that of parent class
   {
     auto nodeM = StaticDispatchExprNode::MakeStaticDispatchExprNode(
-        "methodA", "Z", nodeC, {nodeP1}, 0, 0);
+        "methodA", "Z", nodeC, {nodeP1}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(nodeM->type(), nodeC->type());
@@ -899,7 +899,7 @@ TEST(TypeCheckTests, StaticDispatchExprNode) {
   /// used is same as caller type
   {
     auto nodeM = StaticDispatchExprNode::MakeStaticDispatchExprNode(
-        "methodA", "X", nodeC, {nodeP1}, 0, 0);
+        "methodA", "X", nodeC, {nodeP1}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(nodeM->type(), nodeC->type());
@@ -908,7 +908,7 @@ TEST(TypeCheckTests, StaticDispatchExprNode) {
   /// Valid static dispatch expression with return type other than SELF_TYPE
   {
     auto nodeM = StaticDispatchExprNode::MakeStaticDispatchExprNode(
-        "methodB", "Z", nodeC, {nodeP2}, 0, 0);
+        "methodB", "Z", nodeC, {nodeP2}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(nodeM->type(), nodeP1->type());
@@ -918,7 +918,7 @@ TEST(TypeCheckTests, StaticDispatchExprNode) {
   {
     auto *logger = GetLogger(context.get());
     auto nodeM = StaticDispatchExprNode::MakeStaticDispatchExprNode(
-        "methodA", "B", nodeC, {nodeP1}, 0, 0);
+        "methodA", "B", nodeC, {nodeP1}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_FALSE(status.isOk());
     ASSERT_EQ(logger->loggedMessageCount(), 1);
@@ -932,7 +932,7 @@ TEST(TypeCheckTests, StaticDispatchExprNode) {
   {
     auto *logger = GetLogger(context.get());
     auto nodeM = StaticDispatchExprNode::MakeStaticDispatchExprNode(
-        "methodA", "F", nodeC, {nodeP1}, 0, 0);
+        "methodA", "F", nodeC, {nodeP1}, 0);
     auto status = typeCheckPass->visit(context.get(), nodeM.get());
     ASSERT_FALSE(status.isOk());
     ASSERT_EQ(logger->loggedMessageCount(), 1);
@@ -952,15 +952,15 @@ TEST(TypeCheckTests, WhileExprNodeTests) {
   auto typeCheckPass = std::make_unique<TypeCheckPass>();
 
   /// Create nodes for basic types
-  auto nodeA = IdExprNode::MakeIdExprNode("a", 0, 0);
+  auto nodeA = IdExprNode::MakeIdExprNode("a", 0);
   context->symbolTable()->addElement("a", registry->toType("A"));
 
-  auto nodeB = IdExprNode::MakeIdExprNode("bool", 0, 0);
+  auto nodeB = IdExprNode::MakeIdExprNode("bool", 0);
   context->symbolTable()->addElement("bool", registry->toType("Bool"));
 
   /// Well-formed while loop
   {
-    auto node = WhileExprNode::MakeWhileExprNode(nodeB, nodeA, 0, 0);
+    auto node = WhileExprNode::MakeWhileExprNode(nodeB, nodeA, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_TRUE(status.isOk());
     ASSERT_EQ(node->type(), registry->toType("Object"));
@@ -968,7 +968,7 @@ TEST(TypeCheckTests, WhileExprNodeTests) {
 
   /// Loop condition is not of type Bool
   {
-    auto node = WhileExprNode::MakeWhileExprNode(nodeA, nodeA, 0, 0);
+    auto node = WhileExprNode::MakeWhileExprNode(nodeA, nodeA, 0);
     auto status = typeCheckPass->visit(context.get(), node.get());
     ASSERT_FALSE(status.isOk());
 
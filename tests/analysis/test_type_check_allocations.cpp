@@ -0,0 +1,207 @@
+#include <cool/analysis/analysis_context.h>
+#include <cool/analysis/classes_definition.h>
+#include <cool/analysis/classes_implementation.h>
+#include <cool/analysis/prelude.h>
+#include <cool/analysis/type_check.h>
+#include <cool/core/class_registry.h>
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+/// Number of heap allocations, updated by the global allocation function below
+std::atomic<size_t> sAllocationsCount{0};
+
+} // namespace
+
+void *operator new(size_t size) {
+  ++sAllocationsCount;
+  void *memory = std::malloc(size > 0 ? size : 1);
+  if (memory == nullptr) {
+    throw std::bad_alloc();
+  }
+  return memory;
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+namespace cool {
+
+namespace {
+
+/// \brief Helper function to create a well-typed program that contains every
+/// kind of expression:
+///
+/// class A {
+///   n : Int <- 0;
+///   s : String <- "a";
+///   b : Bool <- true;
+///   add(x : Int, y : Int) : Int { x + y };
+///   me() : SELF_TYPE { self };
+/// };
+/// class B inherits A {
+///   add(x : Int, y : Int) : Int { { n <- x * y - 1 / 1; n; } };
+///   run() : Object {
+///     let i : Int <- 0, o : A <- new B in {
+///       while i < 10 loop i <- i + 1 pool;
+///       if i <= 10 then not b else isvoid o fi;
+///       if s = "a" then ~n else add(i, n) fi;
+///       o@A.add(1, 2);
+///       o.me();
+///       case o of x : B => x.add(1, 1); y : A => y; z : Object => 0; esac;
+///       o = new B;
+///     }
+///   };
+/// };
+/// class Main { main() : Object { (new B).run() }; };
+///
+/// \return a shared pointer to the program node
+ProgramNodePtr MakeProgram() {
+  auto id = [](const Symbol &name) {
+    return IdExprNode::MakeIdExprNode(name, 0);
+  };
+  auto integer = [](const int32_t value) {
+    return LiteralExprNode<int32_t>::MakeLiteralExprNode(value, 0);
+  };
+  auto arithmetic = [](ExprNodePtr lhs, ExprNodePtr rhs,
+                       const ArithmeticOpID opID) {
+    return BinaryExprNode<ArithmeticOpID>::MakeBinaryExprNode(lhs, rhs, opID,
+                                                              0);
+  };
+  auto comparison = [](ExprNodePtr lhs, ExprNodePtr rhs,
+                       const ComparisonOpID opID) {
+    return BinaryExprNode<ComparisonOpID>::MakeBinaryExprNode(lhs, rhs, opID,
+                                                              0);
+  };
+  std::vector<FormalNodePtr> arguments = {
+      FormalNode::MakeFormalNode("x", "Int", 0),
+      FormalNode::MakeFormalNode("y", "Int", 0)};
+
+  std::vector<GenericAttributeNodePtr> attributesA;
+  attributesA.push_back(
+      AttributeNode::MakeAttributeNode("n", "Int", integer(0), 0));
+  attributesA.push_back(AttributeNode::MakeAttributeNode(
+      "s", "String", LiteralExprNode<std::string>::MakeLiteralExprNode("a", 0),
+      0));
+  attributesA.push_back(AttributeNode::MakeAttributeNode(
+      "b", "Bool", BooleanExprNode::MakeBooleanExprNode(true, 0), 0));
+  attributesA.push_back(MethodNode::MakeMethodNode(
+      "add", "Int", arguments,
+      arithmetic(id("x"), id("y"), ArithmeticOpID::Plus), 0));
+  attributesA.push_back(
+      MethodNode::MakeMethodNode("me", "SELF_TYPE", {}, id("self"), 0));
+
+  auto product = arithmetic(
+      arithmetic(id("x"), id("y"), ArithmeticOpID::Mult),
+      arithmetic(integer(1), integer(1), ArithmeticOpID::Div),
+      ArithmeticOpID::Minus);
+  auto addB = BlockExprNode::MakeBlockExprNode(
+      {AssignmentExprNode::MakeAssignmentExprNode("n", product, 0), id("n")},
+      0);
+
+  auto loop = WhileExprNode::MakeWhileExprNode(
+      comparison(id("i"), integer(10), ComparisonOpID::LessThan),
+      AssignmentExprNode::MakeAssignmentExprNode(
+          "i", arithmetic(id("i"), integer(1), ArithmeticOpID::Plus), 0),
+      0);
+  auto firstIf = IfExprNode::MakeIfExprNode(
+      comparison(id("i"), integer(10), ComparisonOpID::LessThanOrEqual),
+      UnaryExprNode::MakeUnaryExprNode(id("b"), UnaryOpID::Not, 0),
+      UnaryExprNode::MakeUnaryExprNode(id("o"), UnaryOpID::IsVoid, 0), 0);
+  auto secondIf = IfExprNode::MakeIfExprNode(
+      comparison(id("s"),
+                 LiteralExprNode<std::string>::MakeLiteralExprNode("a", 0),
+                 ComparisonOpID::Equal),
+      UnaryExprNode::MakeUnaryExprNode(id("n"), UnaryOpID::Complement, 0),
+      DispatchExprNode::MakeDispatchExprNode("add", nullptr,
+                                             {id("i"), id("n")}, 0),
+      0);
+  auto staticDispatch = StaticDispatchExprNode::MakeStaticDispatchExprNode(
+      "add", "A", id("o"), {integer(1), integer(2)}, 0);
+  auto dispatch = DispatchExprNode::MakeDispatchExprNode("me", id("o"), {}, 0);
+  auto caseExpr = CaseExprNode::MakeCaseExprNode(
+      {CaseBindingNode::MakeCaseBindingNode(
+           "x", "B",
+           DispatchExprNode::MakeDispatchExprNode(
+               "add", id("x"), {integer(1), integer(1)}, 0),
+           0),
+       CaseBindingNode::MakeCaseBindingNode("y", "A", id("y"), 0),
+       CaseBindingNode::MakeCaseBindingNode("z", "Object", integer(0), 0)},
+      id("o"), 0);
+  auto equality = comparison(id("o"), NewExprNode::MakeNewExprNode("B", 0),
+                             ComparisonOpID::Equal);
+  auto runB = LetExprNode::MakeLetExprNode(
+      {LetBindingNode::MakeLetBindingNode("i", "Int", integer(0), 0),
+       LetBindingNode::MakeLetBindingNode(
+           "o", "A", NewExprNode::MakeNewExprNode("B", 0), 0)},
+      BlockExprNode::MakeBlockExprNode({loop, firstIf, secondIf,
+                                        staticDispatch, dispatch, caseExpr,
+                                        equality},
+                                       0),
+      0);
+
+  std::vector<GenericAttributeNodePtr> attributesB;
+  attributesB.push_back(
+      MethodNode::MakeMethodNode("add", "Int", arguments, addB, 0));
+  attributesB.push_back(
+      MethodNode::MakeMethodNode("run", "Object", {}, runB, 0));
+
+  std::vector<GenericAttributeNodePtr> attributesMain;
+  attributesMain.push_back(MethodNode::MakeMethodNode(
+      "main", "Object", {},
+      DispatchExprNode::MakeDispatchExprNode(
+          "run", NewExprNode::MakeNewExprNode("B", 0), {}, 0),
+      0));
+
+  auto classes = ProgramNode::BuiltInClasses();
+  classes.push_back(
+      ClassNode::MakeClassNode("A", "Object", attributesA, false, 0));
+  classes.push_back(ClassNode::MakeClassNode("B", "A", attributesB, false, 0));
+  classes.push_back(
+      ClassNode::MakeClassNode("Main", "Object", attributesMain, false, 0));
+  return ProgramNode::MakeProgramNode(classes);
+}
+
+} // namespace
+
+TEST(TypeCheckAllocations, WellTypedProgramDoesNotAllocate) {
+  auto prelude = Prelude::Get();
+  auto registry = prelude->makeClassRegistry();
+  auto context = prelude->makeAnalysisContext(registry, nullptr);
+  auto program = MakeProgram();
+
+  ClassesDefinitionPass definitionPass;
+  ClassesImplementationPass implementationPass;
+  ASSERT_TRUE(definitionPass.visit(context.get(), program.get()).isOk());
+  ASSERT_TRUE(implementationPass.visit(context.get(), program.get()).isOk());
+
+  /// The first type-check grows the symbol tables to their working size
+  TypeCheckPass typeCheckPass;
+  ASSERT_TRUE(typeCheckPass.visit(context.get(), program.get()).isOk());
+
+  /// Type-checking the program again does not allocate
+  const size_t allocationsCount = sAllocationsCount;
+  const bool isOk = typeCheckPass.visit(context.get(), program.get()).isOk();
+  const size_t typeCheckAllocationsCount =
+      sAllocationsCount - allocationsCount;
+  ASSERT_TRUE(isOk);
+  ASSERT_EQ(typeCheckAllocationsCount, 0);
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
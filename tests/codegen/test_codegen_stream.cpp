@@ -0,0 +1,187 @@
+#include <cool/analysis/analysis_context.h>
+#include <cool/analysis/classes_definition.h>
+#include <cool/analysis/classes_implementation.h>
+#include <cool/analysis/name_resolution.h>
+#include <cool/analysis/prelude.h>
+#include <cool/analysis/type_check.h>
+#include <cool/codegen/codegen_code.h>
+#include <cool/codegen/codegen_constants.h>
+#include <cool/codegen/codegen_context.h>
+#include <cool/codegen/codegen_stream.h>
+#include <cool/codegen/codegen_tables.h>
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace cool {
+
+namespace {
+
+/// \brief Helper function to create a program with two classes:
+///
+/// class A { n : Int <- 7; greet() : String { "hello" }; };
+/// class Main inherits IO {
+///   a : A <- new A;
+///   main() : Object { out_string(a.greet()) };
+/// };
+///
+/// \return a shared pointer to the program node
+ProgramNodePtr MakeProgram() {
+  std::vector<FormalNodePtr> noArgs;
+
+  std::vector<GenericAttributeNodePtr> attributesA;
+  attributesA.push_back(AttributeNode::MakeAttributeNode(
+      "n", "Int", LiteralExprNode<int32_t>::MakeLiteralExprNode(7, 0), 0));
+  attributesA.push_back(MethodNode::MakeMethodNode(
+      "greet", "String", noArgs,
+      LiteralExprNode<std::string>::MakeLiteralExprNode("hello", 0), 0));
+
+  std::vector<GenericAttributeNodePtr> attributesMain;
+  attributesMain.push_back(AttributeNode::MakeAttributeNode(
+      "a", "A", NewExprNode::MakeNewExprNode("A", 0), 0));
+  auto greet = DispatchExprNode::MakeDispatchExprNode(
+      "greet", IdExprNode::MakeIdExprNode("a", 0), {}, 0);
+  attributesMain.push_back(MethodNode::MakeMethodNode(
+      "main", "Object", noArgs,
+      DispatchExprNode::MakeDispatchExprNode("out_string", nullptr, {greet},
+                                             0),
+      0));
+
+  auto classes = ProgramNode::BuiltInClasses();
+  classes.push_back(ClassNode::MakeClassNode("A", "Object", attributesA,
+                                             false, 0));
+  classes.push_back(ClassNode::MakeClassNode("Main", "IO", attributesMain,
+                                             false, 0));
+  auto program = ProgramNode::MakeProgramNode(classes);
+  program->setFileName("test.cl");
+  return program;
+}
+
+/// \brief Helper function to run the semantic analysis passes
+///
+/// \param[in] context analysis context
+/// \param[in] program program node
+/// \param[in] typeCheck true to type-check the class expressions and resolve
+/// their names too
+void Analyze(AnalysisContext *context, ProgramNode *program,
+             const bool typeCheck) {
+  std::vector<std::shared_ptr<Pass>> passes = {
+      std::make_shared<ClassesDefinitionPass>(),
+      std::make_shared<ClassesImplementationPass>()};
+  if (typeCheck) {
+    passes.push_back(std::make_shared<TypeCheckPass>());
+    passes.push_back(std::make_shared<NameResolutionPass>());
+  }
+
+  for (auto pass : passes) {
+    ASSERT_TRUE(program->visitNode(context, pass.get()).isOk());
+  }
+}
+
+/// \brief Helper function to split the generated code into its lines, sorted
+/// and without the segment directives and the empty lines
+///
+/// \param[in] code generated code
+/// \return the sorted lines of code
+std::vector<std::string> SortedLines(const std::string &code) {
+  std::vector<std::string> lines;
+  std::istringstream iss(code);
+  std::string line;
+  while (std::getline(iss, line)) {
+    if (line.empty() || line.find(".data") != std::string::npos ||
+        line.find(".text") != std::string::npos) {
+      continue;
+    }
+    lines.push_back(line);
+  }
+  std::sort(lines.begin(), lines.end());
+  return lines;
+}
+
+} // namespace
+
+TEST(CodegenStream, MatchesWholeProgramCodegen) {
+  auto prelude = Prelude::Get();
+
+  /// Generate the code of the whole program at once
+  std::stringstream batchCode;
+  {
+    auto registry = prelude->makeClassRegistry();
+    auto context = prelude->makeAnalysisContext(registry, nullptr);
+    auto program = MakeProgram();
+    Analyze(context.get(), program.get(), true);
+
+    CodegenContext codegenContext(registry);
+    std::vector<std::shared_ptr<CodegenBasePass>> passes = {
+        std::make_shared<CodegenConstantsPass>(),
+        std::make_shared<CodegenTablesPass>(),
+        std::make_shared<CodegenObjectsInitPass>()};
+    for (auto pass : passes) {
+      ASSERT_TRUE(
+          pass->codegen(&codegenContext, program.get(), &batchCode).isOk());
+    }
+  }
+
+  /// Generate the code one class at a time
+  std::stringstream streamCode;
+  auto registry = prelude->makeClassRegistry();
+  auto context = prelude->makeAnalysisContext(registry, nullptr);
+  auto program = MakeProgram();
+  Analyze(context.get(), program.get(), false);
+
+  CodegenContext codegenContext(registry);
+  CodegenStream stream(&codegenContext, &streamCode);
+  ASSERT_TRUE(stream.begin(program.get()).isOk());
+
+  TypeCheckPass typeCheckPass;
+  NameResolutionPass resolutionPass;
+  for (const auto &classNode : program->classes()) {
+    ASSERT_TRUE(classNode->visitNode(context.get(), &typeCheckPass).isOk());
+    ASSERT_TRUE(classNode->visitNode(context.get(), &resolutionPass).isOk());
+    ASSERT_TRUE(stream.generateClass(classNode.get()).isOk());
+    if (!classNode->builtIn()) {
+      classNode->releaseExprs();
+    }
+  }
+  ASSERT_TRUE(stream.end().isOk());
+
+  /// Both versions generate the same labels, data and instructions
+  ASSERT_EQ(SortedLines(streamCode.str()), SortedLines(batchCode.str()));
+
+  /// The heap start label follows all the data
+  const std::string code = streamCode.str();
+  const std::string heapStartLabel = "heap_start:";
+  const size_t heapStart = code.rfind(heapStartLabel);
+  ASSERT_NE(heapStart, std::string::npos);
+  ASSERT_EQ(code.find(':', heapStart + heapStartLabel.length()),
+            std::string::npos);
+  ASSERT_GT(heapStart, code.rfind(".data"));
+  ASSERT_GT(code.rfind(".data"), code.rfind(".text"));
+
+  /// Class expressions are released once their code is generated
+  for (const auto &classNode : program->classes()) {
+    if (classNode->builtIn()) {
+      continue;
+    }
+    for (const auto &attributeNode : classNode->attributes()) {
+      ASSERT_EQ(attributeNode->initExpr(), nullptr);
+    }
+    for (const auto &methodNode : classNode->methods()) {
+      ASSERT_EQ(methodNode->body(), nullptr);
+    }
+  }
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,101 @@
+#include <cool/core/class_layout.h>
+#include <cool/core/class_registry.h>
+#include <cool/ir/class.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace cool {
+
+namespace {
+
+/// Helper method to create a shared pointer to a class node
+///
+/// \param[in] className class name
+/// \param[in] parentClassName parent class name
+/// \param[in] attributeNames names of the attributes, of type Int
+/// \param[in] methodNames names of the methods, with no arguments
+/// \return a shared pointer to a class node for the specified class
+ClassNodePtr CreateClassNode(const std::string &className,
+                             const std::string &parentClassName,
+                             const std::vector<std::string> &attributeNames,
+                             const std::vector<std::string> &methodNames) {
+  std::vector<GenericAttributeNodePtr> attributes;
+  for (const auto &attributeName : attributeNames) {
+    attributes.push_back(
+        AttributeNode::MakeAttributeNode(attributeName, "Int", nullptr, 0));
+  }
+  for (const auto &methodName : methodNames) {
+    attributes.push_back(
+        MethodNode::MakeMethodNode(methodName, "Int", {}, nullptr, 0));
+  }
+  return ClassNode::MakeClassNode(className, parentClassName, attributes,
+                                  false, 0);
+}
+
+} // namespace
+
+TEST(ClassLayout, AttributesAndSlots) {
+  /// Class B is registered before its parent class, and class C defines a
+  /// method with the same name as a method of B
+  ClassRegistry registry;
+  ASSERT_TRUE(
+      registry.addClass(CreateClassNode("B", "A", {"b"}, {"f", "g"})).isOk());
+  ASSERT_TRUE(
+      registry.addClass(CreateClassNode("A", "", {"a1", "a2"}, {"f"})).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("C", "", {}, {"h", "g"}))
+                  .isOk());
+  ASSERT_TRUE(registry.freeze().isOk());
+
+  auto layout = ClassLayout::MakeClassLayout(registry);
+  const auto idA = registry.typeID("A");
+  const auto idB = registry.typeID("B");
+  const auto idC = registry.typeID("C");
+
+  /// Attributes follow the inherited attributes
+  ASSERT_EQ(layout->attributesBegin(idA), 0);
+  ASSERT_EQ(layout->attributesCount(idA), 2);
+  ASSERT_EQ(layout->attributesBegin(idB), 2);
+  ASSERT_EQ(layout->attributesCount(idB), 3);
+  ASSERT_EQ(layout->attributesCount(idC), 0);
+
+  /// Method names are interned once
+  ASSERT_EQ(layout->selectorsCount(), 3);
+  ASSERT_EQ(layout->selectorID("k"), ClassLayout::INVALID_SELECTOR);
+
+  /// Overriding methods keep the slot of the method they override, and the
+  /// same name can have different slots in unrelated classes
+  ASSERT_EQ(layout->slotsCount(idA), 1);
+  ASSERT_EQ(layout->slotsCount(idB), 2);
+  ASSERT_EQ(layout->slotsCount(idC), 2);
+  ASSERT_EQ(layout->slot(idA, "f"), 0);
+  ASSERT_EQ(layout->slot(idB, "f"), 0);
+  ASSERT_EQ(layout->slot(idB, "g"), 1);
+  ASSERT_EQ(layout->slot(idC, "h"), 0);
+  ASSERT_EQ(layout->slot(idC, "g"), 1);
+  ASSERT_EQ(layout->slot(idA, "g"), -1);
+  ASSERT_EQ(layout->slot(idC, "f"), -1);
+
+  /// Dispatch tables point to the most derived definition
+  std::vector<DispatchTableEntry> entries;
+  layout->dispatchTable(idB, &entries);
+  ASSERT_EQ(entries.size(), 2);
+  ASSERT_EQ(layout->selectorName(entries[0].selectorID), "f");
+  ASSERT_EQ(entries[0].classID, idB);
+  ASSERT_EQ(layout->selectorName(entries[1].selectorID), "g");
+  ASSERT_EQ(entries[1].classID, idB);
+
+  layout->dispatchTable(idA, &entries);
+  ASSERT_EQ(entries.size(), 1);
+  ASSERT_EQ(entries[0].classID, idA);
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
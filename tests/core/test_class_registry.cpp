@@ -20,7 +20,7 @@ ClassNodePtr CreateClassNode(const std::string &className,
                              const std::string &parentClassName) {
   std::vector<GenericAttributeNodePtr> attributes;
   return ClassNodePtr(ClassNode::MakeClassNode(className, parentClassName,
-                                               attributes, false, 0, 0));
+                                               attributes, false, 0));
 }
 
 } // namespace
@@ -81,6 +81,145 @@ TEST(ClassRegistry, TypeRelationships) {
   ASSERT_EQ(typeA.typeID, registry.leastCommonAncestor(typeA, typeC).typeID);
 }
 
+TEST(ClassRegistry, ClassTable) {
+  ClassRegistry registry{};
+
+  /// Parent class is referenced before being defined
+  ASSERT_TRUE(registry.addClass(CreateClassNode("B", "A")).isOk());
+  ASSERT_EQ(registry.size(), 1);
+  ASSERT_TRUE(registry.hasClass("B"));
+  ASSERT_FALSE(registry.hasClass("A"));
+
+  /// Parent class is now defined
+  auto classA = CreateClassNode("A", "");
+  ASSERT_TRUE(registry.addClass(classA).isOk());
+  ASSERT_EQ(registry.size(), 2);
+  ASSERT_TRUE(registry.hasClass("A"));
+
+  /// Class table entries are consistent
+  const auto idA = registry.typeID("A");
+  const auto idB = registry.typeID("B");
+  ASSERT_EQ(registry.className(idA), "A");
+  ASSERT_EQ(registry.className(idB), "B");
+  ASSERT_EQ(registry.classNode(idA), classA.get());
+  ASSERT_FALSE(registry.hasParentClass(idA));
+  ASSERT_TRUE(registry.hasParentClass(idB));
+  ASSERT_EQ(registry.parentID(idB), idA);
+}
+
+TEST(ClassRegistry, FrozenTypeRelationships) {
+  ClassRegistry registry{};
+  ASSERT_TRUE(registry.addClass(CreateClassNode("C", "B")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("A", "")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("D", "A")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("B", "A")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("E", "")).isOk());
+
+  /// Collect conformance relationships before freezing the registry
+  std::vector<std::string> names{"A", "B", "C", "D", "E"};
+  std::vector<bool> expected;
+  for (auto &child : names) {
+    for (auto &parent : names) {
+      expected.push_back(
+          registry.conformTo(registry.toType(child), registry.toType(parent)));
+    }
+  }
+
+  /// Freeze registry. Conformance relationships must not change
+  ASSERT_FALSE(registry.isFrozen());
+  ASSERT_TRUE(registry.freeze().isOk());
+  ASSERT_TRUE(registry.isFrozen());
+
+  size_t i = 0;
+  for (auto &child : names) {
+    for (auto &parent : names) {
+      ASSERT_EQ(expected[i++], registry.conformTo(registry.toType(child),
+                                                  registry.toType(parent)));
+    }
+  }
+  ASSERT_TRUE(registry.conformTo(registry.toType("C"), registry.toType("A")));
+  ASSERT_FALSE(registry.conformTo(registry.toType("D"), registry.toType("B")));
+  ASSERT_FALSE(registry.conformTo(registry.toType("E"), registry.toType("A")));
+
+  /// No class can be added to a frozen registry
+  ASSERT_FALSE(registry.addClass(CreateClassNode("F", "A")).isOk());
+}
+
+TEST(ClassRegistry, LeastCommonAncestor) {
+  ClassRegistry registry{};
+  ASSERT_TRUE(registry.addClass(CreateClassNode("Object", "")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("A", "Object")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("B", "A")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("C", "B")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("D", "A")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("E", "D")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("F", "E")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("G", "Object")).isOk());
+
+  /// Expected least common ancestors
+  const std::vector<std::vector<std::string>> expected{
+      {"C", "F", "A"},      {"F", "C", "A"},
+      {"C", "E", "A"},      {"B", "C", "B"},
+      {"E", "F", "E"},      {"G", "F", "Object"},
+      {"D", "D", "D"},      {"C", "G", "Object"},
+      {"A", "Object", "Object"}};
+
+  auto checkAncestors = [&registry, &expected]() {
+    for (auto &triplet : expected) {
+      const auto ancestor = registry.leastCommonAncestor(
+          registry.toType(triplet[0]), registry.toType(triplet[1]));
+      ASSERT_EQ(registry.className(ancestor.typeID), triplet[2]);
+      ASSERT_FALSE(ancestor.isSelf);
+    }
+  };
+
+  /// Results must be the same before and after freezing the registry
+  checkAncestors();
+  ASSERT_TRUE(registry.freeze().isOk());
+  checkAncestors();
+}
+
+TEST(ClassRegistry, FreezeMalformedHierarchy) {
+  /// Parent class is not defined
+  {
+    ClassRegistry registry{};
+    ASSERT_TRUE(registry.addClass(CreateClassNode("A", "B")).isOk());
+    ASSERT_FALSE(registry.freeze().isOk());
+    ASSERT_FALSE(registry.isFrozen());
+  }
+
+  /// Cyclic inheritance
+  {
+    ClassRegistry registry{};
+    ASSERT_TRUE(registry.addClass(CreateClassNode("A", "B")).isOk());
+    ASSERT_TRUE(registry.addClass(CreateClassNode("B", "A")).isOk());
+    ASSERT_FALSE(registry.freeze().isOk());
+    ASSERT_FALSE(registry.isFrozen());
+  }
+}
+
+TEST(ClassRegistry, ReserveClassIDs) {
+  ClassRegistry registry{};
+  ASSERT_TRUE(registry.reserveClassIDs({"B", "C", "A"}).isOk());
+
+  /// Classes are assigned the reserved IDs, regardless of the order in which
+  /// they are added
+  ASSERT_TRUE(registry.addClass(CreateClassNode("A", "")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("C", "A")).isOk());
+  ASSERT_TRUE(registry.addClass(CreateClassNode("B", "C")).isOk());
+  ASSERT_EQ(registry.typeID("B"), 0);
+  ASSERT_EQ(registry.typeID("C"), 1);
+  ASSERT_EQ(registry.typeID("A"), 2);
+
+  /// Reserving the IDs again is allowed, as long as they do not change
+  ASSERT_TRUE(registry.reserveClassIDs({"B", "C"}).isOk());
+  ASSERT_FALSE(registry.reserveClassIDs({"A"}).isOk());
+
+  /// IDs cannot be reserved once the registry is frozen
+  ASSERT_TRUE(registry.freeze().isOk());
+  ASSERT_FALSE(registry.reserveClassIDs({"B", "C", "A", "D"}).isOk());
+}
+
 } // namespace cool
 
 int main(int argc, char **argv) {
@@ -0,0 +1,135 @@
+#include <cool/core/compile_cache.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+namespace cool {
+
+namespace {
+
+/// \brief Helper function to write a file
+///
+/// \param[in] filePath path to the file
+/// \param[in] contents contents of the file
+void WriteFile(const std::string &filePath, const std::string &contents) {
+  std::ofstream file(filePath, std::ios::binary);
+  file << contents;
+}
+
+/// \brief Helper function to create a temporary directory
+///
+/// \return the path to the directory
+std::string MakeTemporaryDirectory() {
+  char directoryPath[] = "/tmp/test_compile_cache_XXXXXX";
+  EXPECT_NE(mkdtemp(directoryPath), nullptr);
+  return directoryPath;
+}
+
+} // namespace
+
+TEST(CompileCache, Keys) {
+  const std::string directory = MakeTemporaryDirectory();
+  const std::string first = directory + "/first.cl";
+  const std::string second = directory + "/second.cl";
+  WriteFile(first, "class Main {};");
+  WriteFile(second, "class A {};");
+
+  /// The compiler stamp is generated when the compiler is built
+  ASSERT_EQ(CompileCache::CompilerStamp().length(), 64);
+
+  std::string key;
+  ASSERT_TRUE(CompileCache::MakeKey({first, second}, {}, &key).isOk());
+  ASSERT_EQ(key.length(), 64);
+
+  /// Keys are stable, and depend on the options, the order of the files and
+  /// their contents
+  std::string otherKey;
+  ASSERT_TRUE(CompileCache::MakeKey({first, second}, {}, &otherKey).isOk());
+  ASSERT_EQ(key, otherKey);
+
+  ASSERT_TRUE(
+      CompileCache::MakeKey({first, second}, {"--streaming"}, &otherKey)
+          .isOk());
+  ASSERT_NE(key, otherKey);
+
+  ASSERT_TRUE(CompileCache::MakeKey({second, first}, {}, &otherKey).isOk());
+  ASSERT_NE(key, otherKey);
+
+  WriteFile(second, "class B {};");
+  ASSERT_TRUE(CompileCache::MakeKey({first, second}, {}, &otherKey).isOk());
+  ASSERT_NE(key, otherKey);
+
+  /// Missing files are reported
+  ASSERT_FALSE(
+      CompileCache::MakeKey({directory + "/missing.cl"}, {}, &otherKey)
+          .isOk());
+}
+
+TEST(CompileCache, LookupAndStore) {
+  const std::string directory = MakeTemporaryDirectory() + "/cache";
+  CompileCache cache(directory);
+  ASSERT_TRUE(cache.initialize().isOk());
+  ASSERT_TRUE(cache.initialize().isOk());
+
+  const std::string key(64, 'a');
+  std::string code;
+  ASSERT_FALSE(cache.lookup(key, &code));
+  ASSERT_TRUE(cache.store(key, "\t.data\n").isOk());
+  ASSERT_TRUE(cache.lookup(key, &code));
+  ASSERT_EQ(code, "\t.data\n");
+
+  CompileCacheStatistics statistics;
+  ASSERT_TRUE(cache.statistics(&statistics).isOk());
+  ASSERT_EQ(statistics.hits, 1);
+  ASSERT_EQ(statistics.misses, 1);
+  ASSERT_EQ(statistics.entries, 1);
+  ASSERT_EQ(statistics.bytes, 7);
+}
+
+TEST(CompileCache, ConcurrentStores) {
+  const std::string directory = MakeTemporaryDirectory();
+  CompileCache cache(directory);
+  ASSERT_TRUE(cache.initialize().isOk());
+
+  /// Concurrent compilers store the same entry, while others look it up. The
+  /// entry is either missing or complete
+  const std::string key(64, 'b');
+  const std::string entry(1 << 20, 'x');
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 8; ++i) {
+    threads.emplace_back([&cache, &key, &entry, i]() {
+      std::string code;
+      for (size_t j = 0; j < 10; ++j) {
+        if (i % 2 == 0) {
+          EXPECT_TRUE(cache.store(key, entry).isOk());
+        } else if (cache.lookup(key, &code)) {
+          EXPECT_EQ(code, entry);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  /// Every lookup is recorded, and a single entry is stored
+  CompileCacheStatistics statistics;
+  ASSERT_TRUE(cache.statistics(&statistics).isOk());
+  ASSERT_EQ(statistics.hits + statistics.misses, 40);
+  ASSERT_EQ(statistics.entries, 1);
+  ASSERT_EQ(statistics.bytes, entry.size());
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,107 @@
+#include <cool/core/flat_symbol_table.h>
+#include <cool/core/symbol_table.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace cool {
+
+TEST(FlatSymbolTable, ScopesAndShadowing) {
+  FlatSymbolTable<std::string, int32_t> table;
+
+  /// Class scope
+  ASSERT_TRUE(table.addElement("a", 1).isOk());
+  ASSERT_TRUE(table.addElement("b", 2).isOk());
+  ASSERT_FALSE(table.addElement("a", 3).isOk());
+  ASSERT_EQ(table.count(), 2);
+
+  /// Nested scope shadows class scope
+  table.enterScope();
+  ASSERT_FALSE(table.findKeyInScope("a"));
+  ASSERT_TRUE(table.findKeyInTable("a"));
+  ASSERT_TRUE(table.addElement("a", 4).isOk());
+  ASSERT_TRUE(table.addElement("c", 5).isOk());
+  ASSERT_TRUE(table.findKeyInScope("a"));
+  ASSERT_EQ(table.get("a"), 4);
+  ASSERT_EQ(table.get("b"), 2);
+  ASSERT_EQ(table.count(), 4);
+
+  /// Exiting the nested scope restores the shadowed definition
+  table.exitScope();
+  ASSERT_TRUE(table.findKeyInScope("a"));
+  ASSERT_FALSE(table.findKeyInTable("c"));
+  ASSERT_EQ(table.get("a"), 1);
+  ASSERT_EQ(table.count(), 2);
+}
+
+TEST(FlatSymbolTable, ParentTable) {
+  FlatSymbolTable<std::string, int32_t> parentTable;
+  ASSERT_TRUE(parentTable.addElement("a", 1).isOk());
+
+  FlatSymbolTable<std::string, int32_t> table;
+  table.setParentTable(&parentTable);
+  ASSERT_TRUE(table.findKeyInTable("a"));
+  ASSERT_FALSE(table.findKeyInScope("a"));
+  ASSERT_EQ(table.get("a"), 1);
+
+  ASSERT_TRUE(table.addElement("a", 2).isOk());
+  ASSERT_EQ(table.get("a"), 2);
+  ASSERT_EQ(table.count(), 2);
+  ASSERT_FALSE(table.findKeyInTable("b"));
+}
+
+TEST(FlatSymbolTable, MatchesSymbolTable) {
+  /// Apply the same random sequence of operations to both implementations.
+  /// The small key space forces shadowing, while the number of scopes forces
+  /// the flat table to grow and to shift entries back on removal
+  SymbolTable<std::string, int32_t> reference;
+  FlatSymbolTable<std::string, int32_t> table;
+
+  uint64_t state = 0x2545F4914F6CDD1Dull;
+  auto next = [&state]() {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  };
+
+  size_t depth = 1;
+  for (int32_t i = 0; i < 20000; ++i) {
+    const std::string key = "k" + std::to_string(next() % 97);
+    switch (next() % 8) {
+    case 0:
+      reference.enterScope();
+      table.enterScope();
+      ++depth;
+      break;
+    case 1:
+      if (depth > 1) {
+        reference.exitScope();
+        table.exitScope();
+        --depth;
+      }
+      break;
+    default:
+      ASSERT_EQ(reference.addElement(key, i).isOk(),
+                table.addElement(key, i).isOk());
+      break;
+    }
+
+    ASSERT_EQ(reference.count(), table.count());
+    ASSERT_EQ(reference.findKeyInScope(key), table.findKeyInScope(key));
+    ASSERT_EQ(reference.findKeyInTable(key), table.findKeyInTable(key));
+    if (reference.findKeyInTable(key)) {
+      ASSERT_EQ(reference.get(key), table.get(key));
+    }
+  }
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
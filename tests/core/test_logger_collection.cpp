@@ -1,5 +1,6 @@
 #include <cool/core/logger.h>
 #include <cool/core/logger_collection.h>
+#include <utils/test_utils.h>
 
 #include <gtest/gtest.h>
 
@@ -30,6 +31,70 @@ TEST(LoggerCollection, BasicTest) {
   }
 }
 
+TEST(LoggerCollection, Severity) {
+  LoggerCollection loggers;
+  ASSERT_FALSE(loggers.isEnabled(LogMessageSeverity::FATAL));
+
+  /// The collection severity is the minimum severity of its loggers
+  loggers.registerLogger(
+      "ErrorLogger",
+      std::make_shared<Logger>(nullptr, LogMessageSeverity::ERROR));
+  loggers.registerLogger(
+      "WarningLogger",
+      std::make_shared<Logger>(nullptr, LogMessageSeverity::WARNING));
+  ASSERT_EQ(loggers.severity(), LogMessageSeverity::WARNING);
+  ASSERT_FALSE(loggers.isEnabled(LogMessageSeverity::DEBUG));
+  ASSERT_TRUE(loggers.isEnabled(LogMessageSeverity::WARNING));
+  ASSERT_TRUE(loggers.isEnabled(LogMessageSeverity::ERROR));
+
+  /// Removing a logger updates the collection severity
+  loggers.removeLogger("WarningLogger");
+  ASSERT_EQ(loggers.severity(), LogMessageSeverity::ERROR);
+  ASSERT_FALSE(loggers.isEnabled(LogMessageSeverity::WARNING));
+
+  loggers.removeLogger("ErrorLogger");
+  ASSERT_FALSE(loggers.isEnabled(LogMessageSeverity::FATAL));
+}
+
+TEST(LoggerCollection, MessagesAreNotFormattedWhenFiltered) {
+  LoggerCollection loggers;
+  loggers.registerLogger(
+      "ErrorLogger",
+      std::make_shared<Logger>(nullptr, LogMessageSeverity::ERROR));
+
+  /// Format arguments are evaluated only if the message is recorded
+  int32_t evaluationsCount = 0;
+  auto *logger = &loggers;
+  LOG_DEBUG_MESSAGE(logger, "%d", ++evaluationsCount);
+  ASSERT_EQ(evaluationsCount, 0);
+
+  loggers.removeLogger("ErrorLogger");
+  LOG_ERROR_MESSAGE(logger, "%d", ++evaluationsCount);
+  ASSERT_EQ(evaluationsCount, 0);
+}
+
+TEST(LoggerCollection, BufferedLogger) {
+  auto buffer = std::make_shared<BufferedLogger>(LogMessageSeverity::WARNING);
+  auto target = std::make_shared<StringLogger>();
+  LoggerCollection loggers;
+  loggers.registerLogger("StringLogger", target);
+
+  /// Messages below the logger severity are discarded
+  buffer->logMessage(LogMessage::MakeDebugMessage("debug"));
+  buffer->logMessage(LogMessage::MakeErrorMessage("first"));
+  buffer->logMessage(LogMessage::MakeErrorMessage("second"));
+  ASSERT_EQ(target->loggedMessageCount(), 0);
+
+  /// Messages are replayed in order and cleared
+  buffer->flush(&loggers);
+  ASSERT_EQ(target->loggedMessageCount(), 2);
+  ASSERT_EQ(target->loggedMessage(0).message(), "first");
+  ASSERT_EQ(target->loggedMessage(1).message(), "second");
+
+  buffer->flush(&loggers);
+  ASSERT_EQ(target->loggedMessageCount(), 2);
+}
+
 } // namespace cool
 
 int main(int argc, char **argv) {
@@ -0,0 +1,55 @@
+#include <cool/core/sha256.h>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace cool {
+
+namespace {
+
+/// \brief Helper function to compute the digest of a string in one update
+///
+/// \param[in] message message
+/// \return the digest of the message
+std::string Digest(const std::string &message) {
+  Sha256 hash;
+  hash.update(message);
+  return hash.hexDigest();
+}
+
+} // namespace
+
+TEST(Sha256, KnownDigests) {
+  ASSERT_EQ(Digest(""),
+            "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+  ASSERT_EQ(Digest("abc"),
+            "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  ASSERT_EQ(Digest("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+            "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+  ASSERT_EQ(Digest(std::string(1000000, 'a')),
+            "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST(Sha256, IncrementalUpdates) {
+  /// Messages fed in pieces of any size have the same digest
+  std::string message;
+  for (size_t i = 0; i < 300; ++i) {
+    message.push_back(static_cast<char>(i * 7));
+  }
+
+  for (size_t pieceLength : {1, 3, 63, 64, 65, 200}) {
+    Sha256 hash;
+    for (size_t i = 0; i < message.length(); i += pieceLength) {
+      hash.update(message.substr(i, pieceLength));
+    }
+    ASSERT_EQ(hash.hexDigest(), Digest(message));
+  }
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
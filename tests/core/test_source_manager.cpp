@@ -0,0 +1,109 @@
+#include <cool/core/source_manager.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace cool {
+
+namespace {
+
+/// \brief Helper function to check the line and the column of a location
+///
+/// \param[in] sourceManager source manager
+/// \param[in] offset location to convert
+/// \param[in] line expected line
+/// \param[in] column expected column
+void ExpectLocation(const SourceManager &sourceManager, const uint32_t offset,
+                    const uint32_t line, const uint32_t column) {
+  const auto location = sourceManager.location(offset);
+  EXPECT_EQ(location.line, line);
+  EXPECT_EQ(location.column, column);
+}
+
+} // namespace
+
+TEST(SourceManager, TextLocations) {
+  SourceManager sourceManager;
+  const uint32_t first = sourceManager.addText("ab\ncd\n\nef");
+  const uint32_t second = sourceManager.addText("x\ny");
+  ASSERT_NE(first, 0);
+  ASSERT_EQ(second, first + 10);
+
+  /// Locations in the first text, converted out of order
+  ExpectLocation(sourceManager, first + 7, 4, 1);
+  ExpectLocation(sourceManager, first, 1, 1);
+  ExpectLocation(sourceManager, first + 2, 1, 3);
+  ExpectLocation(sourceManager, first + 4, 2, 2);
+  ExpectLocation(sourceManager, first + 6, 3, 1);
+  ExpectLocation(sourceManager, first + 9, 4, 3);
+
+  /// Locations in the second text
+  ExpectLocation(sourceManager, second, 1, 1);
+  ExpectLocation(sourceManager, second + 2, 2, 1);
+  ExpectLocation(sourceManager, second + 3, 2, 2);
+
+  /// Locations outside of the registered texts
+  ExpectLocation(sourceManager, 0, 0, 0);
+  ExpectLocation(sourceManager, second + 4, 0, 0);
+}
+
+TEST(SourceManager, LineStarts) {
+  SourceManager sourceManager;
+  sourceManager.addText("ab\ncd\n\nef");
+  sourceManager.addText("x\ny");
+
+  /// Line starts are computed for the whole texts
+  const auto lines = sourceManager.lines();
+  ASSERT_EQ(lines.size(), 2);
+  ASSERT_EQ(lines[0].length, 9);
+  ASSERT_EQ(lines[0].lineStarts, std::vector<uint32_t>({0, 3, 6, 7}));
+  ASSERT_EQ(lines[1].length, 3);
+  ASSERT_EQ(lines[1].lineStarts, std::vector<uint32_t>({0, 2}));
+
+  /// Texts registered by their line starts have the same locations
+  SourceManager linesManager;
+  const uint32_t first = linesManager.addLines(lines[0]);
+  const uint32_t second = linesManager.addLines(lines[1]);
+  ASSERT_EQ(second, first + 10);
+  ExpectLocation(linesManager, first + 4, 2, 2);
+  ExpectLocation(linesManager, first + 9, 4, 3);
+  ExpectLocation(linesManager, second + 3, 2, 2);
+  ExpectLocation(linesManager, second + 4, 0, 0);
+}
+
+TEST(SourceManager, FileLocations) {
+  char filePath[] = "/tmp/test_source_manager_XXXXXX";
+  const int fd = mkstemp(filePath);
+  ASSERT_GE(fd, 0);
+  close(fd);
+  {
+    std::ofstream file(filePath, std::ios::binary);
+    file << "class A {};\n\nclass B {};\n";
+  }
+
+  /// The file is read when a location is converted
+  SourceManager sourceManager;
+  const uint32_t text = sourceManager.addText("text");
+  const uint32_t file = sourceManager.addFile(filePath);
+  ASSERT_EQ(file, text + 5);
+
+  ExpectLocation(sourceManager, file + 19, 3, 7);
+  ExpectLocation(sourceManager, file + 6, 1, 7);
+  ExpectLocation(sourceManager, file + 25, 4, 1);
+  ExpectLocation(sourceManager, file + 24, 3, 12);
+  ExpectLocation(sourceManager, text + 3, 1, 4);
+  remove(filePath);
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,54 @@
+#include <cool/core/thread_pool.h>
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace cool {
+
+TEST(ThreadPool, TasksResults) {
+  static constexpr size_t TASKS_COUNT = 1000;
+  ThreadPool pool(4);
+  ASSERT_EQ(pool.threadsCount(), 4);
+
+  std::vector<std::future<size_t>> results;
+  for (size_t i = 0; i < TASKS_COUNT; ++i) {
+    results.push_back(pool.submit([i]() { return i * i; }));
+  }
+
+  for (size_t i = 0; i < TASKS_COUNT; ++i) {
+    ASSERT_EQ(results[i].get(), i * i);
+  }
+}
+
+TEST(ThreadPool, DestructorWaitsForTasks) {
+  static constexpr size_t TASKS_COUNT = 100;
+  std::atomic<size_t> completedCount(0);
+  {
+    ThreadPool pool(2);
+    for (size_t i = 0; i < TASKS_COUNT; ++i) {
+      pool.submit([&completedCount]() { completedCount++; });
+    }
+  }
+  ASSERT_EQ(completedCount.load(), TASKS_COUNT);
+}
+
+TEST(ThreadPool, Exceptions) {
+  ThreadPool pool(1);
+  auto result = pool.submit([]() -> int32_t { throw std::string("error"); });
+  ASSERT_THROW(result.get(), std::string);
+
+  /// The worker survives the exception
+  ASSERT_EQ(pool.submit([]() { return 42; }).get(), 42);
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,8 +1,13 @@
 //#include <cool/frontend/scanner_state.h>
+#include <cool/core/logger_collection.h>
+#include <cool/core/thread_pool.h>
+#include <cool/frontend/chunked_parser.h>
 #include <cool/frontend/parser.h>
 #include <cool/ir/class.h>
+#include <cool/ir/expr.h>
 
 #include <gtest/gtest.h>
+#include <utils/test_utils.h>
 
 #include <iostream>
 #include <string>
@@ -78,6 +83,225 @@ TEST(Parser, InvalidExpressionInBlock) {
   ASSERT_EQ(programNode->classes()[5]->methods().size(), 1);
 }
 
+TEST(Parser, DeeplyNestedExpression) {
+  /// Nesting deeper than the initial parser stack requires the stack to grow
+  static constexpr size_t NESTING_DEPTH = 1000;
+  const std::string programText = "class Main { main() : Int { " +
+                                  std::string(NESTING_DEPTH, '(') + "1" +
+                                  std::string(NESTING_DEPTH, ')') + " }; };";
+  auto parser = Parser::MakeFromString(programText);
+
+  /// Parse program
+  auto programNode = parser.parse();
+  ASSERT_EQ(parser.lastErrorCode(), FrontEndErrorCode::NO_ERROR);
+
+  /// Verify results
+  ASSERT_NE(programNode, nullptr);
+  ASSERT_EQ(programNode->classes().size(), 6);
+  ASSERT_EQ(programNode->classes()[5]->className(), "Main");
+  ASSERT_EQ(programNode->classes()[5]->methods().size(), 1);
+}
+
+TEST(Parser, MergeWithEmptyFirstProgram) {
+  /// A program without classes has no built-in classes either
+  auto emptyParser = Parser::MakeFromString("(* no classes *)\n");
+  auto emptyProgram = emptyParser.parse();
+  ASSERT_NE(emptyProgram, nullptr);
+  ASSERT_TRUE(emptyProgram->classes().empty());
+
+  auto mainParser =
+      Parser::MakeFromString("class Main { main() : Int { 0 }; };");
+  auto mainProgram = mainParser.parse();
+  ASSERT_NE(mainProgram, nullptr);
+
+  /// The merged program still starts with the built-in classes
+  auto programNode =
+      ProgramNode::MakeMergedProgramNode({emptyProgram, mainProgram});
+  const auto &builtInClasses = ProgramNode::BuiltInClasses();
+  ASSERT_EQ(programNode->classes().size(), builtInClasses.size() + 1);
+  for (size_t i = 0; i < builtInClasses.size(); ++i) {
+    ASSERT_EQ(programNode->classes()[i], builtInClasses[i]);
+  }
+  ASSERT_EQ(programNode->classes().back()->className(), "Main");
+}
+
+namespace {
+
+/// \brief Helper function to generate a program with many classes
+///
+/// \param[in] classesCount number of classes
+/// \param[in] invalidClass index of the class with a syntax error, or
+/// classesCount for a valid program
+/// \return the program text
+std::string MakeProgramText(const size_t classesCount,
+                            const size_t invalidClass) {
+  std::string programText = "(* generated (* program *) *)\n";
+  for (size_t i = 0; i < classesCount; ++i) {
+    programText += "class C" + std::to_string(i) + " inherits IO {\n";
+    programText += "  s : String <- \"};\\\n\";\n";
+    programText += i == invalidClass ? "  attr String;\n" : "";
+    programText += "  f(x : Int) : Int { x <- x + 1 }; -- };\n};\n";
+  }
+  return programText;
+}
+
+/// \brief Helper function to check that two logs record the same messages
+///
+/// \param[in] lhs first log
+/// \param[in] rhs second log
+void ExpectSameMessages(const StringLogger &lhs, const StringLogger &rhs) {
+  ASSERT_EQ(lhs.loggedMessageCount(), rhs.loggedMessageCount());
+  for (size_t i = 0; i < lhs.loggedMessageCount(); ++i) {
+    ASSERT_EQ(lhs.loggedMessage(i).message(), rhs.loggedMessage(i).message());
+  }
+}
+
+} // namespace
+
+TEST(Parser, ChunkedParseMatchesSerialParse) {
+  static constexpr size_t CLASSES_COUNT = 20;
+  const std::string programText =
+      MakeProgramText(CLASSES_COUNT, CLASSES_COUNT);
+  ThreadPool pool(4);
+
+  /// Parse the program serially and in chunks, logging every token
+  auto serialLogger = std::make_shared<StringLogger>();
+  auto serialParser = Parser::MakeFromString(programText);
+  auto loggers = std::make_shared<LoggerCollection>();
+  loggers->registerLogger("string", serialLogger);
+  serialParser.registerLoggers(loggers);
+  auto serialProgram = serialParser.parse();
+
+  auto chunkedLogger = std::make_shared<StringLogger>();
+  auto chunkedParser = ChunkedParser::MakeFromString(programText, 0);
+  loggers = std::make_shared<LoggerCollection>();
+  loggers->registerLogger("string", chunkedLogger);
+  chunkedParser.registerLoggers(loggers);
+  auto chunkedProgram = chunkedParser.parse(&pool);
+
+  /// Verify results
+  ASSERT_EQ(chunkedParser.chunksCount(), CLASSES_COUNT);
+  ASSERT_EQ(chunkedParser.lastErrorCode(), FrontEndErrorCode::NO_ERROR);
+  ASSERT_NE(serialProgram, nullptr);
+  ASSERT_NE(chunkedProgram, nullptr);
+  ASSERT_EQ(chunkedProgram->classes().size(), serialProgram->classes().size());
+  for (size_t i = 0; i < serialProgram->classes().size(); ++i) {
+    auto serialClass = serialProgram->classes()[i];
+    auto chunkedClass = chunkedProgram->classes()[i];
+    ASSERT_EQ(chunkedClass->className(), serialClass->className());
+    ASSERT_EQ(chunkedClass->loc(), serialClass->loc());
+
+    const auto serialLocation =
+        serialProgram->sourceManager()->location(serialClass->loc());
+    const auto chunkedLocation =
+        chunkedProgram->sourceManager()->location(chunkedClass->loc());
+    ASSERT_EQ(chunkedLocation.line, serialLocation.line);
+    ASSERT_EQ(chunkedLocation.column, serialLocation.column);
+  }
+  ExpectSameMessages(*chunkedLogger, *serialLogger);
+}
+
+TEST(Parser, ChunkedParseReportsSerialErrors) {
+  static constexpr size_t CLASSES_COUNT = 20;
+  const std::string programText = MakeProgramText(CLASSES_COUNT, 13);
+  ThreadPool pool(4);
+
+  /// Parse the program serially and in chunks
+  auto serialLogger = std::make_shared<StringLogger>();
+  auto serialParser = Parser::MakeFromString(programText);
+  auto loggers = std::make_shared<LoggerCollection>();
+  loggers->registerLogger("string", serialLogger);
+  serialParser.registerLoggers(loggers);
+  auto serialProgram = serialParser.parse();
+
+  auto chunkedLogger = std::make_shared<StringLogger>();
+  auto chunkedParser = ChunkedParser::MakeFromString(programText, 0);
+  loggers = std::make_shared<LoggerCollection>();
+  loggers->registerLogger("string", chunkedLogger);
+  chunkedParser.registerLoggers(loggers);
+  auto chunkedProgram = chunkedParser.parse(&pool);
+
+  /// Verify results
+  ASSERT_EQ(serialParser.lastErrorCode(),
+            FrontEndErrorCode::PARSER_ERROR_INVALID_FEATURE);
+  ASSERT_EQ(chunkedParser.lastErrorCode(), serialParser.lastErrorCode());
+  ASSERT_NE(chunkedProgram, nullptr);
+  ASSERT_EQ(chunkedProgram->classes().size(), serialProgram->classes().size());
+  ExpectSameMessages(*chunkedLogger, *serialLogger);
+}
+
+TEST(Parser, ChunkedParseSignaturesThenClasses) {
+  static constexpr size_t CLASSES_COUNT = 20;
+  const std::string programText =
+      MakeProgramText(CLASSES_COUNT, CLASSES_COUNT);
+  auto serialParser = Parser::MakeFromString(programText);
+  auto serialProgram = serialParser.parse();
+  ASSERT_NE(serialProgram, nullptr);
+
+  /// Split the program at every class boundary and parse the signatures
+  auto chunkedParser = ChunkedParser::MakeFromString(programText, 0);
+  auto signatures = chunkedParser.parseSignatures();
+  ASSERT_EQ(chunkedParser.chunksCount(), CLASSES_COUNT);
+  ASSERT_EQ(chunkedParser.lastErrorCode(), FrontEndErrorCode::NO_ERROR);
+  ASSERT_NE(signatures, nullptr);
+  ASSERT_EQ(signatures->classes().size(), serialProgram->classes().size());
+  ASSERT_EQ(chunkedParser.parseSignatures(), nullptr);
+
+  /// Signatures have no expressions, and each class parses again in full
+  for (size_t i = 0; i < serialProgram->classes().size(); ++i) {
+    auto serialClass = serialProgram->classes()[i];
+    auto signatureClass = signatures->classes()[i];
+    ASSERT_EQ(signatureClass->className(), serialClass->className());
+    ASSERT_EQ(signatureClass->loc(), serialClass->loc());
+    if (serialClass->builtIn()) {
+      ASSERT_FALSE(chunkedParser.hasClass(serialClass->className()));
+      continue;
+    }
+
+    ASSERT_EQ(signatureClass->attributes().front()->initExpr(), nullptr);
+    ASSERT_EQ(signatureClass->methods().front()->body(), nullptr);
+    ASSERT_EQ(signatureClass->methods().front()->arguments().size(), 1);
+
+    ClassNode *classNode = nullptr;
+    auto classProgram =
+        chunkedParser.parseClass(serialClass->className(), &classNode);
+    ASSERT_NE(classProgram, nullptr);
+    ASSERT_NE(classNode, nullptr);
+    ASSERT_EQ(classNode->className(), serialClass->className());
+    ASSERT_EQ(classNode->methods().front()->body()->loc(),
+              serialClass->methods().front()->body()->loc());
+  }
+
+  /// Classes that the program does not define are not found
+  ClassNode *classNode = nullptr;
+  ASSERT_EQ(chunkedParser.parseClass("Missing", &classNode), nullptr);
+  ASSERT_EQ(classNode, nullptr);
+}
+
+TEST(Parser, ChunkedParseSignaturesReportsSerialErrors) {
+  static constexpr size_t CLASSES_COUNT = 20;
+  const std::string programText = MakeProgramText(CLASSES_COUNT, 13);
+
+  /// Parse the program serially and its signatures in chunks
+  auto serialLogger = std::make_shared<StringLogger>();
+  auto serialParser = Parser::MakeFromString(programText);
+  auto loggers = std::make_shared<LoggerCollection>();
+  loggers->registerLogger("string", serialLogger);
+  serialParser.registerLoggers(loggers);
+  serialParser.parse();
+
+  auto chunkedLogger = std::make_shared<StringLogger>();
+  auto chunkedParser = ChunkedParser::MakeFromString(programText, 0);
+  loggers = std::make_shared<LoggerCollection>();
+  loggers->registerLogger("string", chunkedLogger);
+  chunkedParser.registerLoggers(loggers);
+
+  /// Verify results
+  ASSERT_EQ(chunkedParser.parseSignatures(), nullptr);
+  ASSERT_EQ(chunkedParser.lastErrorCode(), serialParser.lastErrorCode());
+  ExpectSameMessages(*chunkedLogger, *serialLogger);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -5,8 +5,12 @@
 #include <cool/core/logger_collection.h>
 
 #include <gtest/gtest.h>
+#include <utils/test_utils.h>
 
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <string>
 #include <unistd.h>
 #include <vector>
 
@@ -44,6 +48,89 @@ std::vector<uint32_t> TOKENS{CLASS_TOKEN,
                              '}',
                              ';'};
 
+/// Token scanned by a scanner, with its location, value and error code
+struct ScannedToken {
+  int token;
+  YYLTYPE location;
+  std::string value;
+  FrontEndErrorCode errorCode;
+};
+
+/// \brief Helper function to scan an input until the end of file
+///
+/// \param[in] state scanner state
+/// \param[in] useFastScanner true to scan with the hand-written scanner
+/// \param[out] logger logger that records the scanner messages
+/// \return the scanned tokens, including the end of file
+std::vector<ScannedToken> ScanAll(ScannerState *state,
+                                  const bool useFastScanner,
+                                  std::shared_ptr<StringLogger> logger) {
+  auto loggers = std::make_shared<LoggerCollection>();
+  loggers->registerLogger("string", logger);
+  state->useFastScanner(useFastScanner);
+
+  /// Register the input, so that the messages report lines and columns
+  auto sourceManager = std::make_shared<SourceManager>();
+  state->setSource(sourceManager, state->registerInput(sourceManager.get()));
+
+  std::vector<ScannedToken> tokens;
+  YYSTYPE yylval;
+  YYLTYPE yylloc = 0;
+  while (true) {
+    ScannedToken scanned;
+    scanned.token =
+        yylex(&yylval, &yylloc, loggers.get(), state->scannerState());
+    scanned.location = yylloc;
+    scanned.errorCode = state->lastErrorCode();
+    switch (scanned.token) {
+    case CLASS_ID_TOKEN:
+    case OBJECT_ID_TOKEN:
+      scanned.value = yylval.symbolVal;
+      break;
+    case STRING_TOKEN:
+      scanned.value = *yylval.literalVal;
+      break;
+    case INTEGER_TOKEN:
+      scanned.value = std::to_string(yylval.integerVal);
+      break;
+    default:
+      break;
+    }
+    tokens.push_back(scanned);
+    if (scanned.token == 0) {
+      return tokens;
+    }
+  }
+}
+
+/// \brief Helper function to check that the Flex scanner and the
+/// hand-written scanner agree on an input
+///
+/// \param[in] makeState function that creates a scanner state for the input
+template <typename MakeStateT> void ExpectSameTokens(MakeStateT makeState) {
+  auto flexLogger = std::make_shared<StringLogger>();
+  auto flexState = makeState();
+  auto flexTokens = ScanAll(flexState.get(), false, flexLogger);
+
+  auto fastLogger = std::make_shared<StringLogger>();
+  auto fastState = makeState();
+  auto fastTokens = ScanAll(fastState.get(), true, fastLogger);
+
+  ASSERT_EQ(fastTokens.size(), flexTokens.size());
+  for (size_t i = 0; i < flexTokens.size(); ++i) {
+    ASSERT_EQ(fastTokens[i].token, flexTokens[i].token);
+    ASSERT_EQ(fastTokens[i].value, flexTokens[i].value);
+    ASSERT_EQ(fastTokens[i].errorCode, flexTokens[i].errorCode);
+    ASSERT_EQ(fastTokens[i].location, flexTokens[i].location);
+  }
+
+  ASSERT_EQ(fastLogger->loggedMessageCount(), flexLogger->loggedMessageCount());
+  for (size_t i = 0; i < flexLogger->loggedMessageCount(); ++i) {
+    ASSERT_EQ(fastLogger->loggedMessage(i).message(),
+              flexLogger->loggedMessage(i).message());
+  }
+}
+
 } // namespace
 
 TEST(Scanner, BasicTests) {
@@ -105,7 +192,7 @@ TEST(Scanner, BasicTests) {
     auto actualToken = yylex(&yylval, &yylloc, nullptr, state->scannerState());
     EXPECT_EQ(actualToken, STRING_TOKEN);
 
-    const std::string actualText = yylval.literalVal;
+    const std::string actualText = *yylval.literalVal;
     EXPECT_EQ(actualText, "Test special characters: g \b");
   }
 
@@ -165,6 +252,121 @@ TEST(Scanner, BasicTests) {
   }
 }
 
+TEST(Scanner, Locations) {
+  const std::string text = "class Main {\n  x : \"(*\" ; (* a\n *) y\n};";
+  for (const bool useFastScanner : {false, true}) {
+    SCOPED_TRACE(useFastScanner);
+    auto state = ScannerState::MakeFromString(text);
+    state->useFastScanner(useFastScanner);
+
+    /// Locations are byte offsets from the start of the registered text
+    auto sourceManager = std::make_shared<SourceManager>();
+    sourceManager->addText("first text");
+    const uint32_t startOffset = state->registerInput(sourceManager.get());
+    state->setSource(sourceManager, startOffset);
+
+    YYSTYPE yylval;
+    YYLTYPE yylloc = 0;
+    const std::vector<uint32_t> offsets = {0, 6, 11, 15, 17, 19, 24, 35, 37,
+                                           38};
+    for (const auto offset : offsets) {
+      ASSERT_NE(yylex(&yylval, &yylloc, nullptr, state->scannerState()), 0);
+      ASSERT_EQ(yylloc, startOffset + offset);
+    }
+    ASSERT_EQ(yylex(&yylval, &yylloc, nullptr, state->scannerState()), 0);
+
+    /// Lines and columns are computed from the locations
+    auto location = sourceManager->location(startOffset + offsets[3]);
+    ASSERT_EQ(location.line, 2);
+    ASSERT_EQ(location.column, 3);
+
+    location = sourceManager->location(startOffset + offsets[7]);
+    ASSERT_EQ(location.line, 3);
+    ASSERT_EQ(location.column, 5);
+  }
+}
+
+TEST(Scanner, InPlaceInputs) {
+  const std::string filePath = "assets/lexer_test.cl";
+
+  /// Memory-mapped file
+  {
+    auto state = ScannerState::MakeFromMappedFile(filePath);
+
+    YYSTYPE yylval;
+    YYLTYPE yylloc;
+    for (auto expectedToken : TOKENS) {
+      auto actualToken =
+          yylex(&yylval, &yylloc, nullptr, state->scannerState());
+      ASSERT_EQ(actualToken, expectedToken);
+    }
+  }
+
+  /// Buffer terminated by the sentinel bytes
+  {
+    std::ifstream ifs(filePath);
+    std::vector<char> buffer((std::istreambuf_iterator<char>(ifs)),
+                             std::istreambuf_iterator<char>());
+    buffer.resize(buffer.size() + ScannerState::SENTINEL_SIZE, '\0');
+    auto state = ScannerState::MakeFromBuffer(buffer.data(), buffer.size());
+
+    YYSTYPE yylval;
+    YYLTYPE yylloc;
+    for (auto expectedToken : TOKENS) {
+      auto actualToken =
+          yylex(&yylval, &yylloc, nullptr, state->scannerState());
+      ASSERT_EQ(actualToken, expectedToken);
+    }
+  }
+}
+
+TEST(Scanner, FastScannerMatchesFlex) {
+  /// Test assets and examples
+  const std::vector<std::string> filePaths = {
+      "assets/lexer_test.cl",          "assets/parser_test.cl",
+      "../../examples/arith.cl",       "../../examples/atoi.cl",
+      "../../examples/book_list.cl",   "../../examples/cells.cl",
+      "../../examples/complex.cl",     "../../examples/cool.cl",
+      "../../examples/giulio.cl",      "../../examples/good.cl",
+      "../../examples/graph.cl",       "../../examples/hairyscary.cl",
+      "../../examples/hello_world.cl", "../../examples/io.cl",
+      "../../examples/lam.cl",         "../../examples/life.cl",
+      "../../examples/list.cl",        "../../examples/new_complex.cl",
+      "../../examples/palindrome.cl",  "../../examples/primes.cl",
+      "../../examples/sort_list.cl"};
+  for (const auto &filePath : filePaths) {
+    SCOPED_TRACE(filePath);
+    ExpectSameTokens(
+        [&filePath]() { return ScannerState::MakeFromFile(filePath); });
+  }
+
+  /// Corner cases of keywords, operators, comments and strings
+  const std::vector<std::string> texts = {
+      "Class cLASS classy class_ False fALSE True tRUE inheritsin",
+      "x<--1 <= => <-- (*) *) ** (* (* nested *) still *) --*)\n)",
+      "12345678901234567890 007 12ab _x [x] #",
+      "\"tab\\tnew\\nline\\\ncontinued\\0\\b\\f\\q\\\"\" next",
+      "\"unescaped\nnewline\" \"" + std::string(1100, 's') + "\" after",
+      "(* unterminated\n comment", "\"unterminated string\\",
+      "-- comment to the end of file"};
+  for (const auto &text : texts) {
+    SCOPED_TRACE(text);
+    ExpectSameTokens([&text]() { return ScannerState::MakeFromString(text); });
+  }
+
+  /// Null characters, which can only be scanned from a buffer
+  const char nullChars[] = "x \"a\0b\" \0 y";
+  const std::string nullText(nullChars, sizeof(nullChars) - 1);
+  std::vector<std::vector<char>> buffers;
+  ExpectSameTokens([&nullText, &buffers]() {
+    buffers.emplace_back(nullText.begin(), nullText.end());
+    buffers.back().resize(nullText.size() + ScannerState::SENTINEL_SIZE,
+                          '\0');
+    return ScannerState::MakeFromBuffer(buffers.back().data(),
+                                        buffers.back().size());
+  });
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,52 @@
+#include <cool/frontend/semantic_value_pool.h>
+#include <cool/ir/expr.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST(SemanticValuePool, MakeAndTake) {
+  cool::SemanticValuePool pool;
+  std::string *text = pool.make(std::string("hello"));
+  ASSERT_EQ(*text, "hello");
+
+  /// Values are moved out of the pool
+  std::string value = pool.take(text);
+  ASSERT_EQ(value, "hello");
+  ASSERT_TRUE(text->empty());
+
+  /// Slots are recycled
+  std::string *other = pool.make(std::string("world"));
+  ASSERT_EQ(other, text);
+  ASSERT_EQ(*other, "world");
+}
+
+TEST(SemanticValuePool, SlotsAreStable) {
+  static constexpr size_t VALUES_COUNT = 10000;
+  cool::SemanticValuePool pool;
+
+  std::vector<std::vector<cool::ExprNodePtr> *> lists;
+  for (size_t i = 0; i < VALUES_COUNT; ++i) {
+    lists.push_back(pool.make(std::vector<cool::ExprNodePtr>(i % 4)));
+  }
+  for (size_t i = 0; i < VALUES_COUNT; ++i) {
+    ASSERT_EQ(lists[i]->size(), i % 4);
+  }
+}
+
+TEST(SemanticValuePool, ClearReleasesValues) {
+  auto node = cool::IdExprNode::MakeIdExprNode("x", 0);
+  cool::SemanticValuePool pool;
+  pool.make<cool::ExprNodePtr>(node);
+  ASSERT_EQ(node.use_count(), 2);
+
+  pool.clear();
+  ASSERT_EQ(node.use_count(), 1);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
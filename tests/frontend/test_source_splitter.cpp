@@ -0,0 +1,127 @@
+#include <cool/frontend/source_splitter.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace cool;
+
+namespace {
+
+/// \brief Helper function to split a program text into its chunks
+///
+/// \param[in] text program text
+/// \param[in] minChunkLength minimum length of a chunk
+/// \return the chunks of the program text
+std::vector<SourceChunk> Split(const std::string &text,
+                               const size_t minChunkLength = 0) {
+  return SplitAtClassBoundaries(text.data(), text.size(), minChunkLength);
+}
+
+/// \brief Helper function to extract the text of a chunk
+///
+/// \param[in] text program text
+/// \param[in] chunk chunk
+/// \return the text of the chunk
+std::string ChunkText(const std::string &text, const SourceChunk &chunk) {
+  return text.substr(chunk.offset, chunk.length);
+}
+
+} // namespace
+
+TEST(SourceSplitter, SplitsAtClassBoundaries) {
+  const std::string text = "class A {\n  x : Int;\n};\n"
+                           "class B inherits A {\n  f() : Int { 0 };\n};\n"
+                           "class C {};";
+
+  auto chunks = Split(text);
+  ASSERT_EQ(chunks.size(), 3);
+  ASSERT_EQ(ChunkText(text, chunks[0]), "class A {\n  x : Int;\n};\n");
+  ASSERT_EQ(chunks[0].line, 1);
+  ASSERT_EQ(ChunkText(text, chunks[1]),
+            "class B inherits A {\n  f() : Int { 0 };\n};\n");
+  ASSERT_EQ(chunks[1].line, 4);
+  ASSERT_EQ(ChunkText(text, chunks[2]), "class C {};");
+  ASSERT_EQ(chunks[2].line, 7);
+}
+
+TEST(SourceSplitter, KeepsClassesOnTheSameLineTogether) {
+  const std::string text = "class A {}; class B {};\nclass C {};\n";
+
+  auto chunks = Split(text);
+  ASSERT_EQ(chunks.size(), 2);
+  ASSERT_EQ(ChunkText(text, chunks[0]), "class A {}; class B {};\n");
+  ASSERT_EQ(ChunkText(text, chunks[1]), "class C {};\n");
+  ASSERT_EQ(chunks[1].line, 2);
+}
+
+TEST(SourceSplitter, SkipsCommentsAndStrings) {
+  const std::string text =
+      "class A { s : String <- \"};\\\n}; \\\" };\"; };\n"
+      "(* class B {};\n (* nested *) };\n *)\n"
+      "-- };\n"
+      "class C { x : Int <--1; };\n"
+      "class D {};\n";
+
+  auto chunks = Split(text);
+  ASSERT_EQ(chunks.size(), 3);
+  ASSERT_EQ(chunks[0].line, 1);
+  ASSERT_EQ(chunks[1].line, 3);
+  ASSERT_EQ(ChunkText(text, chunks[1]).substr(0, 2), "(*");
+  ASSERT_EQ(ChunkText(text, chunks[2]), "class D {};\n");
+  ASSERT_EQ(chunks[2].line, 8);
+}
+
+TEST(SourceSplitter, GroupsShortClasses) {
+  const std::string text = "class A {};\nclass B {};\nclass C {};\n";
+
+  auto chunks = Split(text, 20);
+  ASSERT_EQ(chunks.size(), 2);
+  ASSERT_EQ(ChunkText(text, chunks[0]), "class A {};\nclass B {};\n");
+  ASSERT_EQ(ChunkText(text, chunks[1]), "class C {};\n");
+  ASSERT_EQ(chunks[1].line, 3);
+}
+
+TEST(SourceSplitter, InvalidTextIsNotSplit) {
+  const std::vector<std::string> texts = {
+      "class A {};\nclass B {};\n(* unterminated",
+      "class A {};\nclass B { s : String <- \"unterminated };\n",
+      "class A {};\nclass B { };\n};\nclass C {};\n",
+      "class A {};\nclass B {\n"};
+
+  for (const auto &text : texts) {
+    auto chunks = Split(text);
+    ASSERT_EQ(chunks.size(), 1);
+    ASSERT_EQ(chunks[0].offset, 0);
+    ASSERT_EQ(chunks[0].length, text.size());
+    ASSERT_EQ(chunks[0].line, 1);
+  }
+}
+
+TEST(SourceSplitter, ChunksCoverTheText) {
+  std::string text;
+  for (size_t i = 0; i < 100; ++i) {
+    text += "class C" + std::to_string(i) + " {\n  f() : Int { 0 };\n};\n";
+  }
+
+  auto chunks = Split(text, 100);
+  ASSERT_GT(chunks.size(), 1);
+
+  std::string joinedText;
+  uint32_t line = 1;
+  for (const auto &chunk : chunks) {
+    ASSERT_EQ(chunk.offset, joinedText.size());
+    ASSERT_EQ(chunk.line, line);
+    joinedText += ChunkText(text, chunk);
+    line += std::count(text.begin() + chunk.offset,
+                       text.begin() + chunk.offset + chunk.length, '\n');
+  }
+  ASSERT_EQ(joinedText, text);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
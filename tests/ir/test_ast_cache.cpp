@@ -0,0 +1,290 @@
+#include <cool/analysis/analysis_context.h>
+#include <cool/analysis/classes_definition.h>
+#include <cool/analysis/classes_implementation.h>
+#include <cool/analysis/name_resolution.h>
+#include <cool/analysis/prelude.h>
+#include <cool/analysis/type_check.h>
+#include <cool/codegen/codegen_code.h>
+#include <cool/codegen/codegen_constants.h>
+#include <cool/codegen/codegen_context.h>
+#include <cool/codegen/codegen_tables.h>
+#include <cool/core/class_registry.h>
+#include <cool/core/source_manager.h>
+#include <cool/ir/ast_cache.h>
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace cool {
+
+namespace {
+
+/// \brief Helper function to create a program that uses most expressions:
+///
+/// class A {
+///   n : Int <- 7;
+///   greet(s : String) : String { s };
+///   count() : Int {
+///     let i : Int <- 0, total : Int in {
+///       while i < n loop { total <- total + i * 2; i <- i + 1; } pool;
+///       if not (total = 0) then total else ~1 fi;
+///     }
+///   };
+/// };
+/// class Main inherits IO {
+///   a : A <- new A;
+///   main() : Object {
+///     case a of
+///       x : A => out_string(x@A.greet("hello"));
+///       o : Object => isvoid o;
+///     esac
+///   };
+/// };
+///
+/// Each node is given a distinct, fixed offset from the start of a text of ten
+/// lines
+///
+/// \return a shared pointer to the program node
+ProgramNodePtr MakeProgram() {
+  auto sourceManager = std::make_shared<SourceManager>();
+  const uint32_t base = sourceManager->addText(std::string(10, '\n'));
+
+  auto id = [base](const std::string &name, const uint32_t offset) {
+    return IdExprNode::MakeIdExprNode(name, base + offset);
+  };
+  auto integer = [base](const int32_t value, const uint32_t offset) {
+    return LiteralExprNode<int32_t>::MakeLiteralExprNode(value, base + offset);
+  };
+  auto arithmetic = [base](ExprNodePtr lhs, ExprNodePtr rhs,
+                           ArithmeticOpID op, const uint32_t offset) {
+    return BinaryExprNode<ArithmeticOpID>::MakeBinaryExprNode(lhs, rhs, op,
+                                                              base + offset);
+  };
+  auto comparison = [base](ExprNodePtr lhs, ExprNodePtr rhs,
+                           ComparisonOpID op, const uint32_t offset) {
+    return BinaryExprNode<ComparisonOpID>::MakeBinaryExprNode(lhs, rhs, op,
+                                                              base + offset);
+  };
+
+  /// Class A
+  std::vector<GenericAttributeNodePtr> attributesA;
+  attributesA.push_back(
+      AttributeNode::MakeAttributeNode("n", "Int", integer(7, 0), base + 1));
+  attributesA.push_back(MethodNode::MakeMethodNode(
+      "greet", "String", {FormalNode::MakeFormalNode("s", "String", base + 2)},
+      id("s", 3), base + 4));
+
+  auto loopBody = BlockExprNode::MakeBlockExprNode(
+      {AssignmentExprNode::MakeAssignmentExprNode(
+           "total",
+           arithmetic(id("total", 5),
+                      arithmetic(id("i", 6), integer(2, 7),
+                                 ArithmeticOpID::Mult, 8),
+                      ArithmeticOpID::Plus, 9),
+           base + 10),
+       AssignmentExprNode::MakeAssignmentExprNode(
+           "i",
+           arithmetic(id("i", 11), integer(1, 12), ArithmeticOpID::Plus, 13),
+           base + 14)},
+      base + 15);
+  auto loop = WhileExprNode::MakeWhileExprNode(
+      comparison(id("i", 16), id("n", 17), ComparisonOpID::LessThan, 18),
+      loopBody, base + 19);
+  auto result = IfExprNode::MakeIfExprNode(
+      UnaryExprNode::MakeUnaryExprNode(
+          comparison(id("total", 20), integer(0, 21), ComparisonOpID::Equal,
+                     22),
+          UnaryOpID::Not, base + 23),
+      id("total", 24),
+      UnaryExprNode::MakeUnaryExprNode(integer(1, 25), UnaryOpID::Complement,
+                                       base + 26),
+      base + 27);
+  auto count = LetExprNode::MakeLetExprNode(
+      {LetBindingNode::MakeLetBindingNode("i", "Int", integer(0, 28),
+                                          base + 29),
+       LetBindingNode::MakeLetBindingNode("total", "Int", nullptr, base + 30)},
+      BlockExprNode::MakeBlockExprNode({loop, result}, base + 31), base + 32);
+  attributesA.push_back(
+      MethodNode::MakeMethodNode("count", "Int", {}, count, base + 33));
+
+  /// Class Main
+  std::vector<GenericAttributeNodePtr> attributesMain;
+  attributesMain.push_back(AttributeNode::MakeAttributeNode(
+      "a", "A", NewExprNode::MakeNewExprNode("A", base + 34), base + 35));
+
+  auto greet = StaticDispatchExprNode::MakeStaticDispatchExprNode(
+      "greet", "A", id("x", 36),
+      {LiteralExprNode<std::string>::MakeLiteralExprNode("hello", base + 37)},
+      base + 38);
+  auto outString = DispatchExprNode::MakeDispatchExprNode(
+      "out_string", nullptr, {greet}, base + 39);
+  auto isVoid = UnaryExprNode::MakeUnaryExprNode(id("o", 40),
+                                                 UnaryOpID::IsVoid, base + 41);
+  auto caseExpr = CaseExprNode::MakeCaseExprNode(
+      {CaseBindingNode::MakeCaseBindingNode("x", "A", outString, base + 42),
+       CaseBindingNode::MakeCaseBindingNode("o", "Object", isVoid, base + 43)},
+      id("a", 44), base + 45);
+  attributesMain.push_back(
+      MethodNode::MakeMethodNode("main", "Object", {}, caseExpr, base + 46));
+
+  auto classes = ProgramNode::BuiltInClasses();
+  classes.push_back(
+      ClassNode::MakeClassNode("A", "Object", attributesA, false, base + 47));
+  classes.push_back(ClassNode::MakeClassNode("Main", "IO", attributesMain,
+                                             false, base + 48));
+  auto program = ProgramNode::MakeProgramNode(classes);
+  program->setFileName("test.cl");
+  program->setSourceManager(sourceManager);
+  return program;
+}
+
+/// \brief Helper function to run the semantic analysis passes. Names are
+/// resolved last, since resolutions are not stored in the cache
+///
+/// \param[in] registry class registry
+/// \param[in] program program node
+/// \param[in] typeCheck true to type-check the class expressions too
+void Analyze(std::shared_ptr<ClassRegistry> registry, ProgramNode *program,
+             const bool typeCheck) {
+  auto context = Prelude::Get()->makeAnalysisContext(registry, nullptr);
+  std::vector<std::shared_ptr<Pass>> passes = {
+      std::make_shared<ClassesDefinitionPass>(),
+      std::make_shared<ClassesImplementationPass>()};
+  if (typeCheck) {
+    passes.push_back(std::make_shared<TypeCheckPass>());
+  }
+  passes.push_back(std::make_shared<NameResolutionPass>());
+
+  for (auto pass : passes) {
+    ASSERT_TRUE(program->visitNode(context.get(), pass.get()).isOk());
+  }
+}
+
+/// \brief Helper function to generate the code of a program
+///
+/// \param[in] registry class registry
+/// \param[in] program program node
+/// \return the generated code
+std::string Codegen(std::shared_ptr<ClassRegistry> registry,
+                    ProgramNode *program) {
+  CodegenContext context(registry);
+  context.setSourceManager(program->sourceManager());
+  std::vector<std::shared_ptr<CodegenBasePass>> passes = {
+      std::make_shared<CodegenConstantsPass>(),
+      std::make_shared<CodegenTablesPass>(),
+      std::make_shared<CodegenObjectsInitPass>()};
+
+  std::stringstream code;
+  for (auto pass : passes) {
+    EXPECT_TRUE(pass->codegen(&context, program, &code).isOk());
+  }
+  return code.str();
+}
+
+} // namespace
+
+TEST(AstCache, RoundTrip) {
+  /// Type-check the program with a registry that assigns class IDs in a
+  /// different order than the class definitions
+  auto registry = Prelude::Get()->makeClassRegistry();
+  ASSERT_TRUE(registry->reserveClassIDs({"Object", "Int", "Bool", "IO",
+                                         "String", "Main", "A"})
+                  .isOk());
+  auto program = MakeProgram();
+  Analyze(registry, program.get(), true);
+
+  std::stringstream cache;
+  ASSERT_TRUE(AstCache::Write(*program, *registry, &cache).isOk());
+
+  /// Load the program and register its classes with the cached IDs
+  std::vector<Symbol> classNames;
+  const std::string data = cache.str();
+  auto loadedProgram = AstCache::Read(data.data(), data.size(), &classNames);
+  ASSERT_NE(loadedProgram, nullptr);
+  ASSERT_EQ(classNames.size(), 7);
+  ASSERT_EQ(classNames[5], Symbol("Main"));
+  ASSERT_EQ(classNames[6], Symbol("A"));
+  ASSERT_EQ(loadedProgram->fileName(), "test.cl");
+
+  auto loadedRegistry = Prelude::Get()->makeClassRegistry();
+  ASSERT_TRUE(loadedRegistry->reserveClassIDs(classNames).isOk());
+  Analyze(loadedRegistry, loadedProgram.get(), false);
+
+  /// Expression types are preserved
+  ASSERT_EQ(loadedProgram->classes().size(), program->classes().size());
+  auto *countBody = loadedRegistry->classNode("A")->methods().back()->body();
+  ASSERT_EQ(countBody->type().typeID, loadedRegistry->typeID("Int"));
+  ASSERT_FALSE(countBody->type().isSelf);
+
+  /// Locations can still be converted to lines
+  auto location = loadedProgram->sourceManager()->location(countBody->loc());
+  ASSERT_EQ(location.line,
+            program->sourceManager()->location(countBody->loc()).line);
+
+  /// The loaded program generates the same code, and is cached identically
+  ASSERT_EQ(Codegen(loadedRegistry, loadedProgram.get()),
+            Codegen(registry, program.get()));
+
+  std::stringstream loadedCache;
+  ASSERT_TRUE(
+      AstCache::Write(*loadedProgram, *loadedRegistry, &loadedCache).isOk());
+  ASSERT_EQ(loadedCache.str(), data);
+}
+
+TEST(AstCache, InvalidCache) {
+  auto registry = Prelude::Get()->makeClassRegistry();
+  auto program = MakeProgram();
+  Analyze(registry, program.get(), true);
+
+  std::stringstream cache;
+  ASSERT_TRUE(AstCache::Write(*program, *registry, &cache).isOk());
+  const std::string data = cache.str();
+  std::vector<Symbol> classNames;
+
+  /// Truncated caches are rejected
+  for (size_t length : {size_t(0), size_t(4), data.size() / 2,
+                        data.size() - 4}) {
+    ASSERT_EQ(AstCache::Read(data.data(), length, &classNames), nullptr);
+  }
+
+  /// Caches with a different magic number or version are rejected
+  for (size_t offset : {size_t(0), sizeof(uint32_t)}) {
+    std::string corrupted = data;
+    corrupted[offset] ^= 0x1;
+    ASSERT_EQ(AstCache::Read(corrupted.data(), corrupted.size(), &classNames),
+              nullptr);
+  }
+
+  /// Caches with expression types outside the class IDs are rejected
+  for (IdentifierType typeID :
+       {IdentifierType(-1), static_cast<IdentifierType>(registry->size())}) {
+    auto *countBody = registry->classNode("A")->methods().back()->body();
+    const auto type = countBody->type();
+    countBody->setType(ExprType{typeID, false});
+
+    std::stringstream corrupted;
+    ASSERT_TRUE(AstCache::Write(*program, *registry, &corrupted).isOk());
+    countBody->setType(type);
+    const std::string corruptedData = corrupted.str();
+    ASSERT_EQ(AstCache::Read(corruptedData.data(), corruptedData.size(),
+                             &classNames),
+              nullptr);
+  }
+
+  /// Missing files are rejected
+  ASSERT_EQ(AstCache::ReadFile("/nonexistent/cache.ast", &classNames),
+            nullptr);
+}
+
+} // namespace cool
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,151 @@
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+#include <cool/ir/node_arena.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+TEST(NodeArena, HeapAllocationWithoutArena) {
+  auto node = cool::IdExprNode::MakeIdExprNode("x", 12);
+  ASSERT_EQ(node.use_count(), 1);
+  ASSERT_EQ(node->id(), cool::Symbol("x"));
+  ASSERT_EQ(node->loc(), 12);
+}
+
+TEST(NodeArena, ArenaNodesAreNotReferenceCounted) {
+  cool::NodeArena arena;
+  auto node = cool::IdExprNode::MakeIdExprNode("x", 1, &arena);
+  auto copy = node;
+
+  ASSERT_NE(node, nullptr);
+  ASSERT_EQ(node.use_count(), 0);
+  ASSERT_EQ(copy.get(), node.get());
+  ASSERT_EQ(node->id(), cool::Symbol("x"));
+  ASSERT_EQ(arena.nodesCount(), 1);
+  ASSERT_GE(arena.bytesUsed(), sizeof(cool::IdExprNode));
+  ASSERT_GE(arena.bytesReserved(), arena.bytesUsed());
+
+  /// Dynamic casts preserve the node address
+  cool::ExprNodePtr expr = node;
+  ASSERT_EQ(std::dynamic_pointer_cast<cool::IdExprNode>(expr).get(),
+            node.get());
+}
+
+TEST(NodeArena, NodesAreDestroyedWithArena) {
+  /// Children allocated on the heap are released by their arena parents
+  auto child = cool::IdExprNode::MakeIdExprNode("x", 0);
+  {
+    cool::NodeArena arena;
+    auto parent = cool::AssignmentExprNode::MakeAssignmentExprNode(
+        "y", child, 0, &arena);
+    ASSERT_EQ(child.use_count(), 2);
+  }
+  ASSERT_EQ(child.use_count(), 1);
+}
+
+TEST(NodeArena, ManyNodes) {
+  /// Allocate enough nodes to span multiple blocks
+  static constexpr size_t NODES_COUNT = 100000;
+  cool::NodeArena arena;
+
+  std::vector<cool::ExprNodePtr> exprs;
+  for (size_t i = 0; i < NODES_COUNT; ++i) {
+    exprs.push_back(cool::LiteralExprNode<int32_t>::MakeLiteralExprNode(
+        static_cast<int32_t>(i), 0, &arena));
+  }
+  auto block =
+      cool::BlockExprNode::MakeBlockExprNode(std::move(exprs), 0, &arena);
+
+  ASSERT_EQ(arena.nodesCount(), NODES_COUNT + 1);
+  ASSERT_EQ(block->exprs().size(), NODES_COUNT);
+  for (size_t i = 0; i < NODES_COUNT; ++i) {
+    auto literal = std::dynamic_pointer_cast<cool::LiteralExprNode<int32_t>>(
+        block->exprs()[i]);
+    ASSERT_NE(literal, nullptr);
+    ASSERT_EQ(literal->value(), static_cast<int32_t>(i));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(literal.get()) %
+                  alignof(cool::LiteralExprNode<int32_t>),
+              0);
+  }
+}
+
+TEST(NodeArena, ProgramOwnsArena) {
+  auto arena = std::make_shared<cool::NodeArena>();
+  std::vector<cool::GenericAttributeNodePtr> attributes;
+  std::vector<cool::ClassNodePtr> classes;
+  classes.push_back(cool::ClassNode::MakeClassNode("Main", "Object", attributes,
+                                                   false, 0, arena.get()));
+
+  auto program = cool::ProgramNode::MakeProgramNode(classes, arena);
+  std::weak_ptr<cool::NodeArena> weakArena = arena;
+  arena.reset();
+  classes.clear();
+
+  ASSERT_FALSE(weakArena.expired());
+  ASSERT_EQ(program->nodeArena(), weakArena.lock());
+  ASSERT_EQ(program->classes()[0]->className(), cool::Symbol("Main"));
+
+  program.reset();
+  ASSERT_TRUE(weakArena.expired());
+}
+
+TEST(NodeArena, MergedProgramOwnsArenas) {
+  std::vector<cool::ProgramNodePtr> programs;
+  std::vector<std::weak_ptr<cool::NodeArena>> weakArenas;
+  for (const char *className : {"A", "B"}) {
+    auto arena = std::make_shared<cool::NodeArena>();
+    std::vector<cool::GenericAttributeNodePtr> attributes;
+    std::vector<cool::ClassNodePtr> classes;
+    classes.push_back(cool::ClassNode::MakeClassNode(
+        "Object", "", attributes, true, 0, arena.get()));
+    classes.push_back(cool::ClassNode::MakeClassNode(
+        className, "Object", attributes, false, 0, arena.get()));
+    programs.push_back(cool::ProgramNode::MakeProgramNode(classes, arena));
+    weakArenas.push_back(arena);
+  }
+
+  /// Built-in classes of the programs are replaced by the shared ones
+  auto program = cool::ProgramNode::MakeMergedProgramNode(programs);
+  const auto &builtInClasses = cool::ProgramNode::BuiltInClasses();
+  const size_t builtInCount = builtInClasses.size();
+  programs.clear();
+  ASSERT_EQ(program->classes().size(), builtInCount + 2);
+  ASSERT_EQ(program->classes()[0], builtInClasses[0]);
+  ASSERT_EQ(program->classes()[builtInCount]->className(), cool::Symbol("A"));
+  ASSERT_EQ(program->classes()[builtInCount + 1]->className(),
+            cool::Symbol("B"));
+  ASSERT_EQ(program->nodeArenas().size(), 2);
+
+  /// The merged program keeps the arenas alive
+  ASSERT_FALSE(weakArenas[0].expired());
+  ASSERT_FALSE(weakArenas[1].expired());
+  program.reset();
+  ASSERT_TRUE(weakArenas[0].expired());
+  ASSERT_TRUE(weakArenas[1].expired());
+}
+
+TEST(NodeArena, MergedProgramInstallsBuiltInClasses) {
+  /// Programs parsed from empty inputs have no built-in classes
+  std::vector<cool::GenericAttributeNodePtr> attributes;
+  std::vector<cool::ClassNodePtr> classes;
+  classes.push_back(
+      cool::ClassNode::MakeClassNode("Main", "Object", attributes, false, 0));
+  std::vector<cool::ProgramNodePtr> programs = {
+      cool::ProgramNode::MakeProgramNode({}),
+      cool::ProgramNode::MakeProgramNode(classes)};
+
+  auto program = cool::ProgramNode::MakeMergedProgramNode(programs);
+  const auto &builtInClasses = cool::ProgramNode::BuiltInClasses();
+  ASSERT_EQ(program->classes().size(), builtInClasses.size() + 1);
+  for (size_t i = 0; i < builtInClasses.size(); ++i) {
+    ASSERT_EQ(program->classes()[i], builtInClasses[i]);
+  }
+  ASSERT_EQ(program->classes().back()->className(), cool::Symbol("Main"));
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,103 @@
+#include <cool/ir/class.h>
+#include <cool/ir/expr.h>
+#include <cool/ir/static_visitor.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Visitor that records the kind of the visited nodes
+class KindRecorder : public cool::StaticVisitor<KindRecorder> {
+
+public:
+  template <typename NodeT>
+  cool::Status apply(NodeT *node, std::vector<cool::NodeKind> *kinds) {
+    const cool::NodeKind kind = cool::NodeKindOf<NodeT>::value;
+    kinds->push_back(kind);
+    return cool::Status::Ok();
+  }
+};
+
+/// Visitor that counts the nodes of an expression tree
+class ExprCounter : public cool::StaticVisitor<ExprCounter, size_t> {
+
+public:
+  template <typename NodeT> size_t apply(NodeT *node) { return 1; }
+
+  size_t apply(cool::BinaryExprNode<cool::ArithmeticOpID> *node) {
+    return 1 + dispatch(node->lhsExpr()) + dispatch(node->rhsExpr());
+  }
+
+  size_t apply(cool::BlockExprNode *node) {
+    size_t count = 1;
+    for (const auto &expr : node->exprs()) {
+      count += dispatch(expr.get());
+    }
+    return count;
+  }
+};
+
+} // namespace
+
+TEST(StaticVisitor, NodeKinds) {
+  std::vector<std::shared_ptr<cool::Node>> nodes;
+  auto lhs = cool::IdExprNode::MakeIdExprNode("x", 0);
+  auto rhs = cool::LiteralExprNode<int32_t>::MakeLiteralExprNode(1, 0);
+  nodes.push_back(lhs);
+  nodes.push_back(rhs);
+  nodes.push_back(
+      cool::LiteralExprNode<std::string>::MakeLiteralExprNode("s", 0));
+  nodes.push_back(cool::BooleanExprNode::MakeBooleanExprNode(true, 0));
+  nodes.push_back(cool::NewExprNode::MakeNewExprNode("Object", 0));
+  nodes.push_back(
+      cool::BinaryExprNode<cool::ArithmeticOpID>::MakeBinaryExprNode(
+          lhs, rhs, cool::ArithmeticOpID::Plus, 0));
+  nodes.push_back(
+      cool::BinaryExprNode<cool::ComparisonOpID>::MakeBinaryExprNode(
+          lhs, rhs, cool::ComparisonOpID::Equal, 0));
+  nodes.push_back(cool::UnaryExprNode::MakeUnaryExprNode(
+      lhs, cool::UnaryOpID::IsVoid, 0));
+  nodes.push_back(cool::FormalNode::MakeFormalNode("x", "Int", 0));
+  nodes.push_back(cool::AttributeNode::MakeAttributeNode("x", "Int", nullptr,
+                                                         0));
+
+  const std::vector<cool::NodeKind> expectedKinds = {
+      cool::NodeKind::IdExpr,          cool::NodeKind::IntLiteralExpr,
+      cool::NodeKind::StringLiteralExpr, cool::NodeKind::BooleanExpr,
+      cool::NodeKind::NewExpr,         cool::NodeKind::ArithmeticExpr,
+      cool::NodeKind::ComparisonExpr,  cool::NodeKind::UnaryExpr,
+      cool::NodeKind::Formal,          cool::NodeKind::Attribute};
+
+  KindRecorder recorder;
+  std::vector<cool::NodeKind> kinds;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    ASSERT_EQ(nodes[i]->kind(), expectedKinds[i]);
+    ASSERT_TRUE(recorder.dispatch(nodes[i].get(), &kinds).isOk());
+  }
+  ASSERT_EQ(kinds, expectedKinds);
+}
+
+TEST(StaticVisitor, CountNodes) {
+  /// Build the expression { 1 + (2 + 3); x; }
+  auto one = cool::LiteralExprNode<int32_t>::MakeLiteralExprNode(1, 0);
+  auto two = cool::LiteralExprNode<int32_t>::MakeLiteralExprNode(2, 0);
+  auto three = cool::LiteralExprNode<int32_t>::MakeLiteralExprNode(3, 0);
+  auto inner = cool::BinaryExprNode<cool::ArithmeticOpID>::MakeBinaryExprNode(
+      two, three, cool::ArithmeticOpID::Plus, 0);
+  auto outer = cool::BinaryExprNode<cool::ArithmeticOpID>::MakeBinaryExprNode(
+      one, inner, cool::ArithmeticOpID::Plus, 0);
+  auto id = cool::IdExprNode::MakeIdExprNode("x", 0);
+  auto block = cool::BlockExprNode::MakeBlockExprNode({outer, id}, 0);
+
+  ExprCounter counter;
+  ASSERT_EQ(counter.dispatch(block.get()), 7);
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
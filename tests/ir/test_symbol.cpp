@@ -0,0 +1,70 @@
+#include <cool/ir/symbol.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+TEST(Symbol, InterningReturnsSameHandle) {
+  const std::string name = "fooBar";
+  cool::Symbol first(name);
+  cool::Symbol second("fooBar");
+  cool::Symbol third(name.c_str(), name.length());
+
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(first, third);
+  ASSERT_EQ(first.id(), second.id());
+  ASSERT_EQ(first.c_str(), second.c_str());
+  ASSERT_EQ(first.str(), name);
+  ASSERT_EQ(first.length(), name.length());
+}
+
+TEST(Symbol, DistinctNamesDistinctHandles) {
+  cool::Symbol first("a");
+  cool::Symbol second("b");
+  cool::Symbol prefix("ab", 1);
+
+  ASSERT_NE(first, second);
+  ASSERT_NE(first.id(), second.id());
+  ASSERT_EQ(first, prefix);
+}
+
+TEST(Symbol, EmptySymbol) {
+  cool::Symbol empty;
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty, cool::Symbol(""));
+  ASSERT_EQ(empty, cool::WellKnownSymbols::Get().empty);
+  ASSERT_FALSE(cool::Symbol("x").empty());
+}
+
+TEST(Symbol, WellKnownSymbols) {
+  const auto &symbols = cool::WellKnownSymbols::Get();
+  ASSERT_EQ(symbols.self, cool::Symbol("self"));
+  ASSERT_EQ(symbols.selfType, cool::Symbol("SELF_TYPE"));
+  ASSERT_EQ(symbols.object, cool::Symbol("Object"));
+  ASSERT_EQ(symbols.mainMethod, cool::Symbol("main"));
+}
+
+TEST(Symbol, InternManySymbols) {
+  /// Force the interner to grow and check that handles remain stable
+  static constexpr size_t SYMBOLS_COUNT = 10000;
+  std::vector<cool::Symbol> symbols;
+  for (size_t i = 0; i < SYMBOLS_COUNT; ++i) {
+    symbols.emplace_back("symbol_" + std::to_string(i));
+  }
+
+  std::unordered_set<cool::Symbol> uniqueSymbols(symbols.begin(),
+                                                 symbols.end());
+  ASSERT_EQ(uniqueSymbols.size(), SYMBOLS_COUNT);
+  for (size_t i = 0; i < SYMBOLS_COUNT; ++i) {
+    cool::Symbol symbol("symbol_" + std::to_string(i));
+    ASSERT_EQ(symbol, symbols[i]);
+    ASSERT_EQ(symbol.str(), "symbol_" + std::to_string(i));
+  }
+}
+
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}